@@ -0,0 +1,110 @@
+#include "JobPool.h"
+
+namespace RiftSpire
+{
+    JobPool::JobPool(u32 workerCount)
+    {
+        if (workerCount == 0)
+        {
+            const u32 hardware = std::thread::hardware_concurrency();
+            workerCount = hardware > 1 ? hardware - 1 : 0;
+        }
+
+        m_Workers.reserve(workerCount);
+        for (u32 i = 0; i < workerCount; ++i)
+        {
+            m_Workers.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    JobPool::~JobPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stopping = true;
+        }
+        m_JobAvailable.notify_all();
+
+        for (std::thread& worker : m_Workers)
+        {
+            worker.join();
+        }
+    }
+
+    JobPool& JobPool::GetShared()
+    {
+        static JobPool s_Instance;
+        return s_Instance;
+    }
+
+    void JobPool::Submit(std::function<void()> job)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Jobs.push_back(std::move(job));
+        }
+        m_JobAvailable.notify_one();
+
+        // A waiting thread may be the only one able to run it
+        m_JobFinished.notify_one();
+    }
+
+    bool JobPool::RunOne()
+    {
+        std::function<void()> job;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (m_Jobs.empty()) return false;
+
+            job = std::move(m_Jobs.front());
+            m_Jobs.pop_front();
+        }
+
+        job();
+        Finished();
+        return true;
+    }
+
+    void JobPool::Wait(const std::atomic<u32>& pending)
+    {
+        while (pending.load(std::memory_order_acquire) != 0)
+        {
+            if (RunOne()) continue;
+
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_JobFinished.wait(lock, [&]()
+            {
+                return pending.load(std::memory_order_acquire) == 0 || !m_Jobs.empty();
+            });
+        }
+    }
+
+    void JobPool::WorkerLoop()
+    {
+        for (;;)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_JobAvailable.wait(lock, [this]() { return m_Stopping || !m_Jobs.empty(); });
+                if (m_Jobs.empty()) return;     // Stopping and drained
+
+                job = std::move(m_Jobs.front());
+                m_Jobs.pop_front();
+            }
+
+            job();
+            Finished();
+        }
+    }
+
+    void JobPool::Finished()
+    {
+        // Taking the lock orders the job's counter update before a waiter's
+        // predicate check, so the wakeup cannot be missed
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+        }
+        m_JobFinished.notify_all();
+    }
+}
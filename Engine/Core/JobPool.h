@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // JobPool - Worker threads for short, frame-bound jobs
+    //=========================================================================
+
+    /// FIFO queue drained by a fixed set of workers. The thread that waits on
+    /// a batch also runs queued jobs, so a pool with no workers still makes
+    /// progress (everything then runs on the waiting thread).
+    class JobPool
+    {
+    public:
+        /// workerCount 0: one per hardware thread, minus the caller's
+        explicit JobPool(u32 workerCount = 0);
+        ~JobPool();
+
+        JobPool(const JobPool&) = delete;
+        JobPool& operator=(const JobPool&) = delete;
+
+        /// Pool shared by engine systems, created on first use
+        static JobPool& GetShared();
+
+        void Submit(std::function<void()> job);
+
+        /// Run one queued job on the calling thread; false if none was queued
+        bool RunOne();
+
+        /// Block until `pending` reaches zero, running queued jobs meanwhile.
+        /// Jobs must decrement it themselves (release order).
+        void Wait(const std::atomic<u32>& pending);
+
+        u32 GetWorkerCount() const { return static_cast<u32>(m_Workers.size()); }
+
+    private:
+        void WorkerLoop();
+        void Finished();
+
+        std::vector<std::thread> m_Workers;
+        std::deque<std::function<void()>> m_Jobs;
+        std::mutex m_Mutex;
+        std::condition_variable m_JobAvailable;
+        std::condition_variable m_JobFinished;
+        bool m_Stopping = false;
+    };
+}
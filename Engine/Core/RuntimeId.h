@@ -0,0 +1,207 @@
+#pragma once
+
+#include <Core/Types.h>
+#include <Core/UUID.h>
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // RuntimeId - Compact process-local handle for a UUID
+    //=========================================================================
+
+    /// Dense 32-bit id for hot-path maps and bitsets. Ids are recycled once
+    /// every reference to a UUID is released, so they never go into files or
+    /// over the network; use the UUID for that.
+    using RuntimeId = u32;
+    constexpr RuntimeId InvalidRuntimeId = 0;
+
+    class RuntimeIdTable
+    {
+    public:
+        /// Process-wide table shared by blocks, stacks and breakpoints. Never
+        /// destroyed, so objects with static lifetime can still release ids.
+        static RuntimeIdTable& Get()
+        {
+            static RuntimeIdTable* instance = new RuntimeIdTable();
+            return *instance;
+        }
+
+        /// Id for a UUID, adding a reference (same UUID -> same id)
+        RuntimeId Acquire(const UUID& uuid)
+        {
+            if (!uuid.IsValid()) return InvalidRuntimeId;
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+
+            auto it = m_Ids.find(uuid);
+            if (it != m_Ids.end())
+            {
+                m_Slots[it->second].RefCount++;
+                return it->second;
+            }
+
+            RuntimeId id;
+            if (!m_Free.empty())
+            {
+                id = m_Free.back();
+                m_Free.pop_back();
+            }
+            else
+            {
+                if (m_Slots.empty()) m_Slots.emplace_back();  // Id 0 is reserved
+                id = static_cast<RuntimeId>(m_Slots.size());
+                m_Slots.emplace_back();
+            }
+
+            m_Slots[id] = { uuid, 1 };
+            m_Ids.emplace(uuid, id);
+            return id;
+        }
+
+        /// Drop a reference; the id is recycled when the last one goes
+        void Release(RuntimeId id)
+        {
+            if (id == InvalidRuntimeId) return;
+
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (id >= m_Slots.size() || m_Slots[id].RefCount == 0) return;
+
+            if (--m_Slots[id].RefCount == 0)
+            {
+                m_Ids.erase(m_Slots[id].Id);
+                m_Slots[id].Id = UUID();
+                m_Free.push_back(id);
+            }
+        }
+
+        /// Id of a live UUID, InvalidRuntimeId if nothing references it
+        RuntimeId Find(const UUID& uuid) const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            auto it = m_Ids.find(uuid);
+            return it != m_Ids.end() ? it->second : InvalidRuntimeId;
+        }
+
+        UUID GetUUID(RuntimeId id) const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return id < m_Slots.size() ? m_Slots[id].Id : UUID();
+        }
+
+        /// Every live id is below this value (sizes dense arrays)
+        size_t GetCapacity() const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Slots.size();
+        }
+
+        size_t GetLiveCount() const
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            return m_Ids.size();
+        }
+
+    private:
+        struct Slot
+        {
+            UUID Id;
+            u32 RefCount = 0;
+        };
+
+        RuntimeIdTable() = default;
+        RuntimeIdTable(const RuntimeIdTable&) = delete;
+        RuntimeIdTable& operator=(const RuntimeIdTable&) = delete;
+
+        mutable std::mutex m_Mutex;
+        std::vector<Slot> m_Slots;                      // Indexed by RuntimeId
+        std::unordered_map<UUID, RuntimeId> m_Ids;
+        std::vector<RuntimeId> m_Free;
+    };
+
+    //=========================================================================
+    // ScopedRuntimeId - Owns one reference in the RuntimeIdTable
+    //=========================================================================
+
+    class ScopedRuntimeId
+    {
+    public:
+        ScopedRuntimeId() = default;
+        explicit ScopedRuntimeId(const UUID& uuid)
+            : m_Id(RuntimeIdTable::Get().Acquire(uuid)) {}
+        ~ScopedRuntimeId() { RuntimeIdTable::Get().Release(m_Id); }
+
+        ScopedRuntimeId(const ScopedRuntimeId&) = delete;
+        ScopedRuntimeId& operator=(const ScopedRuntimeId&) = delete;
+
+        ScopedRuntimeId(ScopedRuntimeId&& other) noexcept : m_Id(other.m_Id) { other.m_Id = InvalidRuntimeId; }
+        ScopedRuntimeId& operator=(ScopedRuntimeId&& other) noexcept
+        {
+            if (this != &other)
+            {
+                RuntimeIdTable::Get().Release(m_Id);
+                m_Id = other.m_Id;
+                other.m_Id = InvalidRuntimeId;
+            }
+            return *this;
+        }
+
+        RuntimeId Get() const { return m_Id; }
+
+    private:
+        RuntimeId m_Id = InvalidRuntimeId;
+    };
+
+    //=========================================================================
+    // LazyRuntimeId - Takes its table reference on first use
+    //=========================================================================
+
+    /// For objects created in bulk and rarely looked up by id, such as the
+    /// blocks of compiled programs: construction and destruction stay off
+    /// the table lock unless something asked for the id.
+    class LazyRuntimeId
+    {
+    public:
+        LazyRuntimeId() = default;
+        ~LazyRuntimeId() { RuntimeIdTable::Get().Release(m_Id.load(std::memory_order_relaxed)); }
+
+        LazyRuntimeId(const LazyRuntimeId&) = delete;
+        LazyRuntimeId& operator=(const LazyRuntimeId&) = delete;
+
+        LazyRuntimeId(LazyRuntimeId&& other) noexcept
+            : m_Id(other.m_Id.exchange(InvalidRuntimeId, std::memory_order_relaxed)) {}
+        LazyRuntimeId& operator=(LazyRuntimeId&& other) noexcept
+        {
+            if (this != &other)
+            {
+                RuntimeIdTable::Get().Release(m_Id.load(std::memory_order_relaxed));
+                m_Id.store(other.m_Id.exchange(InvalidRuntimeId, std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            return *this;
+        }
+
+        /// Id of uuid, which must not change once an id was taken. Safe to
+        /// call from several threads; the loser of a race drops its extra
+        /// reference.
+        RuntimeId Get(const UUID& uuid) const
+        {
+            RuntimeId id = m_Id.load(std::memory_order_acquire);
+            if (id != InvalidRuntimeId) return id;
+
+            id = RuntimeIdTable::Get().Acquire(uuid);
+            RuntimeId expected = InvalidRuntimeId;
+            if (!m_Id.compare_exchange_strong(expected, id, std::memory_order_acq_rel))
+            {
+                RuntimeIdTable::Get().Release(id);
+                return expected;
+            }
+            return id;
+        }
+
+    private:
+        mutable std::atomic<RuntimeId> m_Id{ InvalidRuntimeId };
+    };
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "Types.h"
+#include <cmath>
+#include <cstring>
+
+// Define RS_SIMD_SSE2 as 0 to force the scalar fallback
+#ifndef RS_SIMD_SSE2
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define RS_SIMD_SSE2 1
+    #else
+        #define RS_SIMD_SSE2 0
+    #endif
+#endif
+
+#if RS_SIMD_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace RiftSpire::SIMD
+{
+    //=========================================================================
+    // Float4 - Four float lanes
+    //=========================================================================
+
+    /// SSE2 where the target has it (every x64 build), plain arrays
+    /// elsewhere. Both paths do the same operations in the same order, so
+    /// results match bit for bit as long as the compiler does not contract
+    /// multiply-adds. Comparisons return lane masks (all bits set or clear)
+    /// for Select() and MoveMask().
+    struct Float4
+    {
+#if RS_SIMD_SSE2
+        __m128 V;
+#else
+        float V[4];
+#endif
+    };
+
+    static constexpr u32 Width = 4;
+
+#if RS_SIMD_SSE2
+    inline Float4 Load(const float* p) { return { _mm_loadu_ps(p) }; }
+    inline void Store(float* p, Float4 a) { _mm_storeu_ps(p, a.V); }
+    inline Float4 Splat(float s) { return { _mm_set1_ps(s) }; }
+
+    inline Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.V, b.V) }; }
+    inline Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.V, b.V) }; }
+    inline Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.V, b.V) }; }
+    inline Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.V, b.V) }; }
+
+    inline Float4 Min(Float4 a, Float4 b) { return { _mm_min_ps(a.V, b.V) }; }
+    inline Float4 Max(Float4 a, Float4 b) { return { _mm_max_ps(a.V, b.V) }; }
+    inline Float4 Sqrt(Float4 a) { return { _mm_sqrt_ps(a.V) }; }
+
+    inline Float4 CmpLt(Float4 a, Float4 b) { return { _mm_cmplt_ps(a.V, b.V) }; }
+    inline Float4 CmpLe(Float4 a, Float4 b) { return { _mm_cmple_ps(a.V, b.V) }; }
+    inline Float4 CmpEq(Float4 a, Float4 b) { return { _mm_cmpeq_ps(a.V, b.V) }; }
+
+    inline Float4 And(Float4 a, Float4 b) { return { _mm_and_ps(a.V, b.V) }; }
+    inline Float4 AndNot(Float4 mask, Float4 a) { return { _mm_andnot_ps(mask.V, a.V) }; }
+    inline Float4 Or(Float4 a, Float4 b) { return { _mm_or_ps(a.V, b.V) }; }
+    inline Float4 Xor(Float4 a, Float4 b) { return { _mm_xor_ps(a.V, b.V) }; }
+
+    /// mask ? a : b, per lane
+    inline Float4 Select(Float4 mask, Float4 a, Float4 b) { return Or(And(mask, a), AndNot(mask, b)); }
+
+    /// One bit per lane, lane 0 in bit 0
+    inline u32 MoveMask(Float4 mask) { return static_cast<u32>(_mm_movemask_ps(mask.V)); }
+
+    /// Truncate toward zero to integers and back
+    inline Float4 Truncate(Float4 a) { return { _mm_cvtepi32_ps(_mm_cvttps_epi32(a.V)) }; }
+
+    /// Lanes of an integer-valued Float4 with the given bit set, as a mask
+    inline Float4 TestBit(Float4 integral, int bit)
+    {
+        const __m128i value = _mm_cvttps_epi32(integral.V);
+        const __m128i flag = _mm_set1_epi32(1 << bit);
+        return { _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(value, flag), flag)) };
+    }
+#else
+    namespace Detail
+    {
+        inline float FromBits(u32 bits) { float f; std::memcpy(&f, &bits, sizeof(f)); return f; }
+        inline u32 ToBits(float f) { u32 bits; std::memcpy(&bits, &f, sizeof(bits)); return bits; }
+        inline float Mask(bool set) { return FromBits(set ? 0xFFFFFFFFu : 0u); }
+
+        template<typename Fn>
+        inline Float4 Map(Float4 a, Float4 b, Fn fn)
+        {
+            Float4 r;
+            for (u32 i = 0; i < 4; ++i) r.V[i] = fn(a.V[i], b.V[i]);
+            return r;
+        }
+
+        template<typename Fn>
+        inline Float4 MapBits(Float4 a, Float4 b, Fn fn)
+        {
+            return Map(a, b, [&](float x, float y) { return FromBits(fn(ToBits(x), ToBits(y))); });
+        }
+    }
+
+    inline Float4 Load(const float* p) { Float4 r; std::memcpy(r.V, p, sizeof(r.V)); return r; }
+    inline void Store(float* p, Float4 a) { std::memcpy(p, a.V, sizeof(a.V)); }
+    inline Float4 Splat(float s) { return { { s, s, s, s } }; }
+
+    inline Float4 operator+(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x + y; }); }
+    inline Float4 operator-(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x - y; }); }
+    inline Float4 operator*(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x * y; }); }
+    inline Float4 operator/(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x / y; }); }
+
+    // Same operand order as minps/maxps: the second operand wins ties and NaN
+    inline Float4 Min(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x < y ? x : y; }); }
+    inline Float4 Max(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return x > y ? x : y; }); }
+    inline Float4 Sqrt(Float4 a) { return Detail::Map(a, a, [](float x, float) { return std::sqrt(x); }); }
+
+    inline Float4 CmpLt(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return Detail::Mask(x < y); }); }
+    inline Float4 CmpLe(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return Detail::Mask(x <= y); }); }
+    inline Float4 CmpEq(Float4 a, Float4 b) { return Detail::Map(a, b, [](float x, float y) { return Detail::Mask(x == y); }); }
+
+    inline Float4 And(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](u32 x, u32 y) { return x & y; }); }
+    inline Float4 AndNot(Float4 mask, Float4 a) { return Detail::MapBits(mask, a, [](u32 x, u32 y) { return ~x & y; }); }
+    inline Float4 Or(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](u32 x, u32 y) { return x | y; }); }
+    inline Float4 Xor(Float4 a, Float4 b) { return Detail::MapBits(a, b, [](u32 x, u32 y) { return x ^ y; }); }
+
+    inline Float4 Select(Float4 mask, Float4 a, Float4 b) { return Or(And(mask, a), AndNot(mask, b)); }
+
+    inline u32 MoveMask(Float4 mask)
+    {
+        u32 bits = 0;
+        for (u32 i = 0; i < 4; ++i) bits |= (Detail::ToBits(mask.V[i]) >> 31) << i;
+        return bits;
+    }
+
+    inline Float4 Truncate(Float4 a) { return Detail::Map(a, a, [](float x, float) { return static_cast<float>(static_cast<i32>(x)); }); }
+
+    inline Float4 TestBit(Float4 integral, int bit)
+    {
+        return Detail::Map(integral, integral, [bit](float x, float) { return Detail::Mask((static_cast<i32>(x) >> bit) & 1); });
+    }
+#endif
+
+    inline Float4 Abs(Float4 a) { return AndNot(Splat(-0.0f), a); }
+
+    //=========================================================================
+    // Bit sets
+    //=========================================================================
+
+    /// dst[i] |= src[i], two words per step on SSE2
+    inline void OrWords(u64* dst, const u64* src, u32 count)
+    {
+        u32 i = 0;
+#if RS_SIMD_SSE2
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_or_si128(a, b));
+        }
+#endif
+        for (; i < count; ++i) dst[i] |= src[i];
+    }
+
+    //=========================================================================
+    // Trigonometry
+    //=========================================================================
+
+    /// Sine and cosine of four angles at once (Cephes single precision
+    /// polynomials, about 1 ulp for |x| < 8192)
+    inline void SinCos(Float4 x, Float4& outSin, Float4& outCos)
+    {
+        const Float4 signBit = Splat(-0.0f);
+        const Float4 sinSign = And(x, signBit);
+        x = Abs(x);
+
+        // Octant, rounded up to even so the remainder is in [-pi/4, pi/4]
+        Float4 octant = Truncate(x * Splat(1.27323954473516f));
+        octant = octant + And(TestBit(octant, 0), Splat(1.0f));
+
+        x = x - octant * Splat(0.78515625f);
+        x = x - octant * Splat(2.4187564849853515625e-4f);
+        x = x - octant * Splat(3.77489497744594108e-8f);
+
+        const Float4 z = x * x;
+
+        Float4 cosPoly = Splat(2.443315711809948e-5f);
+        cosPoly = cosPoly * z + Splat(-1.388731625493765e-3f);
+        cosPoly = cosPoly * z + Splat(4.166664568298827e-2f);
+        cosPoly = cosPoly * z * z - Splat(0.5f) * z + Splat(1.0f);
+
+        Float4 sinPoly = Splat(-1.9515295891e-4f);
+        sinPoly = sinPoly * z + Splat(8.3321608736e-3f);
+        sinPoly = sinPoly * z + Splat(-1.6666654611e-1f);
+        sinPoly = sinPoly * z * x + x;
+
+        // Octants 2, 3, 6, 7 swap the polynomials; 4-7 flip the sine, 2-5 the cosine
+        const Float4 swap = TestBit(octant, 1);
+        const Float4 sinFlip = And(TestBit(octant, 2), signBit);
+        const Float4 cosFlip = And(Xor(TestBit(octant, 1), TestBit(octant, 2)), signBit);
+
+        outSin = Xor(Xor(Select(swap, cosPoly, sinPoly), sinFlip), sinSign);
+        outCos = Xor(Select(swap, sinPoly, cosPoly), cosFlip);
+    }
+}
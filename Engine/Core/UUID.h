@@ -3,97 +3,199 @@
 #include <Core/Types.h>
 #include <random>
 #include <string>
-#include <sstream>
-#include <iomanip>
+#include <string_view>
+#include <thread>
+#include <chrono>
 
 namespace RiftSpire
 {
+    //=========================================================================
+    // UUIDGenerator - Per-thread random source for UUID::Generate
+    //=========================================================================
+
+    /// xoshiro256** seeded once per thread; no locking, no shared state.
+    class UUIDGenerator
+    {
+    public:
+        static UUIDGenerator& ThreadLocal()
+        {
+            thread_local UUIDGenerator generator;
+            return generator;
+        }
+
+        u64 Next()
+        {
+            const u64 result = RotateLeft(m_State[1] * 5, 7) * 9;
+            const u64 t = m_State[1] << 17;
+
+            m_State[2] ^= m_State[0];
+            m_State[3] ^= m_State[1];
+            m_State[1] ^= m_State[2];
+            m_State[0] ^= m_State[3];
+            m_State[2] ^= t;
+            m_State[3] = RotateLeft(m_State[3], 45);
+
+            return result;
+        }
+
+    private:
+        UUIDGenerator()
+        {
+            // random_device is only touched once per thread; mix in the thread
+            // and clock so threads never share a sequence even if it is weak
+            std::random_device rd;
+            u64 seed = (static_cast<u64>(rd()) << 32) ^ rd();
+            seed ^= std::hash<std::thread::id>()(std::this_thread::get_id()) * 0x9E3779B97F4A7C15ULL;
+            seed ^= static_cast<u64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+            for (u64& word : m_State)
+            {
+                word = SplitMix64(seed);
+            }
+        }
+
+        static u64 RotateLeft(u64 x, int k) { return (x << k) | (x >> (64 - k)); }
+
+        static u64 SplitMix64(u64& state)
+        {
+            u64 z = (state += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        u64 m_State[4];
+    };
+
     //=========================================================================
     // UUID - Universally Unique Identifier for blocks
     //=========================================================================
-    
+
     class UUID
     {
     public:
+        /// Length of the canonical text form (xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx)
+        static constexpr size_t StringLength = 36;
+
         UUID() : m_High(0), m_Low(0) {}
         UUID(u64 high, u64 low) : m_High(high), m_Low(low) {}
-        
-        // Generate a new random UUID
+
+        // Generate a new random UUID (thread-safe)
         static UUID Generate()
         {
-            static std::random_device rd;
-            static std::mt19937_64 gen(rd());
-            static std::uniform_int_distribution<u64> dis;
-            
-            u64 high = dis(gen);
-            u64 low = dis(gen);
-            
+            UUIDGenerator& gen = UUIDGenerator::ThreadLocal();
+            u64 high = gen.Next();
+            u64 low = gen.Next();
+
             // Set version to 4 (random) and variant to RFC 4122
             high = (high & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;  // Version 4
             low = (low & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;   // Variant RFC 4122
-            
+
             return UUID(high, low);
         }
-        
-        // Parse from string (xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx)
-        static UUID FromString(const std::string& str)
+
+        // Parse from string (xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx), invalid UUID on error
+        static UUID FromString(std::string_view str)
+        {
+            UUID result;
+            TryParse(str, result);
+            return result;
+        }
+
+        /// Parse without allocating; upper and lower case hex are accepted
+        static bool TryParse(std::string_view str, UUID& out)
         {
-            if (str.length() != 36) return UUID();
-            
-            std::string cleaned;
-            for (char c : str)
+            if (str.size() != StringLength) return false;
+
+            u64 words[2] = { 0, 0 };
+            size_t digits = 0;
+
+            for (size_t i = 0; i < StringLength; ++i)
             {
-                if (c != '-') cleaned += c;
+                const char c = str[i];
+                if (i == 8 || i == 13 || i == 18 || i == 23)
+                {
+                    if (c != '-') return false;
+                    continue;
+                }
+
+                const int nibble = HexValue(c);
+                if (nibble < 0) return false;
+
+                u64& word = words[digits / 16];
+                word = (word << 4) | static_cast<u64>(nibble);
+                digits++;
             }
-            
-            if (cleaned.length() != 32) return UUID();
-            
-            u64 high = std::stoull(cleaned.substr(0, 16), nullptr, 16);
-            u64 low = std::stoull(cleaned.substr(16, 16), nullptr, 16);
-            
-            return UUID(high, low);
+
+            out = UUID(words[0], words[1]);
+            return true;
         }
-        
+
+        /// Write the canonical text form into out[0..StringLength), no terminator
+        void ToChars(char* out) const
+        {
+            static constexpr char Digits[] = "0123456789abcdef";
+
+            size_t pos = 0;
+            for (int nibble = 0; nibble < 32; ++nibble)
+            {
+                if (nibble == 8 || nibble == 12 || nibble == 16 || nibble == 20)
+                {
+                    out[pos++] = '-';
+                }
+
+                const u64 word = nibble < 16 ? m_High : m_Low;
+                const int shift = 60 - (nibble % 16) * 4;
+                out[pos++] = Digits[(word >> shift) & 0xF];
+            }
+        }
+
         // Convert to string
         std::string ToString() const
         {
-            std::ostringstream ss;
-            ss << std::hex << std::setfill('0');
-            
-            // xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx
-            ss << std::setw(8) << ((m_High >> 32) & 0xFFFFFFFF) << "-";
-            ss << std::setw(4) << ((m_High >> 16) & 0xFFFF) << "-";
-            ss << std::setw(4) << (m_High & 0xFFFF) << "-";
-            ss << std::setw(4) << ((m_Low >> 48) & 0xFFFF) << "-";
-            ss << std::setw(12) << (m_Low & 0xFFFFFFFFFFFFULL);
-            
-            return ss.str();
+            std::string result(StringLength, '\0');
+            ToChars(result.data());
+            return result;
         }
-        
+
         // Operators
         bool operator==(const UUID& other) const { return m_High == other.m_High && m_Low == other.m_Low; }
         bool operator!=(const UUID& other) const { return !(*this == other); }
+
+        /// Orders by the 128-bit value, which matches ordering by ToString()
         bool operator<(const UUID& other) const
         {
             if (m_High != other.m_High) return m_High < other.m_High;
             return m_Low < other.m_Low;
         }
-        
+
         // Validity check
         bool IsValid() const { return m_High != 0 || m_Low != 0; }
         operator bool() const { return IsValid(); }
-        
+
         // Raw access (for serialization)
         u64 GetHigh() const { return m_High; }
         u64 GetLow() const { return m_Low; }
-        
+
         // Hash support
         size_t Hash() const
         {
-            return std::hash<u64>()(m_High) ^ (std::hash<u64>()(m_Low) << 1);
+            // Generated ids are random, but hashed ids may come from files;
+            // fold and mix so both halves reach the low bits
+            u64 x = m_High ^ (m_Low * 0x9E3779B97F4A7C15ULL);
+            x ^= x >> 32;
+            return static_cast<size_t>(x);
         }
-        
+
     private:
+        static int HexValue(char c)
+        {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
         u64 m_High;
         u64 m_Low;
     };
@@ -111,4 +213,3 @@ namespace std
         }
     };
 }
-
@@ -3,7 +3,10 @@
 #include "../Core/Types.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <entt/entt.hpp>
 #include <string>
+#include <vector>
 
 namespace RiftSpire
 {
@@ -34,6 +37,44 @@ namespace RiftSpire
         }
     };
 
+    /// Optional: replaces TransformComponent::Rotation (Euler angles) with a
+    /// quaternion when building the world matrix
+    struct OrientationComponent
+    {
+        glm::quat Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    };
+
+    /// World matrix cached by TransformSystem. It is rebuilt only when the
+    /// transform it was built from changes (fields are compared, so direct
+    /// writes are picked up) or when Dirty is set.
+    struct WorldTransformComponent
+    {
+        glm::mat4 Matrix = glm::mat4(1.0f);
+        bool Dirty = true;
+
+        // Inputs of the last rebuild
+        struct Source
+        {
+            glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+            glm::vec4 Rotation = { 0.0f, 0.0f, 0.0f, 0.0f };    // Euler xyz, or quaternion xyzw
+            glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
+            bool FromOrientation = false;
+        } Built;
+    };
+
+    /// Places the entity under a parent: its TransformComponent becomes
+    /// relative to the parent's world matrix. Reparent through
+    /// HierarchySystem::SetParent, which rejects cycles; an invalid parent
+    /// makes the entity a root.
+    struct HierarchyComponent
+    {
+        entt::entity Parent = entt::null;
+
+        // Written by TransformSystem, consumed by HierarchySystem
+        glm::mat4 Local = glm::mat4(1.0f);
+        bool LocalChanged = true;
+    };
+
     struct SpriteComponent
     {
         glm::vec4 Color = { 1.0f, 1.0f, 1.0f, 1.0f };
@@ -63,6 +104,52 @@ namespace RiftSpire
         bool IsMoving = false;
     };
 
+    /// Collision shape on the X/Z plane, centered on the transform. A
+    /// capsule is a segment of 2 * HalfLength along the entity's facing
+    /// (Rotation.y), swept by Radius; HalfLength 0 is a circle.
+    struct ColliderComponent
+    {
+        enum class Shape : u8 { Circle, Capsule };
+
+        Shape Type = Shape::Circle;
+        float Radius = 50.0f;
+        float HalfLength = 0.0f;
+    };
+
+    /// Zone that reports units entering and leaving it (brush, aura, base).
+    /// The shape is on the X/Z plane, relative to the transform and turned
+    /// by its Rotation.y. Occupants is kept sorted by AreaTriggerSystem.
+    struct AreaTriggerComponent
+    {
+        enum class Shape : u8 { Circle, Rectangle, Polygon };
+
+        std::string Name;                           // Matched by the area event blocks
+        Shape Type = Shape::Circle;
+        float Radius = 300.0f;
+        glm::vec2 HalfExtents = { 300.0f, 300.0f }; // Rectangle, local X and Z
+        std::vector<glm::vec2> Points;              // Polygon, local X/Z, either winding
+        u32 TeamMask = ~0u;                         // Bit per TeamId of units it tracks
+
+        std::vector<entt::entity> Occupants;
+    };
+
+    /// Pooled entity that shows a projectile simulated by ProjectileSystem.
+    /// It has no TransformComponent so queries, collisions and areas ignore
+    /// it; Active is false while it waits in the pool.
+    struct ProjectileComponent
+    {
+        glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 Direction = { 0.0f, 0.0f, 1.0f };
+        u32 Id = 0;
+        bool Active = false;
+    };
+
+    /// Reveals the fog of war around the entity for its TeamComponent team
+    struct VisionComponent
+    {
+        float Radius = 1200.0f;
+    };
+
     struct ChampionComponent
     {
         std::string ChampionName;
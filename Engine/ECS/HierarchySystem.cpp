@@ -0,0 +1,220 @@
+#include "HierarchySystem.h"
+#include "../Core/Logger.h"
+#include "../Core/SIMD.h"
+#include <algorithm>
+
+namespace RiftSpire
+{
+    using SIMD::Float4;
+
+    // out = a * b; out must not alias either input
+    static void Multiply(const glm::mat4& a, const glm::mat4& b, glm::mat4& out)
+    {
+        const Float4 a0 = SIMD::Load(&a[0].x);
+        const Float4 a1 = SIMD::Load(&a[1].x);
+        const Float4 a2 = SIMD::Load(&a[2].x);
+        const Float4 a3 = SIMD::Load(&a[3].x);
+
+        for (int column = 0; column < 4; ++column)
+        {
+            const glm::vec4& weights = b[column];
+            const Float4 result = a0 * SIMD::Splat(weights.x) + a1 * SIMD::Splat(weights.y) +
+                                  a2 * SIMD::Splat(weights.z) + a3 * SIMD::Splat(weights.w);
+            SIMD::Store(&out[column].x, result);
+        }
+    }
+
+    void HierarchySystem::Connect(entt::registry& registry)
+    {
+        registry.on_construct<HierarchyComponent>().connect<&HierarchySystem::OnNodeChanged>(*this);
+        registry.on_destroy<HierarchyComponent>().connect<&HierarchySystem::OnNodeChanged>(*this);
+        m_OrderDirty = true;
+    }
+
+    void HierarchySystem::Disconnect(entt::registry& registry)
+    {
+        registry.on_construct<HierarchyComponent>().disconnect<&HierarchySystem::OnNodeChanged>(*this);
+        registry.on_destroy<HierarchyComponent>().disconnect<&HierarchySystem::OnNodeChanged>(*this);
+    }
+
+    void HierarchySystem::OnNodeChanged(entt::registry& registry, entt::entity entity)
+    {
+        m_OrderDirty = true;
+
+        // The cached matrix switches between world and local meaning
+        if (auto* world = registry.try_get<WorldTransformComponent>(entity))
+        {
+            world->Dirty = true;
+        }
+    }
+
+    bool HierarchySystem::SetParent(entt::registry& registry, entt::entity child, entt::entity parent)
+    {
+        if (parent != entt::null)
+        {
+            // Walking up from the new parent must not reach the child. The
+            // step limit guards against cycles made by writing Parent directly.
+            size_t steps = registry.storage<HierarchyComponent>().size() + 1;
+            for (entt::entity ancestor = parent; ancestor != entt::null && steps-- > 0;)
+            {
+                if (ancestor == child) return false;
+
+                const HierarchyComponent* node = registry.try_get<HierarchyComponent>(ancestor);
+                ancestor = node && registry.valid(node->Parent) ? node->Parent : entt::null;
+            }
+
+            if (!registry.all_of<HierarchyComponent>(parent))
+            {
+                registry.emplace<HierarchyComponent>(parent);
+            }
+        }
+
+        if (HierarchyComponent* node = registry.try_get<HierarchyComponent>(child))
+        {
+            node->Parent = parent;
+        }
+        else
+        {
+            registry.emplace<HierarchyComponent>(child).Parent = parent;
+        }
+
+        m_OrderDirty = true;
+        return true;
+    }
+
+    void HierarchySystem::Rebuild(entt::registry& registry)
+    {
+        std::vector<entt::entity> nodes;
+        registry.view<HierarchyComponent>().each([&nodes](entt::entity entity, const HierarchyComponent&)
+        {
+            nodes.push_back(entity);
+        });
+        std::sort(nodes.begin(), nodes.end(), [](entt::entity a, entt::entity b)
+        {
+            return entt::to_entity(a) < entt::to_entity(b);
+        });
+
+        // Slot by entity index; the version is checked on lookup
+        const u32 count = static_cast<u32>(nodes.size());
+        std::vector<u32> slotOf(count == 0 ? 0 : entt::to_entity(nodes.back()) + 1, NoParent);
+        for (u32 slot = 0; slot < count; ++slot)
+        {
+            slotOf[entt::to_entity(nodes[slot])] = slot;
+        }
+
+        // Children of each slot, contiguous and in index order (counting sort)
+        std::vector<entt::entity> parents(count);
+        std::vector<u32> parentSlot(count, NoParent);
+        std::vector<u32> childBegin(count + 1, 0);
+        for (u32 slot = 0; slot < count; ++slot)
+        {
+            parents[slot] = registry.get<HierarchyComponent>(nodes[slot]).Parent;
+            if (parents[slot] == entt::null) continue;
+
+            const u32 index = entt::to_entity(parents[slot]);
+            if (index >= slotOf.size() || slotOf[index] == NoParent || nodes[slotOf[index]] != parents[slot]) continue;
+
+            parentSlot[slot] = slotOf[index];
+            childBegin[parentSlot[slot] + 1]++;
+        }
+        for (u32 slot = 0; slot < count; ++slot)
+        {
+            childBegin[slot + 1] += childBegin[slot];
+        }
+
+        std::vector<u32> children(childBegin[count]);
+        std::vector<u32> fill(childBegin.begin(), childBegin.end() - 1);
+        for (u32 slot = 0; slot < count; ++slot)
+        {
+            if (parentSlot[slot] != NoParent) children[fill[parentSlot[slot]]++] = slot;
+        }
+
+        // Depth-first, preorder
+        m_Entities.clear();
+        m_Parents.clear();
+        m_ParentIndex.clear();
+
+        std::vector<u32> orderOf(count, NoParent);
+        std::vector<u32> stack;
+        for (u32 root = 0; root < count; ++root)
+        {
+            if (parentSlot[root] != NoParent) continue;
+
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                const u32 slot = stack.back();
+                stack.pop_back();
+
+                orderOf[slot] = static_cast<u32>(m_Entities.size());
+                m_Entities.push_back(nodes[slot]);
+                m_Parents.push_back(parents[slot]);
+                m_ParentIndex.push_back(parentSlot[slot] == NoParent ? NoParent : orderOf[parentSlot[slot]]);
+
+                for (u32 i = childBegin[slot + 1]; i-- > childBegin[slot];)
+                {
+                    stack.push_back(children[i]);
+                }
+            }
+        }
+
+        if (m_Entities.size() != count)
+        {
+            RS_ENGINE_WARN("HierarchySystem: {0} entities form a parent cycle and are skipped", count - m_Entities.size());
+        }
+
+        m_World.resize(m_Entities.size());
+        m_Changed.resize(m_Entities.size());
+        m_OrderDirty = false;
+        m_ForceAll = true;
+    }
+
+    u32 HierarchySystem::Update(entt::registry& registry)
+    {
+        if (m_OrderDirty) Rebuild(registry);
+
+        auto& nodes = registry.storage<HierarchyComponent>();
+        auto& worlds = registry.storage<WorldTransformComponent>();
+
+        u32 updated = 0;
+        for (u32 i = 0; i < m_Entities.size(); ++i)
+        {
+            HierarchyComponent& node = nodes.get(m_Entities[i]);
+            if (node.Parent != m_Parents[i])
+            {
+                // Parent was written directly; start over in the new order
+                Rebuild(registry);
+                return Update(registry);
+            }
+
+            const u32 parent = m_ParentIndex[i];
+            const bool changed = m_ForceAll || node.LocalChanged || (parent != NoParent && m_Changed[parent]);
+            m_Changed[i] = changed;
+            if (!changed) continue;
+
+            if (parent == NoParent)
+            {
+                m_World[i] = node.Local;
+            }
+            else
+            {
+                Multiply(m_World[parent], node.Local, m_World[i]);
+            }
+            node.LocalChanged = false;
+
+            if (worlds.contains(m_Entities[i]))
+            {
+                worlds.get(m_Entities[i]).Matrix = m_World[i];
+            }
+            updated++;
+        }
+
+        m_ForceAll = false;
+        return updated;
+    }
+
+    SystemAccess HierarchySystem::GetAccess()
+    {
+        return SystemAccess().Write<HierarchyComponent, WorldTransformComponent>();
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "Components.h"
+#include "SystemScheduler.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // HierarchySystem - Parent/child world matrices in one linear pass
+    //=========================================================================
+
+    /// Keeps every HierarchyComponent entity in a dense depth-first array
+    /// (parents before children, siblings by entity index), so propagation is
+    /// a single forward pass that reads parent matrices by index. A node is
+    /// recomputed only when its local matrix or an ancestor changed. The
+    /// order is rebuilt only when nodes are added, removed or reparented.
+    class HierarchySystem
+    {
+    public:
+        /// Watch HierarchyComponent construction and destruction
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        /// Attach child under parent (entt::null detaches), adding
+        /// HierarchyComponent where missing. False if it would form a cycle.
+        bool SetParent(entt::registry& registry, entt::entity child, entt::entity parent);
+
+        /// Run after TransformSystem; returns how many world matrices changed
+        u32 Update(entt::registry& registry);
+
+        /// Nodes in propagation order
+        const std::vector<entt::entity>& GetOrder() const { return m_Entities; }
+
+        static SystemAccess GetAccess();
+
+    private:
+        static constexpr u32 NoParent = ~0u;
+
+        void OnNodeChanged(entt::registry& registry, entt::entity entity);
+        void Rebuild(entt::registry& registry);
+
+        std::vector<entt::entity> m_Entities;
+        std::vector<entt::entity> m_Parents;        // Parent at build time, to spot direct writes
+        std::vector<u32> m_ParentIndex;
+        std::vector<glm::mat4> m_World;
+        std::vector<u8> m_Changed;
+        bool m_OrderDirty = true;
+        bool m_ForceAll = true;
+    };
+}
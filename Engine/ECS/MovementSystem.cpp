@@ -0,0 +1,64 @@
+#include "MovementSystem.h"
+
+namespace RiftSpire
+{
+    void MovementSystem::ApplyOrders(entt::registry& registry)
+    {
+        m_Queue.Drain(m_Orders);
+
+        for (const MoveOrder& order : m_Orders)
+        {
+            const entt::entity entity = static_cast<entt::entity>(static_cast<entt::id_type>(order.Entity));
+            if (!registry.valid(entity)) continue;
+
+            MovementComponent* movement = registry.try_get<MovementComponent>(entity);
+            if (!movement) continue;
+
+            if (order.Stop)
+            {
+                movement->IsMoving = false;
+                movement->Velocity = { 0.0f, 0.0f, 0.0f };
+            }
+            else
+            {
+                movement->TargetPosition = { order.X, order.Y, order.Z };
+                movement->IsMoving = true;
+            }
+        }
+    }
+
+    u32 MovementSystem::Update(entt::registry& registry, float deltaTime)
+    {
+        ApplyOrders(registry);
+
+        // The step is a handful of flops per entity, so it is done in place:
+        // gathering into arrays for SIMD costs more than the math it saves
+        u32 moved = 0;
+        registry.view<TransformComponent, MovementComponent>().each(
+            [deltaTime, &moved](TransformComponent& transform, MovementComponent& movement)
+            {
+                if (!movement.IsMoving) return;
+                moved++;
+
+                const glm::vec3 offset = movement.TargetPosition - transform.Position;
+                const float distance = glm::length(offset);
+                if (distance <= movement.MoveSpeed * deltaTime)
+                {
+                    transform.Position = movement.TargetPosition;
+                    movement.Velocity = { 0.0f, 0.0f, 0.0f };
+                    movement.IsMoving = false;
+                    return;
+                }
+
+                movement.Velocity = offset * (movement.MoveSpeed / distance);
+                transform.Position += movement.Velocity * deltaTime;
+            });
+
+        return moved;
+    }
+
+    SystemAccess MovementSystem::GetAccess()
+    {
+        return SystemAccess().Write<TransformComponent, MovementComponent>();
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "Components.h"
+#include "SystemScheduler.h"
+#include "../Scripting/Blocks/MovementBlocks.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // MovementSystem - Steers MovementComponent entities to their targets
+    //=========================================================================
+
+    /// Applies queued script move orders in one batch, then steps every
+    /// entity with IsMoving set toward TargetPosition at MoveSpeed, in a
+    /// single pass over the view. An entity that would reach its target
+    /// this frame snaps to it and stops. Script entity handles are
+    /// entt::to_integral(entity).
+    class MovementSystem
+    {
+    public:
+        /// Returns how many entities moved
+        u32 Update(entt::registry& registry, float deltaTime);
+
+        /// Orders from this scene's scripts
+        MoveOrderQueue& GetOrderQueue() { return m_Queue; }
+
+        static SystemAccess GetAccess();
+
+    private:
+        void ApplyOrders(entt::registry& registry);
+
+        MoveOrderQueue m_Queue;
+        std::vector<MoveOrder> m_Orders;
+    };
+}
@@ -0,0 +1,116 @@
+#include "RegenSystem.h"
+#include <algorithm>
+
+namespace RiftSpire
+{
+    // Index of the band holding value; max is the only value in the top band
+    static i32 Band(float value, float max, float bands)
+    {
+        return static_cast<i32>(value * bands / max);
+    }
+
+    static float Step(float current, float max, float regen, float deltaTime)
+    {
+        return std::max(std::min(current + regen * deltaTime, max), 0.0f);
+    }
+
+    // Regen that still has room to act
+    static bool Regenerating(float current, float max, float regen)
+    {
+        return max > 0.0f && (regen > 0.0f ? current < max : regen < 0.0f && current > 0.0f);
+    }
+
+    //=========================================================================
+    // RegenSystem
+    //=========================================================================
+
+    void RegenSystem::ApplyOrders(entt::registry& registry)
+    {
+        m_Queue.Drain(m_Orders);
+
+        const float bands = static_cast<float>(m_Bands);
+        for (const HealthOrder& order : m_Orders)
+        {
+            const entt::entity entity = static_cast<entt::entity>(static_cast<entt::id_type>(order.Entity));
+            if (!registry.valid(entity)) continue;
+
+            switch (order.Type)
+            {
+            case HealthOrder::Kind::Heal:
+                if (HealthComponent* health = registry.try_get<HealthComponent>(entity))
+                {
+                    const float previous = health->CurrentHealth;
+                    health->CurrentHealth = std::clamp(previous + order.Amount, 0.0f, health->MaxHealth);
+                    if (health->MaxHealth > 0.0f && Band(previous, health->MaxHealth, bands) != Band(health->CurrentHealth, health->MaxHealth, bands))
+                    {
+                        Emit(entity, previous, health->CurrentHealth, health->MaxHealth);
+                    }
+                }
+                break;
+
+            case HealthOrder::Kind::SetHealthRegen:
+                if (HealthComponent* health = registry.try_get<HealthComponent>(entity)) health->HealthRegen = order.Amount;
+                break;
+
+            case HealthOrder::Kind::RestoreMana:
+                if (ManaComponent* mana = registry.try_get<ManaComponent>(entity))
+                {
+                    mana->CurrentMana = std::clamp(mana->CurrentMana + order.Amount, 0.0f, mana->MaxMana);
+                }
+                break;
+
+            case HealthOrder::Kind::SetManaRegen:
+                if (ManaComponent* mana = registry.try_get<ManaComponent>(entity)) mana->ManaRegen = order.Amount;
+                break;
+            }
+        }
+    }
+
+    void RegenSystem::Emit(entt::entity entity, float previous, float current, float max)
+    {
+        if (current > previous)
+        {
+            m_Events.push_back({ entity, EventType::HealReceived, previous, current, max });
+        }
+        m_Events.push_back({ entity, EventType::HealthChanged, previous, current, max });
+    }
+
+    u32 RegenSystem::Update(entt::registry& registry, float deltaTime)
+    {
+        m_Events.clear();
+        ApplyOrders(registry);
+
+        // A few flops per pool, so it is stepped in place: gathering the
+        // pools into arrays for SIMD costs more than the math it saves
+        const float bands = static_cast<float>(m_Bands);
+        u32 changed = 0;
+
+        registry.view<HealthComponent>().each([&](entt::entity entity, HealthComponent& health)
+        {
+            if (!Regenerating(health.CurrentHealth, health.MaxHealth, health.HealthRegen)) return;
+            changed++;
+
+            const float previous = health.CurrentHealth;
+            health.CurrentHealth = Step(previous, health.MaxHealth, health.HealthRegen, deltaTime);
+            if (Band(previous, health.MaxHealth, bands) != Band(health.CurrentHealth, health.MaxHealth, bands))
+            {
+                Emit(entity, previous, health.CurrentHealth, health.MaxHealth);
+            }
+        });
+
+        registry.view<ManaComponent>().each([&](ManaComponent& mana)
+        {
+            if (!Regenerating(mana.CurrentMana, mana.MaxMana, mana.ManaRegen)) return;
+            changed++;
+
+            mana.CurrentMana = Step(mana.CurrentMana, mana.MaxMana, mana.ManaRegen, deltaTime);
+        });
+
+        return changed;
+    }
+
+    SystemAccess RegenSystem::GetAccess()
+    {
+        return SystemAccess().Write<HealthComponent, ManaComponent>();
+    }
+}
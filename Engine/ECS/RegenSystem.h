@@ -0,0 +1,62 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "Components.h"
+#include "SystemScheduler.h"
+#include "../Scripting/Blocks/HealthBlocks.h"
+#include "../Scripting/Execution/EventSystem.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    /// Health crossed a band boundary this update. Previous is the value
+    /// before the update, so one event can cover several ticks of regen.
+    struct HealthEvent
+    {
+        entt::entity Entity = entt::null;
+        EventType Type = EventType::HealthChanged;
+        f32 Previous = 0.0f;
+        f32 Current = 0.0f;
+        f32 Max = 0.0f;
+    };
+
+    //=========================================================================
+    // RegenSystem - Health and mana regeneration
+    //=========================================================================
+
+    /// Applies queued script health orders, then steps every pool that is
+    /// not already full (or empty, for negative regen) and clamps it, in
+    /// place. Health is split into bands (quarters by default) and events
+    /// are only emitted when a unit moves into another band, so a unit
+    /// healing from empty to full raises a handful of events instead of one
+    /// per tick.
+    class RegenSystem
+    {
+    public:
+        /// Returns how many pools changed
+        u32 Update(entt::registry& registry, float deltaTime);
+
+        /// Number of equal health bands; the top band is "full"
+        void SetBandCount(u32 bands) { m_Bands = bands > 0 ? bands : 1; }
+        u32 GetBandCount() const { return m_Bands; }
+
+        /// HealReceived and HealthChanged events from the last update. The
+        /// scene queues them on the EventDispatcher (Amount = the change).
+        const std::vector<HealthEvent>& GetEvents() const { return m_Events; }
+
+        /// Orders from this scene's scripts
+        HealthOrderQueue& GetOrderQueue() { return m_Queue; }
+
+        static SystemAccess GetAccess();
+
+    private:
+        void ApplyOrders(entt::registry& registry);
+        void Emit(entt::entity entity, float previous, float current, float max);
+
+        HealthOrderQueue m_Queue;
+        std::vector<HealthOrder> m_Orders;
+        std::vector<HealthEvent> m_Events;
+        u32 m_Bands = 4;
+    };
+}
@@ -1,13 +1,72 @@
 #include "Scene.h"
 #include "Entity.h"
 #include "Components.h"
+#include "../Scripting/Execution/ExecutionContext.h"
 
 namespace RiftSpire
 {
+    Scene::Scene()
+    {
+        m_Hierarchy.Connect(m_Registry);
+        m_SpatialGrid.Connect(m_Registry);
+        m_Collisions.Connect(m_Registry);
+        m_AreaTriggers.Connect(m_Registry);
+
+        m_Systems.AddSystem("Movement", MovementSystem::GetAccess(), [this](SystemContext& context)
+        {
+            m_Movement.Update(context.Registry, context.DeltaTime);
+        });
+
+        m_Systems.AddSystem("Regen", RegenSystem::GetAccess(), [this](SystemContext& context)
+        {
+            m_Regen.Update(context.Registry, context.DeltaTime);
+        });
+
+        // Registered after every system that moves things
+        m_Systems.AddSystem("SpatialGrid", SpatialGrid::GetAccess(), [this](SystemContext& context)
+        {
+            m_SpatialGrid.Update(context.Registry);
+        });
+
+        m_Systems.AddSystem("Collision", CollisionSystem::GetAccess(), [this](SystemContext& context)
+        {
+            m_Collisions.Update(context.Registry);
+        });
+
+        m_Systems.AddSystem("AreaTriggers", AreaTriggerSystem::GetAccess(), [this](SystemContext& context)
+        {
+            m_AreaTriggers.Update(context.Registry, m_SpatialGrid);
+        });
+
+        m_Systems.AddSystem("Projectiles", ProjectileSystem::GetAccess(), [this](SystemContext& context)
+        {
+            m_Projectiles.Update(context.Registry, m_SpatialGrid, context.DeltaTime);
+        });
+
+        m_Systems.AddSystem("Vision", VisionSystem::GetAccess(), [this](SystemContext& context)
+        {
+            m_Vision.Update(context.Registry);
+        });
+
+        m_Systems.AddSystem("Paths", PathService::GetAccess(), [this](SystemContext&)
+        {
+            m_Paths.Update();
+        });
+    }
+
+    Scene::~Scene()
+    {
+        m_AreaTriggers.Disconnect(m_Registry);
+        m_Collisions.Disconnect(m_Registry);
+        m_SpatialGrid.Disconnect(m_Registry);
+        m_Hierarchy.Disconnect(m_Registry);
+    }
+
     Entity Scene::CreateEntity(const std::string& name)
     {
         Entity entity = { m_Registry.create(), this };
         entity.AddComponent<TransformComponent>();
+        entity.AddComponent<WorldTransformComponent>();
         auto& tag = entity.AddComponent<TagComponent>();
         tag.Tag = name.empty() ? "Entity" : name;
         return entity;
@@ -20,7 +79,74 @@ namespace RiftSpire
 
     void Scene::OnUpdate(float deltaTime)
     {
-        // Update systems here
+        m_Systems.Run(m_Registry, deltaTime);
+        m_Time += deltaTime;
+        QueueEvents();
+
+        // After every system has moved things, so rendering sees this frame
+        m_Transforms.Update(m_Registry);
+        m_Hierarchy.Update(m_Registry);
+
+        // Handlers run last, on this thread, and see this frame's transforms
+        EventDispatcher::Get().ProcessQueue();
+    }
+
+    void Scene::QueueEvents()
+    {
+        for (const HealthEvent& event : m_Regen.GetEvents())
+        {
+            EventData data(event.Type);
+            data.Amount = event.Current - event.Previous;
+            QueueEvent(data, event.Entity);
+        }
+
+        for (const CollisionEvent& event : m_Collisions.GetEvents())
+        {
+            static constexpr EventType Types[] = { EventType::CollisionBegin, EventType::CollisionStay, EventType::CollisionEnd };
+            EventData data(Types[static_cast<u8>(event.Type)]);
+            data.SourceEntity = entt::to_integral(event.A);
+            QueueEvent(data, event.B);
+        }
+
+        for (const AreaEvent& event : m_AreaTriggers.GetEvents())
+        {
+            EventData data(event.Type == AreaEvent::Phase::Enter ? EventType::AreaEnter : EventType::AreaLeave);
+            data.SourceEntity = entt::to_integral(event.Area);
+            QueueEvent(data, event.Entity);
+        }
+
+        for (const ProjectileEvent& event : m_Projectiles.GetEvents())
+        {
+            EventData data(event.Type);
+            data.InstanceId = event.Projectile;     // Hit list stays readable until the next update
+            if (event.Owner != entt::null) data.SourceEntity = entt::to_integral(event.Owner);
+            if (event.Target != entt::null) data.TargetEntity = entt::to_integral(event.Target);
+
+            // Where the projectile struck or expired, not where the target stands
+            data.Position = event.Position;
+            data.Timestamp = m_Time;
+            EventDispatcher::Get().QueueEvent(data);
+        }
+    }
+
+    void Scene::QueueEvent(EventData& data, entt::entity target)
+    {
+        data.TargetEntity = entt::to_integral(target);
+        data.Timestamp = m_Time;
+        // The entity may have been destroyed since the event was raised
+        const TransformComponent* transform = m_Registry.valid(target) ? m_Registry.try_get<TransformComponent>(target) : nullptr;
+        if (transform)
+        {
+            data.Position = transform->Position;
+        }
+        EventDispatcher::Get().QueueEvent(data);
+    }
+
+    void Scene::BindScriptContext(ExecutionContext& context)
+    {
+        context.SetScene(this);
+        context.SetMoveOrders(&m_Movement.GetOrderQueue());
+        context.SetHealthOrders(&m_Regen.GetOrderQueue());
     }
 
     void Scene::OnRender()
@@ -1,17 +1,32 @@
 #pragma once
 
 #include "../Core/Types.h"
+#include "SystemScheduler.h"
+#include "TransformSystem.h"
+#include "HierarchySystem.h"
+#include "MovementSystem.h"
+#include "RegenSystem.h"
+#include "VisionSystem.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Physics/CollisionSystem.h"
+#include "../Physics/AreaTriggerSystem.h"
+#include "../Physics/ProjectileSystem.h"
+#include "../Navigation/FlowField.h"
+#include "../Navigation/NavGrid.h"
+#include "../Navigation/PathService.h"
+#include "../Scripting/Execution/EventSystem.h"
 #include <entt/entt.hpp>
 
 namespace RiftSpire
 {
     class Entity;
+    class ExecutionContext;
 
     class Scene
     {
     public:
-        Scene() = default;
-        ~Scene() = default;
+        Scene();
+        ~Scene();
 
         Entity CreateEntity(const std::string& name = "Entity");
         void DestroyEntity(Entity entity);
@@ -19,10 +34,43 @@ namespace RiftSpire
         void OnUpdate(float deltaTime);
         void OnRender();
 
+        /// Point a script's context at this scene and its order queues
+        void BindScriptContext(ExecutionContext& context);
+
         entt::registry& GetRegistry() { return m_Registry; }
+        SystemScheduler& GetSystems() { return m_Systems; }
+        HierarchySystem& GetHierarchy() { return m_Hierarchy; }
+        MovementSystem& GetMovement() { return m_Movement; }
+        RegenSystem& GetRegen() { return m_Regen; }
+        SpatialGrid& GetSpatialGrid() { return m_SpatialGrid; }
+        CollisionSystem& GetCollisions() { return m_Collisions; }
+        AreaTriggerSystem& GetAreaTriggers() { return m_AreaTriggers; }
+        ProjectileSystem& GetProjectiles() { return m_Projectiles; }
+        VisionSystem& GetVision() { return m_Vision; }
+        NavGrid& GetNavGrid() { return m_NavGrid; }
+        PathService& GetPaths() { return m_Paths; }
+        FlowFieldCache& GetFlowFields() { return m_FlowFields; }
 
     private:
+        /// Hand this update's system events to the EventDispatcher queue
+        void QueueEvents();
+        void QueueEvent(EventData& data, entt::entity target);
+
         entt::registry m_Registry;
+        SystemScheduler m_Systems;
+        MovementSystem m_Movement;
+        RegenSystem m_Regen;
+        SpatialGrid m_SpatialGrid;
+        CollisionSystem m_Collisions;
+        AreaTriggerSystem m_AreaTriggers;
+        ProjectileSystem m_Projectiles;
+        VisionSystem m_Vision;
+        NavGrid m_NavGrid;
+        PathService m_Paths{ m_NavGrid };
+        FlowFieldCache m_FlowFields{ m_NavGrid };
+        TransformSystem m_Transforms;
+        HierarchySystem m_Hierarchy;
+        float m_Time = 0.0f;
         friend class Entity;
     };
 }
@@ -0,0 +1,228 @@
+#include "SystemScheduler.h"
+#include "../Core/JobPool.h"
+#include <algorithm>
+#include <chrono>
+
+namespace RiftSpire
+{
+    using Clock = std::chrono::steady_clock;
+
+    static double ElapsedMs(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    static bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b)
+    {
+        for (entt::id_type id : a)
+        {
+            if (std::find(b.begin(), b.end(), id) != b.end()) return true;
+        }
+        return false;
+    }
+
+    //=========================================================================
+    // SystemAccess
+    //=========================================================================
+
+    bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+    {
+        if (m_Exclusive || other.m_Exclusive) return true;
+
+        return Intersects(m_Writes, other.m_Writes) ||
+               Intersects(m_Writes, other.m_Reads) ||
+               Intersects(m_Reads, other.m_Writes);
+    }
+
+    void SystemAccess::PrepareStorage(entt::registry& registry) const
+    {
+        for (auto prepare : m_Prepare)
+        {
+            prepare(registry);
+        }
+    }
+
+    //=========================================================================
+    // CommandBuffer
+    //=========================================================================
+
+    void CommandBuffer::Create(std::function<void(entt::registry&, entt::entity)> setup)
+    {
+        m_Commands.push_back([setup = std::move(setup)](entt::registry& registry)
+        {
+            setup(registry, registry.create());
+        });
+    }
+
+    void CommandBuffer::Destroy(entt::entity entity)
+    {
+        m_Commands.push_back([entity](entt::registry& registry)
+        {
+            if (registry.valid(entity)) registry.destroy(entity);
+        });
+    }
+
+    void CommandBuffer::Flush(entt::registry& registry)
+    {
+        for (Command& command : m_Commands)
+        {
+            command(registry);
+        }
+        m_Commands.clear();
+    }
+
+    //=========================================================================
+    // SystemScheduler
+    //=========================================================================
+
+    SystemScheduler::SystemScheduler(JobPool* pool)
+        : m_Pool(pool)
+        , m_StageBegin{ 0 }
+    {
+    }
+
+    SystemScheduler::~SystemScheduler() = default;
+
+    SystemScheduler::SystemId SystemScheduler::AddSystem(std::string name, SystemAccess access, SystemFunction function)
+    {
+        System& system = m_Systems.emplace_back();
+        system.Access = std::move(access);
+        system.Function = std::move(function);
+        system.Stats.Name = std::move(name);
+        system.Stage = static_cast<u32>(m_StageBegin.size() - 1);
+
+        m_Dirty = true;
+        return static_cast<SystemId>(m_Systems.size() - 1);
+    }
+
+    void SystemScheduler::AddSyncPoint()
+    {
+        if (m_StageBegin.back() != m_Systems.size())
+        {
+            m_StageBegin.push_back(static_cast<SystemId>(m_Systems.size()));
+        }
+    }
+
+    void SystemScheduler::Build()
+    {
+        // Earlier conflicting system -> later one, within a stage. Systems are
+        // few, so the quadratic pass only matters when the set changes.
+        for (System& system : m_Systems)
+        {
+            system.DependencyCount = 0;
+            system.Dependents.clear();
+        }
+
+        for (SystemId later = 0; later < m_Systems.size(); ++later)
+        {
+            for (SystemId earlier = m_StageBegin[m_Systems[later].Stage]; earlier < later; ++earlier)
+            {
+                if (m_Systems[earlier].Access.ConflictsWith(m_Systems[later].Access))
+                {
+                    m_Systems[earlier].Dependents.push_back(later);
+                    m_Systems[later].DependencyCount++;
+                }
+            }
+        }
+
+        m_Remaining = std::make_unique<std::atomic<u32>[]>(m_Systems.size());
+        m_Dirty = false;
+    }
+
+    void SystemScheduler::Run(entt::registry& registry, float deltaTime)
+    {
+        const Clock::time_point frameStart = Clock::now();
+        if (m_Dirty) Build();
+
+        for (const System& system : m_Systems)
+        {
+            system.Access.PrepareStorage(registry);
+        }
+
+        for (u32 stage = 0; stage < m_StageBegin.size(); ++stage)
+        {
+            RunStage(stage, registry, deltaTime);
+            FlushStage(stage, registry);
+        }
+
+        m_LastFrameMs = ElapsedMs(frameStart);
+    }
+
+    void SystemScheduler::RunStage(u32 stage, entt::registry& registry, float deltaTime)
+    {
+        const SystemId begin = m_StageBegin[stage];
+        const SystemId end = stage + 1 < m_StageBegin.size() ? m_StageBegin[stage + 1] : static_cast<SystemId>(m_Systems.size());
+        if (begin == end) return;
+
+        if (m_SingleThreaded)
+        {
+            for (SystemId id = begin; id < end; ++id)
+            {
+                RunSystem(id, registry, deltaTime);
+            }
+            return;
+        }
+
+        if (!m_Pool) m_Pool = &JobPool::GetShared();
+
+        for (SystemId id = begin; id < end; ++id)
+        {
+            m_Remaining[id].store(m_Systems[id].DependencyCount, std::memory_order_relaxed);
+        }
+        m_Pending.store(end - begin, std::memory_order_release);
+
+        for (SystemId id = begin; id < end; ++id)
+        {
+            if (m_Systems[id].DependencyCount != 0) continue;
+            m_Pool->Submit([this, id, &registry, deltaTime]() { RunSystem(id, registry, deltaTime); });
+        }
+
+        m_Pool->Wait(m_Pending);
+    }
+
+    void SystemScheduler::RunSystem(SystemId id, entt::registry& registry, float deltaTime)
+    {
+        System& system = m_Systems[id];
+
+        const Clock::time_point start = Clock::now();
+        SystemContext context{ registry, system.Commands, deltaTime };
+        system.Function(context);
+        const double elapsed = ElapsedMs(start);
+
+        SystemStats& stats = system.Stats;
+        stats.LastMs = elapsed;
+        stats.AverageMs = stats.Runs == 0 ? elapsed : stats.AverageMs * 0.95 + elapsed * 0.05;
+        stats.MaxMs = std::max(stats.MaxMs, elapsed);
+        stats.Runs++;
+
+        if (m_SingleThreaded) return;
+
+        for (SystemId dependent : system.Dependents)
+        {
+            if (m_Remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                m_Pool->Submit([this, dependent, &registry, deltaTime]() { RunSystem(dependent, registry, deltaTime); });
+            }
+        }
+        m_Pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void SystemScheduler::FlushStage(u32 stage, entt::registry& registry)
+    {
+        for (System& system : m_Systems)
+        {
+            if (system.Stage == stage) system.Commands.Flush(registry);
+        }
+    }
+
+    void SystemScheduler::ResetStats()
+    {
+        for (System& system : m_Systems)
+        {
+            std::string name = std::move(system.Stats.Name);
+            system.Stats = SystemStats{};
+            system.Stats.Name = std::move(name);
+        }
+        m_LastFrameMs = 0.0;
+    }
+}
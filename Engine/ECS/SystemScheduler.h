@@ -0,0 +1,212 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include <entt/entt.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace RiftSpire
+{
+    class JobPool;
+
+    //=========================================================================
+    // SystemAccess - Components and resources a system reads and writes
+    //=========================================================================
+
+    /// Two systems conflict when one writes a component or resource the
+    /// other reads or writes; conflicting systems never run at the same time.
+    class SystemAccess
+    {
+    public:
+        template<typename... T>
+        SystemAccess& Read()
+        {
+            (Add<T>(m_Reads), ...);
+            return *this;
+        }
+
+        template<typename... T>
+        SystemAccess& Write()
+        {
+            (Add<T>(m_Writes), ...);
+            return *this;
+        }
+
+        /// State outside the registry (a system's own caches, a service).
+        /// Only recorded for conflict detection; no storage is created.
+        template<typename... T>
+        SystemAccess& Resource()
+        {
+            (m_Reads.push_back(entt::type_hash<T>::value()), ...);
+            return *this;
+        }
+
+        template<typename... T>
+        SystemAccess& WriteResource()
+        {
+            (m_Writes.push_back(entt::type_hash<T>::value()), ...);
+            return *this;
+        }
+
+        /// Touches anything (scripts, whole-registry passes): runs alone
+        SystemAccess& Exclusive()
+        {
+            m_Exclusive = true;
+            return *this;
+        }
+
+        bool ConflictsWith(const SystemAccess& other) const;
+
+        /// Create the storage of every declared component. Views create
+        /// missing storage, which must not happen on two threads at once.
+        void PrepareStorage(entt::registry& registry) const;
+
+    private:
+        template<typename T>
+        void Add(std::vector<entt::id_type>& ids)
+        {
+            ids.push_back(entt::type_hash<T>::value());
+            m_Prepare.push_back([](entt::registry& registry) { registry.storage<T>(); });
+        }
+
+        std::vector<entt::id_type> m_Reads;
+        std::vector<entt::id_type> m_Writes;
+        std::vector<void(*)(entt::registry&)> m_Prepare;
+        bool m_Exclusive = false;
+    };
+
+    //=========================================================================
+    // CommandBuffer - Structural changes deferred to a sync point
+    //=========================================================================
+
+    /// Systems running in parallel must not create or destroy entities or
+    /// add or remove components; they record them here instead. Commands on
+    /// an entity destroyed earlier in the same flush are dropped.
+    class CommandBuffer
+    {
+    public:
+        using Command = std::function<void(entt::registry&)>;
+
+        /// The entity is created at the sync point and passed to setup
+        void Create(std::function<void(entt::registry&, entt::entity)> setup);
+        void Destroy(entt::entity entity);
+
+        template<typename T, typename... Args>
+        void Emplace(entt::entity entity, Args&&... args)
+        {
+            m_Commands.push_back([entity, component = T{ std::forward<Args>(args)... }](entt::registry& registry) mutable
+            {
+                if (registry.valid(entity)) registry.emplace_or_replace<T>(entity, std::move(component));
+            });
+        }
+
+        template<typename T>
+        void Remove(entt::entity entity)
+        {
+            m_Commands.push_back([entity](entt::registry& registry)
+            {
+                if (registry.valid(entity)) registry.remove<T>(entity);
+            });
+        }
+
+        void Submit(Command command) { m_Commands.push_back(std::move(command)); }
+
+        /// Apply in recording order and clear
+        void Flush(entt::registry& registry);
+
+        bool IsEmpty() const { return m_Commands.empty(); }
+        size_t GetSize() const { return m_Commands.size(); }
+
+    private:
+        std::vector<Command> m_Commands;
+    };
+
+    //=========================================================================
+    // SystemScheduler - Runs systems in parallel by declared access
+    //=========================================================================
+
+    struct SystemContext
+    {
+        entt::registry& Registry;
+        CommandBuffer& Commands;
+        float DeltaTime;
+    };
+
+    using SystemFunction = std::function<void(SystemContext&)>;
+
+    struct SystemStats
+    {
+        std::string Name;
+        double LastMs = 0.0;
+        double AverageMs = 0.0;        // Exponential moving average
+        double MaxMs = 0.0;
+        u64 Runs = 0;
+    };
+
+    /// The result is the same as running the systems one by one in
+    /// registration order: a system waits for every earlier system it
+    /// conflicts with, and command buffers are flushed in registration order
+    /// at each sync point (and at the end of the frame). Systems between two
+    /// sync points form one stage; the dependency graph is rebuilt only when
+    /// systems are added.
+    class SystemScheduler
+    {
+    public:
+        using SystemId = u32;
+
+        /// Uses JobPool::GetShared() unless given a pool
+        explicit SystemScheduler(JobPool* pool = nullptr);
+        ~SystemScheduler();
+
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        SystemId AddSystem(std::string name, SystemAccess access, SystemFunction function);
+
+        /// Later systems start after every earlier one has finished and its
+        /// deferred commands are applied
+        void AddSyncPoint();
+
+        /// Run every system on the calling thread in registration order,
+        /// for debugging and reproducible runs
+        void SetSingleThreaded(bool singleThreaded) { m_SingleThreaded = singleThreaded; }
+        bool IsSingleThreaded() const { return m_SingleThreaded; }
+
+        void Run(entt::registry& registry, float deltaTime);
+
+        // Stats
+        const SystemStats& GetStats(SystemId id) const { return m_Systems[id].Stats; }
+        size_t GetSystemCount() const { return m_Systems.size(); }
+        double GetLastFrameMs() const { return m_LastFrameMs; }
+        void ResetStats();
+
+    private:
+        struct System
+        {
+            SystemAccess Access;
+            SystemFunction Function;
+            CommandBuffer Commands;
+            SystemStats Stats;
+            u32 Stage = 0;
+            u32 DependencyCount = 0;            // Earlier systems of the same stage it waits for
+            std::vector<SystemId> Dependents;
+        };
+
+        void Build();
+        void RunStage(u32 stage, entt::registry& registry, float deltaTime);
+        void RunSystem(SystemId id, entt::registry& registry, float deltaTime);
+        void FlushStage(u32 stage, entt::registry& registry);
+
+        JobPool* m_Pool;
+        std::vector<System> m_Systems;
+        std::vector<SystemId> m_StageBegin;        // First system of each stage
+        std::unique_ptr<std::atomic<u32>[]> m_Remaining;
+        std::atomic<u32> m_Pending{ 0 };
+        double m_LastFrameMs = 0.0;
+        bool m_SingleThreaded = false;
+        bool m_Dirty = true;
+    };
+}
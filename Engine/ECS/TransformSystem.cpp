@@ -0,0 +1,237 @@
+#include "TransformSystem.h"
+#include "../Core/SIMD.h"
+#include <algorithm>
+
+namespace RiftSpire
+{
+    using SIMD::Float4;
+    using Source = WorldTransformComponent::Source;
+
+    static constexpr u32 LaneCount = 10;
+
+    static bool SameSource(const Source& a, const Source& b)
+    {
+        return a.Position == b.Position && a.Rotation == b.Rotation &&
+               a.Scale == b.Scale && a.FromOrientation == b.FromOrientation;
+    }
+
+    // Upper 3x3 of translate * rotate(x) * rotate(y) * rotate(z) * scale,
+    // column-major like glm (out[col * 3 + row])
+    static void EulerBasis(const Float4* in, Float4* out)
+    {
+        Float4 sx, cx, sy, cy, sz, cz;
+        SIMD::SinCos(in[3], sx, cx);
+        SIMD::SinCos(in[4], sy, cy);
+        SIMD::SinCos(in[5], sz, cz);
+
+        const Float4 sxsy = sx * sy;
+        const Float4 cxsy = cx * sy;
+
+        out[0] = cy * cz * in[7];
+        out[1] = (sxsy * cz + cx * sz) * in[7];
+        out[2] = (sx * sz - cxsy * cz) * in[7];
+
+        out[3] = (SIMD::Splat(0.0f) - cy * sz) * in[8];
+        out[4] = (cx * cz - sxsy * sz) * in[8];
+        out[5] = (sx * cz + cxsy * sz) * in[8];
+
+        out[6] = sy * in[9];
+        out[7] = (SIMD::Splat(0.0f) - sx * cy) * in[9];
+        out[8] = cx * cy * in[9];
+    }
+
+    // Same layout from a quaternion (x, y, z, w in in[3..6]), as glm::mat4_cast
+    static void OrientationBasis(const Float4* in, Float4* out)
+    {
+        const Float4 one = SIMD::Splat(1.0f);
+        const Float4 two = SIMD::Splat(2.0f);
+        const Float4 x = in[3], y = in[4], z = in[5], w = in[6];
+
+        const Float4 xx = x * x, yy = y * y, zz = z * z;
+        const Float4 xy = x * y, xz = x * z, yz = y * z;
+        const Float4 wx = w * x, wy = w * y, wz = w * z;
+
+        out[0] = (one - two * (yy + zz)) * in[7];
+        out[1] = two * (xy + wz) * in[7];
+        out[2] = two * (xz - wy) * in[7];
+
+        out[3] = two * (xy - wz) * in[8];
+        out[4] = (one - two * (xx + zz)) * in[8];
+        out[5] = two * (yz + wx) * in[8];
+
+        out[6] = two * (xz + wy) * in[9];
+        out[7] = two * (yz - wx) * in[9];
+        out[8] = (one - two * (xx + yy)) * in[9];
+    }
+
+    static void WriteMatrix(glm::mat4& matrix, const float (&basis)[9][SIMD::Width], const float* position, u32 lane)
+    {
+        matrix[0] = glm::vec4(basis[0][lane], basis[1][lane], basis[2][lane], 0.0f);
+        matrix[1] = glm::vec4(basis[3][lane], basis[4][lane], basis[5][lane], 0.0f);
+        matrix[2] = glm::vec4(basis[6][lane], basis[7][lane], basis[8][lane], 0.0f);
+        matrix[3] = glm::vec4(position[0], position[1], position[2], 1.0f);
+    }
+
+    template<typename BasisFn>
+    static glm::mat4 ComposeOne(const Source& source, BasisFn basisFn)
+    {
+        const float values[LaneCount] = {
+            source.Position.x, source.Position.y, source.Position.z,
+            source.Rotation.x, source.Rotation.y, source.Rotation.z, source.Rotation.w,
+            source.Scale.x, source.Scale.y, source.Scale.z
+        };
+
+        Float4 in[LaneCount];
+        for (u32 i = 0; i < LaneCount; ++i) in[i] = SIMD::Splat(values[i]);
+
+        Float4 out[9];
+        basisFn(in, out);
+
+        float basis[9][SIMD::Width];
+        for (u32 i = 0; i < 9; ++i) SIMD::Store(basis[i], out[i]);
+
+        glm::mat4 matrix;
+        WriteMatrix(matrix, basis, values, 0);
+        return matrix;
+    }
+
+    static Source EulerSource(const TransformComponent& transform)
+    {
+        return { transform.Position, glm::vec4(transform.Rotation, 0.0f), transform.Scale, false };
+    }
+
+    static Source OrientationSource(const TransformComponent& transform, const glm::quat& orientation)
+    {
+        return { transform.Position, glm::vec4(orientation.x, orientation.y, orientation.z, orientation.w), transform.Scale, true };
+    }
+
+    //=========================================================================
+    // Batch
+    //=========================================================================
+
+    void TransformSystem::Batch::Reset(size_t capacity)
+    {
+        // Rounded up to the SIMD width; padding lanes are computed and dropped
+        const size_t padded = (capacity + SIMD::Width - 1) / SIMD::Width * SIMD::Width;
+        if (Targets.size() < padded)
+        {
+            for (std::vector<float>& lane : Lanes) lane.resize(padded, 0.0f);
+            Targets.resize(padded, nullptr);
+        }
+        Count = 0;
+    }
+
+    void TransformSystem::Batch::Push(const Source& source, glm::mat4* target)
+    {
+        Lanes[PositionX][Count] = source.Position.x;
+        Lanes[PositionY][Count] = source.Position.y;
+        Lanes[PositionZ][Count] = source.Position.z;
+        Lanes[RotationX][Count] = source.Rotation.x;
+        Lanes[RotationY][Count] = source.Rotation.y;
+        Lanes[RotationZ][Count] = source.Rotation.z;
+        Lanes[RotationW][Count] = source.Rotation.w;
+        Lanes[ScaleX][Count] = source.Scale.x;
+        Lanes[ScaleY][Count] = source.Scale.y;
+        Lanes[ScaleZ][Count] = source.Scale.z;
+        Targets[Count] = target;
+        Count++;
+    }
+
+    //=========================================================================
+    // TransformSystem
+    //=========================================================================
+
+    u32 TransformSystem::Update(entt::registry& registry)
+    {
+        // Every world transform could be out of date
+        const size_t capacity = registry.storage<WorldTransformComponent>().size();
+        m_Euler.Reset(capacity);
+        m_Orientation.Reset(capacity);
+
+        // Hierarchy nodes get their local matrix; HierarchySystem composes the world one
+        auto& nodes = registry.storage<HierarchyComponent>();
+        auto targetOf = [&nodes](entt::entity entity, WorldTransformComponent& world)
+        {
+            if (!nodes.contains(entity)) return &world.Matrix;
+
+            HierarchyComponent& node = nodes.get(entity);
+            node.LocalChanged = true;
+            return &node.Local;
+        };
+
+        registry.view<TransformComponent, WorldTransformComponent>(entt::exclude<OrientationComponent>).each(
+            [&](entt::entity entity, const TransformComponent& transform, WorldTransformComponent& world)
+            {
+                const Source source = EulerSource(transform);
+                if (!world.Dirty && SameSource(source, world.Built)) return;
+
+                world.Built = source;
+                world.Dirty = false;
+                m_Euler.Push(source, targetOf(entity, world));
+            });
+
+        registry.view<TransformComponent, OrientationComponent, WorldTransformComponent>().each(
+            [&](entt::entity entity, const TransformComponent& transform, const OrientationComponent& orientation, WorldTransformComponent& world)
+            {
+                const Source source = OrientationSource(transform, orientation.Rotation);
+                if (!world.Dirty && SameSource(source, world.Built)) return;
+
+                world.Built = source;
+                world.Dirty = false;
+                m_Orientation.Push(source, targetOf(entity, world));
+            });
+
+        BuildEuler(m_Euler);
+        BuildOrientation(m_Orientation);
+        return m_Euler.Count + m_Orientation.Count;
+    }
+
+    template<typename BasisFn>
+    static void BuildBatch(std::vector<float>* lanes, glm::mat4* const* targets, u32 count, BasisFn basisFn)
+    {
+        Float4 in[LaneCount];
+        Float4 out[9];
+        float basis[9][SIMD::Width];
+
+        for (u32 first = 0; first < count; first += SIMD::Width)
+        {
+            for (u32 i = 0; i < LaneCount; ++i) in[i] = SIMD::Load(lanes[i].data() + first);
+
+            basisFn(in, out);
+            for (u32 i = 0; i < 9; ++i) SIMD::Store(basis[i], out[i]);
+
+            const u32 end = std::min(count - first, SIMD::Width);
+            for (u32 lane = 0; lane < end; ++lane)
+            {
+                const u32 index = first + lane;
+                const float position[3] = { lanes[0][index], lanes[1][index], lanes[2][index] };
+                WriteMatrix(*targets[index], basis, position, lane);
+            }
+        }
+    }
+
+    void TransformSystem::BuildEuler(Batch& batch)
+    {
+        BuildBatch(batch.Lanes, batch.Targets.data(), batch.Count, EulerBasis);
+    }
+
+    void TransformSystem::BuildOrientation(Batch& batch)
+    {
+        BuildBatch(batch.Lanes, batch.Targets.data(), batch.Count, OrientationBasis);
+    }
+
+    SystemAccess TransformSystem::GetAccess()
+    {
+        return SystemAccess().Read<TransformComponent, OrientationComponent>().Write<WorldTransformComponent, HierarchyComponent>();
+    }
+
+    glm::mat4 TransformSystem::Compose(const TransformComponent& transform)
+    {
+        return ComposeOne(EulerSource(transform), EulerBasis);
+    }
+
+    glm::mat4 TransformSystem::Compose(const TransformComponent& transform, const glm::quat& orientation)
+    {
+        return ComposeOne(OrientationSource(transform, orientation), OrientationBasis);
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "Components.h"
+#include "SystemScheduler.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // TransformSystem - Keeps WorldTransformComponent up to date
+    //=========================================================================
+
+    /// Each update compares every cached source with its TransformComponent
+    /// (and OrientationComponent, if any), gathers the changed ones into
+    /// contiguous arrays and rebuilds their matrices four at a time. Static
+    /// entities cost one comparison per frame. Entities with a
+    /// HierarchyComponent get their local matrix instead (see
+    /// HierarchySystem).
+    class TransformSystem
+    {
+    public:
+        /// Rebuild out-of-date world matrices; returns how many were rebuilt
+        u32 Update(entt::registry& registry);
+
+        /// For registering Update() with a SystemScheduler
+        static SystemAccess GetAccess();
+
+        /// Single matrix, same result as the batched path
+        static glm::mat4 Compose(const TransformComponent& transform);
+        static glm::mat4 Compose(const TransformComponent& transform, const glm::quat& orientation);
+
+    private:
+        // Structure of arrays, padded to a multiple of the SIMD width
+        struct Batch
+        {
+            enum Lane { PositionX, PositionY, PositionZ, RotationX, RotationY, RotationZ, RotationW, ScaleX, ScaleY, ScaleZ, LaneCount };
+
+            std::vector<float> Lanes[LaneCount];
+            std::vector<glm::mat4*> Targets;
+            u32 Count = 0;
+
+            /// Grow to hold `capacity` entries and start empty; never shrinks
+            void Reset(size_t capacity);
+            void Push(const WorldTransformComponent::Source& source, glm::mat4* target);
+        };
+
+        static void BuildEuler(Batch& batch);
+        static void BuildOrientation(Batch& batch);
+
+        Batch m_Euler;
+        Batch m_Orientation;
+    };
+}
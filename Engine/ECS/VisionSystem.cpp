@@ -0,0 +1,235 @@
+#include "VisionSystem.h"
+#include "../Core/SIMD.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RiftSpire
+{
+    static constexpr u8 NoTeam = 0xFF;
+
+    // Octant transforms for shadowcasting: xx, xy, yx, yy
+    static constexpr i32 Octants[8][4] =
+    {
+        {  1,  0,  0,  1 }, {  0,  1,  1,  0 }, {  0, -1,  1,  0 }, { -1,  0,  0,  1 },
+        { -1,  0,  0, -1 }, {  0, -1, -1,  0 }, {  0,  1, -1,  0 }, {  1,  0,  0, -1 },
+    };
+
+    VisionSystem::VisionSystem(u32 width, u32 height, float tileSize, glm::vec2 origin)
+        : m_Width(width), m_Height(height), m_WordsPerRow((width + 63) / 64),
+          m_InverseTileSize(1.0f / tileSize), m_Origin(origin), m_Tiles(width * height, Tile::Open)
+    {
+        for (std::vector<u64>& bits : m_TeamBits) bits.assign(m_WordsPerRow * height, 0);
+    }
+
+    void VisionSystem::SetTile(u32 x, u32 y, Tile tile)
+    {
+        if (x >= m_Width || y >= m_Height || m_Tiles[y * m_Width + x] == tile) return;
+
+        m_Tiles[y * m_Width + x] = tile;
+        m_TilesChanged = true;
+    }
+
+    bool VisionSystem::Opaque(i32 x, i32 y, bool inBrush) const
+    {
+        if (x < 0 || y < 0 || x >= static_cast<i32>(m_Width) || y >= static_cast<i32>(m_Height)) return true;
+
+        const Tile tile = m_Tiles[y * m_Width + x];
+        return tile == Tile::Wall || (tile == Tile::Brush && !inBrush);
+    }
+
+    void VisionSystem::Light(Source& source, bool inBrush, i32 x, i32 y) const
+    {
+        if (x < 0 || y < 0 || x >= static_cast<i32>(m_Width) || y >= static_cast<i32>(m_Height)) return;
+        if (!inBrush && m_Tiles[y * m_Width + x] == Tile::Brush) return;
+
+        const i32 word = (y - source.RowMin) * source.Span + (x >> 6) - source.WordMin;
+        source.Bits[word] |= 1ull << (x & 63);
+    }
+
+    // Recursive shadowcasting over one octant: rows j away from the source,
+    // between the slopes start and end (Bergstrom)
+    void VisionSystem::CastOctant(Source& source, bool inBrush, i32 row, float start, float end, i32 xx, i32 xy, i32 yx, i32 yy) const
+    {
+        if (start < end) return;
+
+        const i32 radius = static_cast<i32>(source.Radius);
+        const float radiusSq = source.Radius * source.Radius;
+        float nextStart = start;
+
+        for (i32 j = row; j <= radius; ++j)
+        {
+            const i32 dy = -j;
+            bool blocked = false;
+
+            for (i32 dx = -j; dx <= 0; ++dx)
+            {
+                const i32 x = source.TileX + dx * xx + dy * xy;
+                const i32 y = source.TileY + dx * yx + dy * yy;
+                const float left = (dx - 0.5f) / (dy + 0.5f);
+                const float right = (dx + 0.5f) / (dy - 0.5f);
+
+                if (start < right) continue;
+                if (end > left) break;
+
+                if (static_cast<float>(dx * dx + dy * dy) <= radiusSq) Light(source, inBrush, x, y);
+
+                const bool opaque = Opaque(x, y, inBrush);
+                if (blocked)
+                {
+                    if (opaque)
+                    {
+                        nextStart = right;
+                        continue;
+                    }
+                    blocked = false;
+                    start = nextStart;
+                }
+                else if (opaque && j < radius)
+                {
+                    blocked = true;
+                    CastOctant(source, inBrush, j + 1, start, left, xx, xy, yx, yy);
+                    nextStart = right;
+                }
+            }
+
+            if (blocked) break;
+        }
+    }
+
+    void VisionSystem::Cast(Source& source) const
+    {
+        const i32 radius = static_cast<i32>(source.Radius);
+        const i32 rowMax = std::min(source.TileY + radius, static_cast<i32>(m_Height) - 1);
+        const i32 columnMin = std::max(source.TileX - radius, 0);
+        const i32 columnMax = std::min(source.TileX + radius, static_cast<i32>(m_Width) - 1);
+
+        source.RowMin = std::max(source.TileY - radius, 0);
+        source.Rows = rowMax - source.RowMin + 1;
+        source.WordMin = columnMin >> 6;
+        source.Span = (columnMax >> 6) - source.WordMin + 1;
+        source.Bits.assign(static_cast<size_t>(source.Rows) * source.Span, 0);
+
+        const bool inBrush = m_Tiles[source.TileY * m_Width + source.TileX] == Tile::Brush;
+        Light(source, true, source.TileX, source.TileY);
+
+        for (const auto& octant : Octants)
+        {
+            CastOctant(source, inBrush, 1, 1.0f, 0.0f, octant[0], octant[1], octant[2], octant[3]);
+        }
+    }
+
+    void VisionSystem::Rebuild(u8 team)
+    {
+        std::vector<u64>& bits = m_TeamBits[team];
+        std::fill(bits.begin(), bits.end(), 0);
+
+        for (const Source& source : m_Sources)
+        {
+            if (source.Team != team) continue;
+
+            for (i32 row = 0; row < source.Rows; ++row)
+            {
+                SIMD::OrWords(&bits[(source.RowMin + row) * m_WordsPerRow + source.WordMin], &source.Bits[row * source.Span], source.Span);
+            }
+        }
+    }
+
+    u32 VisionSystem::Update(entt::registry& registry)
+    {
+        auto& teams = registry.storage<TeamComponent>();
+        auto& visions = registry.storage<VisionComponent>();
+
+        m_Pass++;
+        u32 recast = 0;
+
+        registry.view<TransformComponent>().each([&](entt::entity entity, const TransformComponent& transform)
+        {
+            const i32 x = std::clamp(static_cast<i32>(std::floor((transform.Position.x - m_Origin.x) * m_InverseTileSize)), 0, static_cast<i32>(m_Width) - 1);
+            const i32 y = std::clamp(static_cast<i32>(std::floor((transform.Position.z - m_Origin.y) * m_InverseTileSize)), 0, static_cast<i32>(m_Height) - 1);
+            const u8 team = teams.contains(entity) ? teams.get(entity).TeamId : NoTeam;
+
+            const u32 index = entt::to_entity(entity);
+            if (index >= m_Located.size())
+            {
+                m_Located.resize(index + 1);
+                m_SourceOf.resize(index + 1, None);
+            }
+            m_Located[index] = { entity, static_cast<u32>(y) * m_Width + static_cast<u32>(x), team };
+
+            if (!visions.contains(entity) || team >= MaxTeams) return;
+
+            const float radius = visions.get(entity).Radius * m_InverseTileSize;
+
+            u32& slot = m_SourceOf[index];
+            const bool added = slot == None || m_Sources[slot].Entity != entity;
+            if (added)
+            {
+                slot = static_cast<u32>(m_Sources.size());
+                m_Sources.emplace_back().Entity = entity;
+            }
+
+            Source& source = m_Sources[slot];
+            source.Seen = m_Pass;
+
+            if (added || m_TilesChanged || source.TileX != x || source.TileY != y || source.Radius != radius || source.Team != team)
+            {
+                if (!added) m_DirtyTeams |= 1u << source.Team;
+                m_DirtyTeams |= 1u << team;
+
+                source.TileX = x;
+                source.TileY = y;
+                source.Radius = radius;
+                source.Team = team;
+                Cast(source);
+                recast++;
+            }
+        });
+
+        // Sources that lost their transform, vision or team
+        for (u32 i = static_cast<u32>(m_Sources.size()); i-- > 0;)
+        {
+            if (m_Sources[i].Seen == m_Pass) continue;
+
+            m_DirtyTeams |= 1u << m_Sources[i].Team;
+
+            const u32 index = entt::to_entity(m_Sources[i].Entity);
+            if (m_SourceOf[index] == i) m_SourceOf[index] = None;
+
+            if (i + 1 != m_Sources.size())
+            {
+                m_Sources[i] = std::move(m_Sources.back());
+                m_SourceOf[entt::to_entity(m_Sources[i].Entity)] = i;
+            }
+            m_Sources.pop_back();
+        }
+
+        m_TilesChanged = false;
+        for (u8 team = 0; team < MaxTeams; ++team)
+        {
+            if (m_DirtyTeams & (1u << team)) Rebuild(team);
+        }
+        m_DirtyTeams = 0;
+
+        return recast;
+    }
+
+    bool VisionSystem::IsTileVisible(u32 x, u32 y, u8 team) const
+    {
+        if (x >= m_Width || y >= m_Height || team >= MaxTeams) return false;
+        return (m_TeamBits[team][y * m_WordsPerRow + (x >> 6)] >> (x & 63)) & 1;
+    }
+
+    bool VisionSystem::IsVisibleToTeam(entt::entity entity, u8 team) const
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_Located.size() || m_Located[index].Entity != entity) return false;
+
+        const Located& located = m_Located[index];
+        return located.Team == team || IsTileVisible(located.Tile % m_Width, located.Tile / m_Width, team);
+    }
+
+    SystemAccess VisionSystem::GetAccess()
+    {
+        return SystemAccess().Read<TransformComponent, TeamComponent, VisionComponent>().WriteResource<VisionSystem>();
+    }
+}
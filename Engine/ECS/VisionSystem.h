@@ -0,0 +1,98 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "Components.h"
+#include "SystemScheduler.h"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // VisionSystem - Tile fog of war per team
+    //=========================================================================
+
+    /// The map is a grid of tiles over X/Z. Every VisionComponent entity
+    /// lights the tiles it can see (recursive shadowcasting within its
+    /// radius) into a cached bitset covering only its own square; each team
+    /// keeps one bit per tile, the OR of its sources. A source is cast again
+    /// only when it changes tile, radius or team, or when the occluders
+    /// change, and a team's bitset is rebuilt only when one of its sources
+    /// changed. Walls block sight and are lit. Brush blocks sight and stays
+    /// dark for sources outside brush; a source standing in brush sees
+    /// through it.
+    class VisionSystem
+    {
+    public:
+        enum class Tile : u8 { Open, Wall, Brush };
+
+        static constexpr u32 MaxTeams = 8;
+
+        explicit VisionSystem(u32 width = 256, u32 height = 256, float tileSize = 64.0f, glm::vec2 origin = { 0.0f, 0.0f });
+
+        /// Changing occluders recasts every source on the next update
+        void SetTile(u32 x, u32 y, Tile tile);
+        Tile GetTile(u32 x, u32 y) const { return m_Tiles[y * m_Width + x]; }
+
+        /// Returns how many sources were cast again
+        u32 Update(entt::registry& registry);
+
+        /// Allies are always visible; anything else only while its tile
+        /// (as of the last update) is lit for the team
+        bool IsVisibleToTeam(entt::entity entity, u8 team) const;
+        bool IsTileVisible(u32 x, u32 y, u8 team) const;
+
+        /// Row-major, GetWordsPerRow() words per row, bit x % 64 of word x / 64
+        const u64* GetTeamBits(u8 team) const { return m_TeamBits[team].data(); }
+        u32 GetWordsPerRow() const { return m_WordsPerRow; }
+
+        u32 GetWidth() const { return m_Width; }
+        u32 GetHeight() const { return m_Height; }
+
+        static SystemAccess GetAccess();
+
+    private:
+        static constexpr u32 None = ~0u;
+
+        struct Source
+        {
+            entt::entity Entity = entt::null;
+            i32 TileX = 0, TileY = 0;
+            float Radius = 0.0f;                    // In tiles
+            u8 Team = 0;
+            u32 Seen = 0;                           // Update that last found it
+
+            // Lit tiles of rows RowMin.. in words WordMin..WordMin + Span
+            i32 RowMin = 0, Rows = 0;
+            i32 WordMin = 0, Span = 0;
+            std::vector<u64> Bits;
+        };
+
+        struct Located
+        {
+            entt::entity Entity = entt::null;
+            u32 Tile = 0;
+            u8 Team = 0;
+        };
+
+        bool Opaque(i32 x, i32 y, bool inBrush) const;
+        void Cast(Source& source) const;
+        void CastOctant(Source& source, bool inBrush, i32 row, float start, float end, i32 xx, i32 xy, i32 yx, i32 yy) const;
+        void Light(Source& source, bool inBrush, i32 x, i32 y) const;
+        void Rebuild(u8 team);
+
+        u32 m_Width, m_Height, m_WordsPerRow;
+        float m_InverseTileSize;
+        glm::vec2 m_Origin;
+        std::vector<Tile> m_Tiles;
+        bool m_TilesChanged = false;
+
+        std::vector<Source> m_Sources;
+        std::vector<u32> m_SourceOf;                // By entity index
+        std::vector<Located> m_Located;             // By entity index
+        std::vector<u64> m_TeamBits[MaxTeams];
+        u32 m_DirtyTeams = 0;
+        u32 m_Pass = 0;
+    };
+}
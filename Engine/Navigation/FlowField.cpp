@@ -0,0 +1,198 @@
+#include "FlowField.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RiftSpire
+{
+    // Neighbour steps, same order as PathService; Opposite[i] undoes step i
+    static constexpr i32 StepX[8] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+    static constexpr i32 StepY[8] = { 0, 0, 1, -1, 1, 1, -1, -1 };
+    static constexpr u8 Opposite[8] = { 1, 0, 3, 2, 7, 6, 5, 4 };
+
+    static glm::vec2 Toward(glm::vec2 from, glm::vec2 to)
+    {
+        const glm::vec2 delta = to - from;
+        const float length = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+        return length > 0.0f ? delta / length : glm::vec2(0.0f);
+    }
+
+    //=========================================================================
+    // FlowField
+    //=========================================================================
+
+    glm::vec2 FlowField::Sample(glm::vec2 position) const
+    {
+        const glm::ivec2 cell = m_Grid->CellOf(position);
+        const u32 index = cell.y * m_Grid->GetWidth() + cell.x;
+
+        const u8 next = m_Next[index];
+        if (next != None)
+        {
+            return Toward(position, m_Grid->CenterOf({ cell.x + StepX[next], cell.y + StepY[next] }));
+        }
+        if (m_Cost[index] != Unreachable) return glm::vec2(0.0f);
+
+        // Pushed onto a blocked cell: back to the cheapest reachable neighbour.
+        // Only cells walkable at build time have a cost, so the live grid,
+        // which may be edited meanwhile, is never read.
+        const i32 width = static_cast<i32>(m_Grid->GetWidth()), height = static_cast<i32>(m_Grid->GetHeight());
+        u32 bestCost = Unreachable;
+        glm::ivec2 best = cell;
+        for (u32 step = 0; step < 8; ++step)
+        {
+            const glm::ivec2 neighbour = { cell.x + StepX[step], cell.y + StepY[step] };
+            if (neighbour.x < 0 || neighbour.y < 0 || neighbour.x >= width || neighbour.y >= height) continue;
+
+            const u32 cost = GetCost(neighbour);
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                best = neighbour;
+            }
+        }
+        return bestCost != Unreachable ? Toward(position, m_Grid->CenterOf(best)) : glm::vec2(0.0f);
+    }
+
+    bool FlowField::IsReachable(glm::vec2 position) const
+    {
+        return GetCost(m_Grid->CellOf(position)) != Unreachable;
+    }
+
+    //=========================================================================
+    // FlowFieldCache
+    //=========================================================================
+
+    FlowFieldCache::FlowFieldCache(const NavGrid& grid, u32 capacity)
+        : m_Grid(grid), m_Capacity(std::max(capacity, 1u))
+    {
+    }
+
+    std::shared_ptr<const FlowField> FlowFieldCache::Get(glm::vec2 destination)
+    {
+        glm::ivec2 cell = m_Grid.CellOf(destination);
+        m_Grid.NearestWalkable(cell);
+
+        Entry* entry = nullptr;
+        for (Entry& cached : m_Fields)
+        {
+            if (cached.Field->m_Destination == cell)
+            {
+                entry = &cached;
+                break;
+            }
+        }
+
+        if (!entry)
+        {
+            if (m_Fields.size() < m_Capacity)
+            {
+                entry = &m_Fields.emplace_back();
+                entry->Field = std::make_shared<FlowField>();
+                Build(*entry->Field, cell);
+            }
+            else
+            {
+                // Evict the least recently used destination
+                entry = &*std::min_element(m_Fields.begin(), m_Fields.end(), [](const Entry& a, const Entry& b) {
+                    return a.LastUsed < b.LastUsed;
+                });
+                Build(Reclaim(*entry), cell);
+            }
+        }
+        else if (entry->Field->m_Version != m_Grid.GetVersion())
+        {
+            Build(Reclaim(*entry), cell);
+        }
+
+        entry->LastUsed = ++m_Uses;
+        return entry->Field;
+    }
+
+    FlowField& FlowFieldCache::Reclaim(Entry& entry)
+    {
+        // A caller still samples it: leave it alone. Otherwise reuse its memory
+        if (entry.Field.use_count() > 1) entry.Field = std::make_shared<FlowField>();
+        return *entry.Field;
+    }
+
+    void FlowFieldCache::BuildSteps()
+    {
+        const i32 width = static_cast<i32>(m_Grid.GetWidth()), height = static_cast<i32>(m_Grid.GetHeight());
+        m_Steps.resize(width * height);
+
+        for (i32 y = 0; y < height; ++y)
+        {
+            for (i32 x = 0; x < width; ++x)
+            {
+                u8 steps = 0;
+                if (m_Grid.IsWalkable(x, y))
+                {
+                    for (u32 step = 0; step < 8; ++step)
+                    {
+                        if (m_Grid.CanStep(x, y, StepX[step], StepY[step])) steps |= 1u << step;
+                    }
+                }
+                m_Steps[y * width + x] = steps;
+            }
+        }
+        m_StepsVersion = m_Grid.GetVersion();
+    }
+
+    // Dijkstra outward from the destination. Step costs are 10 and 14, so
+    // every open cost lies within 14 of the one being settled and a ring of
+    // 15 buckets replaces the heap. Steps are symmetric, so the step that
+    // reached a cell, reversed, is its way back.
+    void FlowFieldCache::Build(FlowField& field, glm::ivec2 destination)
+    {
+        const i32 width = static_cast<i32>(m_Grid.GetWidth());
+        const u32 cellCount = m_Grid.GetWidth() * m_Grid.GetHeight();
+        constexpr u32 BucketCount = NavGrid::DiagonalCost + 1;
+
+        field.m_Grid = &m_Grid;
+        field.m_Destination = destination;
+        field.m_Version = m_Grid.GetVersion();
+        field.m_Cost.assign(cellCount, FlowField::Unreachable);
+        field.m_Next.assign(cellCount, FlowField::None);
+        m_Builds++;
+
+        for (auto& bucket : m_Buckets) bucket.clear();
+
+        if (!m_Grid.IsWalkable(destination.x, destination.y)) return;
+        if (m_StepsVersion != m_Grid.GetVersion()) BuildSteps();
+
+        u32* cost = field.m_Cost.data();
+        u8* next = field.m_Next.data();
+
+        const u32 start = destination.y * width + destination.x;
+        cost[start] = 0;
+        m_Buckets[0].push_back(start);
+        u32 open = 1;
+
+        for (u32 current = 0; open > 0; ++current)
+        {
+            std::vector<u32>& bucket = m_Buckets[current % BucketCount];
+            while (!bucket.empty())
+            {
+                const u32 index = bucket.back();
+                bucket.pop_back();
+                open--;
+                if (cost[index] != current) continue;
+
+                const u8 steps = m_Steps[index];
+                for (u32 step = 0; step < 8; ++step)
+                {
+                    if (!(steps & (1u << step))) continue;
+
+                    const u32 neighbour = index + StepY[step] * width + StepX[step];
+                    const u32 neighbourCost = current + (step >= 4 ? NavGrid::DiagonalCost : NavGrid::StraightCost);
+                    if (cost[neighbour] <= neighbourCost) continue;
+
+                    cost[neighbour] = neighbourCost;
+                    next[neighbour] = Opposite[step];
+                    m_Buckets[neighbourCost % BucketCount].push_back(neighbour);
+                    open++;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "NavGrid.h"
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // FlowField - Direction to one destination from every cell
+    //=========================================================================
+
+    /// Cost is the shortest 8-way walking cost from each cell to the
+    /// destination (NavGrid step costs); Next is the neighbour step that
+    /// lowers it most. Built by FlowFieldCache. Only the grid's size and
+    /// cell mapping are read after the build, so a held field can be
+    /// sampled while the grid is edited.
+    class FlowField
+    {
+    public:
+        static constexpr u32 Unreachable = ~0u;
+
+        /// Unit direction toward the center of the next cell on the way, so
+        /// a unit never cuts a blocked corner. Zero in the destination cell
+        /// (steer to the exact point from there) and where the destination
+        /// cannot be reached.
+        glm::vec2 Sample(glm::vec2 position) const;
+
+        bool IsReachable(glm::vec2 position) const;
+
+        /// Walking cost from the cell to the destination, or Unreachable
+        u32 GetCost(glm::ivec2 cell) const { return m_Cost[cell.y * m_Grid->GetWidth() + cell.x]; }
+
+        glm::ivec2 GetDestination() const { return m_Destination; }
+
+    private:
+        friend class FlowFieldCache;
+
+        static constexpr u8 None = 8;
+
+        const NavGrid* m_Grid = nullptr;
+        glm::ivec2 m_Destination = { 0, 0 };
+        std::vector<u32> m_Cost;
+        std::vector<u8> m_Next;                     // Step index, or None
+        u32 m_Version = 0;                          // Grid version it was built from
+    };
+
+    //=========================================================================
+    // FlowFieldCache - Flow fields by destination cell
+    //=========================================================================
+
+    /// A minion wave shares a handful of destinations, so one field per
+    /// destination replaces a path search per unit. Fields are kept for
+    /// the most recently used destinations and rebuilt on their next Get()
+    /// once the grid has changed. A field is never changed while a caller
+    /// still holds it: a rebuild or eviction then builds a new one, and the
+    /// held field stays valid (and stale) until released. Get() is not
+    /// thread-safe; fetch the fields first, then sample them from any thread.
+    class FlowFieldCache
+    {
+    public:
+        explicit FlowFieldCache(const NavGrid& grid, u32 capacity = 16);
+
+        /// Destinations on blocked cells move to the nearest walkable one
+        std::shared_ptr<const FlowField> Get(glm::vec2 destination);
+
+        void Clear() { m_Fields.clear(); }
+
+        u32 GetBuildCount() const { return m_Builds; }
+        u32 GetSize() const { return static_cast<u32>(m_Fields.size()); }
+
+    private:
+        struct Entry
+        {
+            std::shared_ptr<FlowField> Field;
+            u64 LastUsed = 0;
+        };
+
+        /// The entry's field, replaced by a new one if a caller holds it
+        FlowField& Reclaim(Entry& entry);
+        void Build(FlowField& field, glm::ivec2 destination);
+        void BuildSteps();
+
+        const NavGrid& m_Grid;
+        u32 m_Capacity;
+        std::vector<u8> m_Steps;                    // Allowed neighbour steps per cell, shared by all builds
+        u32 m_StepsVersion = 0;
+        std::vector<Entry> m_Fields;
+        std::vector<u32> m_Buckets[NavGrid::DiagonalCost + 1];
+        u64 m_Uses = 0;
+        u32 m_Builds = 0;
+    };
+}
@@ -0,0 +1,112 @@
+#include "NavGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace RiftSpire
+{
+    NavGrid::NavGrid(u32 width, u32 height, float cellSize, glm::vec2 origin)
+        : m_Width(width), m_Height(height), m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize),
+          m_Origin(origin), m_Walkable(width * height, 1)
+    {
+    }
+
+    void NavGrid::SetWalkable(i32 x, i32 y, bool walkable)
+    {
+        if (x < 0 || y < 0 || x >= static_cast<i32>(m_Width) || y >= static_cast<i32>(m_Height)) return;
+
+        u8& cell = m_Walkable[y * m_Width + x];
+        if (cell == static_cast<u8>(walkable)) return;
+
+        cell = walkable;
+        m_Version++;
+    }
+
+    // Supercover walk: every cell the segment passes through, and both
+    // neighbours where it passes exactly through a corner
+    bool NavGrid::LineOfSight(glm::ivec2 from, glm::ivec2 to) const
+    {
+        const i32 dx = std::abs(to.x - from.x), dy = std::abs(to.y - from.y);
+        const i32 stepX = to.x > from.x ? 1 : -1, stepY = to.y > from.y ? 1 : -1;
+
+        i32 x = from.x, y = from.y;
+        i32 error = dx - dy;
+
+        for (i32 n = 1 + dx + dy; n > 0; --n)
+        {
+            if (!IsWalkable(x, y)) return false;
+
+            if (error > 0)
+            {
+                x += stepX;
+                error -= 2 * dy;
+            }
+            else if (error < 0)
+            {
+                y += stepY;
+                error += 2 * dx;
+            }
+            else
+            {
+                if (n > 1 && (!IsWalkable(x + stepX, y) || !IsWalkable(x, y + stepY))) return false;
+                x += stepX;
+                y += stepY;
+                error += 2 * (dx - dy);
+                n--;
+            }
+        }
+        return true;
+    }
+
+    bool NavGrid::NearestWalkable(glm::ivec2& cell, i32 maxRadius) const
+    {
+        if (IsWalkable(cell.x, cell.y)) return true;
+
+        // Rings of growing Chebyshev radius; closest by squared distance within a ring
+        for (i32 radius = 1; radius <= maxRadius; ++radius)
+        {
+            glm::ivec2 best = cell;
+            i32 bestDistance = -1;
+
+            for (i32 dy = -radius; dy <= radius; ++dy)
+            {
+                const i32 step = (dy == -radius || dy == radius) ? 1 : 2 * radius;
+                for (i32 dx = -radius; dx <= radius; dx += step)
+                {
+                    const i32 distance = dx * dx + dy * dy;
+                    if (IsWalkable(cell.x + dx, cell.y + dy) && (bestDistance < 0 || distance < bestDistance))
+                    {
+                        best = { cell.x + dx, cell.y + dy };
+                        bestDistance = distance;
+                    }
+                }
+            }
+
+            if (bestDistance >= 0)
+            {
+                cell = best;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    glm::ivec2 NavGrid::CellOf(glm::vec2 position) const
+    {
+        const i32 x = static_cast<i32>(std::floor((position.x - m_Origin.x) * m_InverseCellSize));
+        const i32 y = static_cast<i32>(std::floor((position.y - m_Origin.y) * m_InverseCellSize));
+        return { std::clamp(x, 0, static_cast<i32>(m_Width) - 1), std::clamp(y, 0, static_cast<i32>(m_Height) - 1) };
+    }
+
+    glm::vec2 NavGrid::CenterOf(glm::ivec2 cell) const
+    {
+        return { m_Origin.x + (cell.x + 0.5f) * m_CellSize, m_Origin.y + (cell.y + 0.5f) * m_CellSize };
+    }
+
+    u32 NavGrid::Estimate(glm::ivec2 a, glm::ivec2 b)
+    {
+        const u32 dx = static_cast<u32>(std::abs(a.x - b.x));
+        const u32 dy = static_cast<u32>(std::abs(a.y - b.y));
+        return StraightCost * std::max(dx, dy) + (DiagonalCost - StraightCost) * std::min(dx, dy);
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // NavGrid - Walkability of the map in square cells over X/Z
+    //=========================================================================
+
+    /// Cell (x, y) covers X in [origin.x + x * size, ...) and Z in
+    /// [origin.y + y * size, ...). Units step to any of the 8 neighbours,
+    /// but never diagonally past a blocked corner. Every change bumps the
+    /// version, which is how path and flow field caches notice edits.
+    class NavGrid
+    {
+    public:
+        /// Step costs: orthogonal, diagonal (about 10 * sqrt(2))
+        static constexpr u32 StraightCost = 10;
+        static constexpr u32 DiagonalCost = 14;
+
+        explicit NavGrid(u32 width = 512, u32 height = 512, float cellSize = 32.0f, glm::vec2 origin = { 0.0f, 0.0f });
+
+        void SetWalkable(i32 x, i32 y, bool walkable);
+
+        /// Outside the grid is blocked
+        bool IsWalkable(i32 x, i32 y) const
+        {
+            return x >= 0 && y >= 0 && x < static_cast<i32>(m_Width) && y < static_cast<i32>(m_Height) && m_Walkable[y * m_Width + x];
+        }
+
+        /// Whether a unit on (x, y) may step by (dx, dy), each -1, 0 or 1
+        bool CanStep(i32 x, i32 y, i32 dx, i32 dy) const
+        {
+            if (!IsWalkable(x + dx, y + dy)) return false;
+            return dx == 0 || dy == 0 || (IsWalkable(x + dx, y) && IsWalkable(x, y + dy));
+        }
+
+        /// Straight line between cell centers that touches no blocked cell
+        /// and squeezes past no blocked corner
+        bool LineOfSight(glm::ivec2 from, glm::ivec2 to) const;
+
+        /// Closest walkable cell within maxRadius rings of cell; false if none
+        bool NearestWalkable(glm::ivec2& cell, i32 maxRadius = 16) const;
+
+        /// Clamped to the grid
+        glm::ivec2 CellOf(glm::vec2 position) const;
+        glm::vec2 CenterOf(glm::ivec2 cell) const;
+
+        /// Octile distance in step costs, a lower bound on any path
+        static u32 Estimate(glm::ivec2 a, glm::ivec2 b);
+
+        u32 GetWidth() const { return m_Width; }
+        u32 GetHeight() const { return m_Height; }
+        float GetCellSize() const { return m_CellSize; }
+        u32 GetVersion() const { return m_Version; }
+
+    private:
+        u32 m_Width, m_Height;
+        float m_CellSize;
+        float m_InverseCellSize;
+        glm::vec2 m_Origin;
+        std::vector<u8> m_Walkable;
+        u32 m_Version = 1;
+    };
+}
@@ -0,0 +1,606 @@
+#include "PathService.h"
+#include "../Core/JobPool.h"
+#include <algorithm>
+#include <functional>
+
+namespace RiftSpire
+{
+    // Border runs at least this long get an entrance at each end
+    static constexpr i32 LongRun = 6;
+
+    // Neighbour steps, bit i of PathService::m_Steps
+    static constexpr i32 StepX[8] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+    static constexpr i32 StepY[8] = { 0, 0, 1, -1, 1, 1, -1, -1 };
+
+    using HeapEntry = std::pair<u32, u32>;
+
+    static void HeapPush(std::vector<HeapEntry>& heap, u32 key, u32 value)
+    {
+        heap.push_back({ key, value });
+        std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+    }
+
+    static HeapEntry HeapPop(std::vector<HeapEntry>& heap)
+    {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+        const HeapEntry top = heap.back();
+        heap.pop_back();
+        return top;
+    }
+
+    PathService::PathService(const NavGrid& grid, u32 clusterSize, JobPool* pool)
+        : m_Grid(grid), m_Pool(pool ? *pool : JobPool::GetShared()), m_ClusterSize(clusterSize)
+    {
+    }
+
+    PathService::~PathService()
+    {
+        m_Pool.Wait(m_InFlight);
+    }
+
+    u32 PathService::ClusterOf(glm::ivec2 cell) const
+    {
+        return (cell.y / m_ClusterSize) * m_ClustersX + cell.x / m_ClusterSize;
+    }
+
+    void PathService::ClusterBounds(u32 cluster, glm::ivec2& min, glm::ivec2& max) const
+    {
+        min = { static_cast<i32>((cluster % m_ClustersX) * m_ClusterSize), static_cast<i32>((cluster / m_ClustersX) * m_ClusterSize) };
+        max = { static_cast<i32>(std::min(min.x + m_ClusterSize, m_Width)) - 1, static_cast<i32>(std::min(min.y + m_ClusterSize, m_Height)) - 1 };
+    }
+
+    u32 PathService::LocalIndex(u32 cluster, u32 cell) const
+    {
+        glm::ivec2 min, max;
+        ClusterBounds(cluster, min, max);
+        const glm::ivec2 position = CellAt(cell);
+        return (position.y - min.y) * m_ClusterSize + (position.x - min.x);
+    }
+
+    //=========================================================================
+    // Grid searches
+    //=========================================================================
+
+    void PathService::Search(Local& local, u32 cluster, u32 origin) const
+    {
+        const u32 area = m_ClusterSize * m_ClusterSize;
+        if (local.Cost.size() < area)
+        {
+            local.Cost.resize(area);
+            local.Parent.resize(area);
+            local.Stamp.assign(area, 0);
+            local.Pass = 0;
+        }
+        if (++local.Pass == 0)
+        {
+            std::fill(local.Stamp.begin(), local.Stamp.end(), 0);
+            local.Pass = 1;
+        }
+        local.Cluster = cluster;
+
+        glm::ivec2 min, max;
+        ClusterBounds(cluster, min, max);
+
+        const u32 start = LocalIndex(cluster, origin);
+        local.Cost[start] = 0;
+        local.Parent[start] = None;
+        local.Stamp[start] = local.Pass;
+
+        local.Heap.clear();
+        HeapPush(local.Heap, 0, start);
+
+        while (!local.Heap.empty())
+        {
+            const auto [cost, index] = HeapPop(local.Heap);
+            if (cost != local.Cost[index]) continue;
+
+            const i32 x = min.x + static_cast<i32>(index % m_ClusterSize);
+            const i32 y = min.y + static_cast<i32>(index / m_ClusterSize);
+            const u8 steps = m_Steps[y * m_Width + x];
+
+            for (u32 step = 0; step < 8; ++step)
+            {
+                const i32 nx = x + StepX[step], ny = y + StepY[step];
+                if (!(steps & (1u << step)) || nx < min.x || ny < min.y || nx > max.x || ny > max.y) continue;
+
+                const u32 next = (ny - min.y) * m_ClusterSize + (nx - min.x);
+                const u32 nextCost = cost + (step >= 4 ? NavGrid::DiagonalCost : NavGrid::StraightCost);
+                if (local.CostOf(next) <= nextCost) continue;
+
+                local.Cost[next] = nextCost;
+                local.Parent[next] = index;
+                local.Stamp[next] = local.Pass;
+                HeapPush(local.Heap, nextCost, next);
+            }
+        }
+    }
+
+    // Appends cell, its parent, ... up to the search origin
+    void PathService::Trace(const Local& local, u32 cell, std::vector<u32>& out) const
+    {
+        glm::ivec2 min, max;
+        ClusterBounds(local.Cluster, min, max);
+
+        for (u32 index = LocalIndex(local.Cluster, cell); index != None; index = local.Parent[index])
+        {
+            out.push_back((min.y + index / m_ClusterSize) * m_Width + min.x + index % m_ClusterSize);
+        }
+    }
+
+    //=========================================================================
+    // Entrance graph
+    //=========================================================================
+
+    void PathService::Build()
+    {
+        // Searches run across ticks on the workers and read only this copy,
+        // so edits to the live grid never race them
+        m_Snapshot = m_Grid;
+        m_Width = m_Snapshot.GetWidth();
+        m_Height = m_Snapshot.GetHeight();
+        m_ClustersX = (m_Width + m_ClusterSize - 1) / m_ClusterSize;
+        m_ClustersY = (m_Height + m_ClusterSize - 1) / m_ClusterSize;
+        const u32 clusterCount = m_ClustersX * m_ClustersY;
+
+        m_Steps.assign(m_Width * m_Height, 0);
+        for (i32 y = 0; y < static_cast<i32>(m_Height); ++y)
+        {
+            for (i32 x = 0; x < static_cast<i32>(m_Width); ++x)
+            {
+                u8 steps = 0;
+                for (u32 step = 0; step < 8; ++step)
+                {
+                    if (m_Snapshot.CanStep(x, y, StepX[step], StepY[step])) steps |= 1u << step;
+                }
+                m_Steps[y * m_Width + x] = steps;
+            }
+        }
+
+        std::vector<std::vector<u32>> clusterCells(clusterCount);
+        std::vector<std::pair<u32, u32>> links;
+
+        auto link = [&](i32 ax, i32 ay, i32 bx, i32 by)
+        {
+            const u32 a = ay * m_Width + ax, b = by * m_Width + bx;
+            links.push_back({ a, b });
+            clusterCells[ClusterOf({ ax, ay })].push_back(a);
+            clusterCells[ClusterOf({ bx, by })].push_back(b);
+        };
+
+        // Walkable runs along one border; (x, y) + i * along is this side, + across the other
+        auto scan = [&](i32 x, i32 y, i32 length, glm::ivec2 along, glm::ivec2 across)
+        {
+            i32 runStart = -1;
+            for (i32 i = 0; i <= length; ++i)
+            {
+                const i32 cx = x + i * along.x, cy = y + i * along.y;
+                const bool open = i < length && m_Snapshot.IsWalkable(cx, cy) && m_Snapshot.IsWalkable(cx + across.x, cy + across.y);
+                if (open && runStart < 0) runStart = i;
+                if (open || runStart < 0) continue;
+
+                const i32 first = runStart, last = i - 1;
+                runStart = -1;
+
+                if (last - first + 1 < LongRun)
+                {
+                    const i32 middle = (first + last) / 2;
+                    link(x + middle * along.x, y + middle * along.y, x + middle * along.x + across.x, y + middle * along.y + across.y);
+                }
+                else
+                {
+                    link(x + first * along.x, y + first * along.y, x + first * along.x + across.x, y + first * along.y + across.y);
+                    link(x + last * along.x, y + last * along.y, x + last * along.x + across.x, y + last * along.y + across.y);
+                }
+            }
+        };
+
+        for (u32 cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            glm::ivec2 min, max;
+            ClusterBounds(cluster, min, max);
+            if (max.x + 1 < static_cast<i32>(m_Width)) scan(max.x, min.y, max.y - min.y + 1, { 0, 1 }, { 1, 0 });
+            if (max.y + 1 < static_cast<i32>(m_Height)) scan(min.x, max.y, max.x - min.x + 1, { 1, 0 }, { 0, 1 });
+        }
+
+        // Nodes grouped by cluster
+        m_Nodes.clear();
+        m_ClusterFirst.assign(clusterCount + 1, 0);
+        std::unordered_map<u32, u32> nodeOf;
+        for (u32 cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            std::vector<u32>& cells = clusterCells[cluster];
+            std::sort(cells.begin(), cells.end());
+            cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+            m_ClusterFirst[cluster] = static_cast<u32>(m_Nodes.size());
+            for (u32 cell : cells)
+            {
+                nodeOf[cell] = static_cast<u32>(m_Nodes.size());
+                m_Nodes.push_back({ cell, cluster });
+            }
+        }
+        m_ClusterFirst[clusterCount] = static_cast<u32>(m_Nodes.size());
+
+        // Paths between the entrances of each cluster, clusters in parallel
+        struct Intra
+        {
+            std::vector<std::vector<Edge>> ByNode;
+            std::vector<u32> Paths;
+        };
+        std::vector<Intra> intra(clusterCount);
+
+        constexpr u32 ClustersPerJob = 8;
+        std::atomic<u32> pending{ (clusterCount + ClustersPerJob - 1) / ClustersPerJob };
+        for (u32 begin = 0; begin < clusterCount; begin += ClustersPerJob)
+        {
+            m_Pool.Submit([this, &intra, &pending, begin, end = std::min(begin + ClustersPerJob, clusterCount)]()
+            {
+                Local local;
+                std::vector<u32> trace;
+                for (u32 cluster = begin; cluster < end; ++cluster)
+                {
+                    const u32 first = m_ClusterFirst[cluster], count = m_ClusterFirst[cluster + 1] - first;
+                    Intra& out = intra[cluster];
+                    out.ByNode.resize(count);
+
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        Search(local, cluster, m_Nodes[first + i].Cell);
+                        for (u32 j = 0; j < count; ++j)
+                        {
+                            const u32 cost = local.CostOf(LocalIndex(cluster, m_Nodes[first + j].Cell));
+                            if (j == i || cost == None) continue;
+
+                            // Trace runs target to source; store source-exclusive, in walking order
+                            trace.clear();
+                            Trace(local, m_Nodes[first + j].Cell, trace);
+                            const u32 offset = static_cast<u32>(out.Paths.size());
+                            out.Paths.insert(out.Paths.end(), trace.rbegin() + 1, trace.rend());
+                            out.ByNode[i].push_back({ first + j, cost, offset, static_cast<u32>(trace.size() - 1) });
+                        }
+                    }
+                }
+                pending.fetch_sub(1, std::memory_order_release);
+            });
+        }
+        m_Pool.Wait(pending);
+
+        std::vector<std::vector<u32>> crossings(m_Nodes.size());
+        for (const auto& [a, b] : links)
+        {
+            crossings[nodeOf[a]].push_back(nodeOf[b]);
+            crossings[nodeOf[b]].push_back(nodeOf[a]);
+        }
+
+        m_Edges.clear();
+        m_EdgePaths.clear();
+        for (u32 cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            const u32 base = static_cast<u32>(m_EdgePaths.size());
+            m_EdgePaths.insert(m_EdgePaths.end(), intra[cluster].Paths.begin(), intra[cluster].Paths.end());
+
+            for (u32 node = m_ClusterFirst[cluster]; node < m_ClusterFirst[cluster + 1]; ++node)
+            {
+                m_Nodes[node].FirstEdge = static_cast<u32>(m_Edges.size());
+                for (Edge edge : intra[cluster].ByNode[node - m_ClusterFirst[cluster]])
+                {
+                    edge.PathOffset += base;
+                    m_Edges.push_back(edge);
+                }
+                for (u32 other : crossings[node]) m_Edges.push_back({ other, NavGrid::StraightCost });
+                m_Nodes[node].EdgeCount = static_cast<u32>(m_Edges.size()) - m_Nodes[node].FirstEdge;
+            }
+        }
+    }
+
+    // A* over the entrance graph from the start search to the goal search.
+    // Writes the entrance route to scratch.Route.
+    bool PathService::SearchGraph(Scratch& scratch, u32 startCluster, u32 goalCluster, glm::ivec2 goal) const
+    {
+        const u32 nodeCount = static_cast<u32>(m_Nodes.size());
+        const u32 start = nodeCount, target = nodeCount + 1;
+
+        if (scratch.Stamp.size() < nodeCount + 2)
+        {
+            scratch.Cost.resize(nodeCount + 2);
+            scratch.Parent.resize(nodeCount + 2);
+            scratch.Stamp.assign(nodeCount + 2, 0);
+            scratch.Pass = 0;
+        }
+        if (++scratch.Pass == 0)
+        {
+            std::fill(scratch.Stamp.begin(), scratch.Stamp.end(), 0);
+            scratch.Pass = 1;
+        }
+
+        auto estimate = [&](u32 node) { return node == target ? 0 : NavGrid::Estimate(CellAt(m_Nodes[node].Cell), goal); };
+        auto relax = [&](u32 node, u32 cost, u32 parent)
+        {
+            if (scratch.Stamp[node] == scratch.Pass && scratch.Cost[node] <= cost) return;
+            scratch.Cost[node] = cost;
+            scratch.Parent[node] = parent;
+            scratch.Stamp[node] = scratch.Pass;
+            HeapPush(scratch.Heap, cost + estimate(node), node);
+        };
+
+        scratch.Heap.clear();
+        for (u32 node = m_ClusterFirst[startCluster]; node < m_ClusterFirst[startCluster + 1]; ++node)
+        {
+            const u32 cost = scratch.Start.CostOf(LocalIndex(startCluster, m_Nodes[node].Cell));
+            if (cost != None) relax(node, cost, start);
+        }
+
+        bool found = false;
+        while (!scratch.Heap.empty())
+        {
+            const auto [priority, node] = HeapPop(scratch.Heap);
+            if (priority != scratch.Cost[node] + estimate(node)) continue;
+            if (node == target)
+            {
+                found = true;
+                break;
+            }
+
+            const u32 cost = scratch.Cost[node];
+            if (m_Nodes[node].Cluster == goalCluster)
+            {
+                const u32 rest = scratch.Goal.CostOf(LocalIndex(goalCluster, m_Nodes[node].Cell));
+                if (rest != None) relax(target, cost + rest, node);
+            }
+
+            const Node& from = m_Nodes[node];
+            for (u32 i = from.FirstEdge; i < from.FirstEdge + from.EdgeCount; ++i)
+            {
+                relax(m_Edges[i].To, cost + m_Edges[i].Cost, node);
+            }
+        }
+        if (!found) return false;
+
+        scratch.Route.clear();
+        for (u32 node = scratch.Parent[target]; node != start; node = scratch.Parent[node]) scratch.Route.push_back(node);
+        std::reverse(scratch.Route.begin(), scratch.Route.end());
+        return true;
+    }
+
+    //=========================================================================
+    // Requests
+    //=========================================================================
+
+    PathResult PathService::Solve(const Query& query, Scratch& scratch)
+    {
+        PathResult result;
+        result.Ticket = query.Ticket;
+        m_Solved.fetch_add(1, std::memory_order_relaxed);
+
+        glm::ivec2 start = m_Snapshot.CellOf(query.From);
+        glm::ivec2 goal = m_Snapshot.CellOf(query.To);
+        const glm::ivec2 clicked = goal;
+        if (!m_Snapshot.NearestWalkable(start) || !m_Snapshot.NearestWalkable(goal)) return result;
+
+        // A blocked destination is replaced by the nearest walkable cell
+        const glm::vec2 destination = goal == clicked ? query.To : m_Snapshot.CenterOf(goal);
+        result.Result = PathResult::Status::Found;
+
+        if (m_Snapshot.LineOfSight(start, goal))
+        {
+            result.Waypoints.push_back(destination);
+            return result;
+        }
+
+        const u32 startCell = start.y * m_Width + start.x;
+        const u32 goalCell = goal.y * m_Width + goal.x;
+        const u32 startCluster = ClusterOf(start);
+        const u32 goalCluster = ClusterOf(goal);
+
+        std::vector<u32>& cells = scratch.Cells;
+        cells.clear();
+
+        Search(scratch.Start, startCluster, startCell);
+        if (startCluster == goalCluster && scratch.Start.CostOf(LocalIndex(startCluster, goalCell)) != None)
+        {
+            Trace(scratch.Start, goalCell, cells);
+            std::reverse(cells.begin(), cells.end());
+            Smooth(cells, destination, scratch, result.Waypoints);
+            return result;
+        }
+
+        Search(scratch.Goal, goalCluster, goalCell);
+
+        // Reuse the route cached for this cluster pair if both ends connect to it
+        const u64 key = static_cast<u64>(startCluster) << 32 | goalCluster;
+        bool cached = false;
+        if (startCluster != goalCluster)
+        {
+            std::lock_guard<std::mutex> lock(m_CacheMutex);
+            const auto it = m_Cache.find(key);
+            if (it != m_Cache.end() &&
+                scratch.Start.CostOf(LocalIndex(startCluster, m_Nodes[it->second.front()].Cell)) != None &&
+                scratch.Goal.CostOf(LocalIndex(goalCluster, m_Nodes[it->second.back()].Cell)) != None)
+            {
+                scratch.Route = it->second;
+                cached = true;
+            }
+        }
+
+        if (cached)
+        {
+            m_CacheHits.fetch_add(1, std::memory_order_relaxed);
+            result.FromCache = true;
+        }
+        else
+        {
+            if (!SearchGraph(scratch, startCluster, goalCluster, goal))
+            {
+                result.Result = PathResult::Status::NotFound;
+                return result;
+            }
+
+            if (startCluster != goalCluster)
+            {
+                std::lock_guard<std::mutex> lock(m_CacheMutex);
+                if (m_Cache.size() >= m_CacheCapacity) m_Cache.clear();
+                m_Cache[key] = scratch.Route;
+            }
+        }
+
+        // Start to the first entrance, stored paths between entrances, last entrance to goal
+        const std::vector<u32>& route = scratch.Route;
+        Trace(scratch.Start, m_Nodes[route.front()].Cell, cells);
+        std::reverse(cells.begin(), cells.end());
+
+        for (size_t i = 1; i < route.size(); ++i)
+        {
+            const Node& from = m_Nodes[route[i - 1]];
+            for (u32 e = from.FirstEdge; e < from.FirstEdge + from.EdgeCount; ++e)
+            {
+                const Edge& edge = m_Edges[e];
+                if (edge.To != route[i]) continue;
+
+                if (edge.PathLength == 0) cells.push_back(m_Nodes[edge.To].Cell);
+                else cells.insert(cells.end(), m_EdgePaths.begin() + edge.PathOffset, m_EdgePaths.begin() + edge.PathOffset + edge.PathLength);
+                break;
+            }
+        }
+
+        cells.pop_back();
+        Trace(scratch.Goal, m_Nodes[route.back()].Cell, cells);
+
+        Smooth(cells, destination, scratch, result.Waypoints);
+        return result;
+    }
+
+    // Keep the cells where the path turns, then skip every corner that the
+    // previous waypoint can see past
+    void PathService::Smooth(const std::vector<u32>& cells, glm::vec2 to, Scratch& scratch, std::vector<glm::vec2>& out) const
+    {
+        std::vector<u32>& corners = scratch.Corners;
+        corners.clear();
+        corners.push_back(cells.front());
+        for (size_t i = 1; i + 1 < cells.size(); ++i)
+        {
+            if (cells[i] - cells[i - 1] != cells[i + 1] - cells[i]) corners.push_back(cells[i]);
+        }
+        if (cells.size() > 1) corners.push_back(cells.back());
+
+        const size_t last = corners.size() - 1;
+        for (size_t anchor = 0; anchor < last;)
+        {
+            size_t next = anchor + 1;
+            while (next < last && m_Snapshot.LineOfSight(CellAt(corners[anchor]), CellAt(corners[next + 1]))) next++;
+
+            out.push_back(next == last ? to : m_Snapshot.CenterOf(CellAt(corners[next])));
+            anchor = next;
+        }
+        if (out.empty()) out.push_back(to);
+    }
+
+    std::unique_ptr<PathService::Scratch> PathService::AcquireScratch()
+    {
+        std::lock_guard<std::mutex> lock(m_ScratchMutex);
+        if (m_FreeScratch.empty()) return std::make_unique<Scratch>();
+
+        std::unique_ptr<Scratch> scratch = std::move(m_FreeScratch.back());
+        m_FreeScratch.pop_back();
+        return scratch;
+    }
+
+    void PathService::ReleaseScratch(std::unique_ptr<Scratch> scratch)
+    {
+        std::lock_guard<std::mutex> lock(m_ScratchMutex);
+        m_FreeScratch.push_back(std::move(scratch));
+    }
+
+    u32 PathService::Request(glm::vec2 from, glm::vec2 to)
+    {
+        std::lock_guard<std::mutex> lock(m_PendingMutex);
+        const u32 ticket = m_NextTicket++;
+        m_Pending.push_back({ ticket, from, to });
+        return ticket;
+    }
+
+    u32 PathService::GetPendingCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_PendingMutex);
+        return static_cast<u32>(m_Pending.size());
+    }
+
+    void PathService::Collect()
+    {
+        std::lock_guard<std::mutex> lock(m_FinishedMutex);
+        for (PathResult& result : m_Finished) m_Completed.push_back(std::move(result));
+        m_Finished.clear();
+    }
+
+    void PathService::Refresh()
+    {
+        if (m_BuiltVersion == m_Grid.GetVersion()) return;
+
+        // Searches in flight still read the old graph
+        m_Pool.Wait(m_InFlight);
+        Build();
+        m_BuiltVersion = m_Snapshot.GetVersion();
+
+        std::lock_guard<std::mutex> lock(m_CacheMutex);
+        m_Cache.clear();
+    }
+
+    PathResult PathService::FindPath(glm::vec2 from, glm::vec2 to)
+    {
+        Refresh();
+
+        std::unique_ptr<Scratch> scratch = AcquireScratch();
+        PathResult result = Solve({ 0, from, to }, *scratch);
+        ReleaseScratch(std::move(scratch));
+        return result;
+    }
+
+    u32 PathService::Update()
+    {
+        Refresh();
+
+        m_Completed.clear();
+        Collect();
+
+        std::vector<Query> batch;
+        {
+            std::lock_guard<std::mutex> lock(m_PendingMutex);
+            const size_t count = std::min<size_t>(m_Budget, m_Pending.size());
+            batch.assign(m_Pending.begin(), m_Pending.begin() + count);
+            m_Pending.erase(m_Pending.begin(), m_Pending.begin() + count);
+        }
+
+        for (size_t begin = 0; begin < batch.size(); begin += m_BatchSize)
+        {
+            const size_t end = std::min(begin + m_BatchSize, batch.size());
+            m_InFlight.fetch_add(1, std::memory_order_relaxed);
+            m_Pool.Submit([this, queries = std::vector<Query>(batch.begin() + begin, batch.begin() + end)]()
+            {
+                std::unique_ptr<Scratch> scratch = AcquireScratch();
+                std::vector<PathResult> results;
+                for (const Query& query : queries) results.push_back(Solve(query, *scratch));
+                ReleaseScratch(std::move(scratch));
+
+                {
+                    std::lock_guard<std::mutex> lock(m_FinishedMutex);
+                    for (PathResult& result : results) m_Finished.push_back(std::move(result));
+                }
+                m_InFlight.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        // Without workers nobody else would ever run the jobs
+        if (m_WaitForResults || m_Pool.GetWorkerCount() == 0)
+        {
+            m_Pool.Wait(m_InFlight);
+            Collect();
+        }
+
+        std::sort(m_Completed.begin(), m_Completed.end(), [](const PathResult& a, const PathResult& b) { return a.Ticket < b.Ticket; });
+        return static_cast<u32>(m_Completed.size());
+    }
+
+    SystemAccess PathService::GetAccess()
+    {
+        return SystemAccess().WriteResource<PathService>();
+    }
+}
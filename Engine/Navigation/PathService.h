@@ -0,0 +1,192 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "../ECS/SystemScheduler.h"
+#include "NavGrid.h"
+#include <glm/glm.hpp>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace RiftSpire
+{
+    class JobPool;
+
+    struct PathResult
+    {
+        enum class Status : u8 { Found, NotFound };
+
+        u32 Ticket = 0;
+        Status Result = Status::NotFound;
+        std::vector<glm::vec2> Waypoints;           // X/Z, in walking order, ending at the destination
+        bool FromCache = false;
+    };
+
+    //=========================================================================
+    // PathService - Hierarchical A* (HPA*) over a NavGrid
+    //=========================================================================
+
+    /// The grid is cut into square clusters. Walkable runs along each
+    /// cluster border become entrances (one in the middle, or one at each
+    /// end of a long run), and entrances of the same cluster are linked by
+    /// their shortest path inside it, stored with the graph. A request
+    /// searches its start and goal clusters on the grid, the small
+    /// entrance graph in between, and then only copies stored paths. The
+    /// route between two clusters is cached by cluster pair and reused when
+    /// the new start and goal reach its ends, trading a little optimality
+    /// for skipping the graph search. Paths are smoothed by line of sight.
+    ///
+    /// Request() may be called from any thread. Update() hands at most the
+    /// budget of queued requests per tick to the job pool; results show up
+    /// in GetCompleted() on a later Update (the same one with
+    /// SetWaitForResults, or when the pool has no workers). Searches read a
+    /// copy of the grid taken with the graph, so the grid may be edited
+    /// while they run. An edit rebuilds the graph, takes a new copy and
+    /// empties the cache on the next Update, after the requests in flight
+    /// have finished.
+    class PathService
+    {
+    public:
+        explicit PathService(const NavGrid& grid, u32 clusterSize = 16, JobPool* pool = nullptr);
+        ~PathService();
+
+        PathService(const PathService&) = delete;
+        PathService& operator=(const PathService&) = delete;
+
+        /// Returns the ticket the result will carry
+        u32 Request(glm::vec2 from, glm::vec2 to);
+
+        /// Returns how many results were published
+        u32 Update();
+
+        /// Results published by the last Update, sorted by ticket. Systems
+        /// reading them declare Resource<PathService>().
+        const std::vector<PathResult>& GetCompleted() const { return m_Completed; }
+
+        /// Search on the calling thread, bypassing the queue; not while
+        /// Update runs
+        PathResult FindPath(glm::vec2 from, glm::vec2 to);
+
+        /// Requests handed to the workers per Update
+        void SetBudget(u32 requestsPerTick) { m_Budget = requestsPerTick; }
+        void SetWaitForResults(bool wait) { m_WaitForResults = wait; }
+        void SetCacheCapacity(u32 routes) { m_CacheCapacity = routes; }
+
+        u32 GetPendingCount() const;
+        u64 GetSolvedCount() const { return m_Solved.load(std::memory_order_relaxed); }
+        u64 GetCacheHitCount() const { return m_CacheHits.load(std::memory_order_relaxed); }
+        u32 GetNodeCount() const { return static_cast<u32>(m_Nodes.size()); }
+
+        static SystemAccess GetAccess();
+
+    private:
+        static constexpr u32 None = ~0u;
+
+        struct Query
+        {
+            u32 Ticket;
+            glm::vec2 From, To;
+        };
+
+        struct Node
+        {
+            u32 Cell;
+            u32 Cluster;
+            u32 FirstEdge = 0;
+            u32 EdgeCount = 0;
+        };
+
+        /// Intra-cluster edges keep their path: cells after the source up
+        /// to and including the target. Edges to a neighbouring cluster are
+        /// a single step and keep none.
+        struct Edge
+        {
+            u32 To;
+            u32 Cost;
+            u32 PathOffset = 0;
+            u32 PathLength = 0;
+        };
+
+        /// Dijkstra confined to one cluster, indexed by cell within it
+        struct Local
+        {
+            std::vector<u32> Cost;
+            std::vector<u32> Parent;
+            std::vector<u32> Stamp;
+            std::vector<std::pair<u32, u32>> Heap;
+            u32 Pass = 0;
+            u32 Cluster = None;
+
+            u32 CostOf(u32 local) const { return Stamp[local] == Pass ? Cost[local] : None; }
+        };
+
+        struct Scratch
+        {
+            Local Start, Goal;
+            std::vector<u32> Cost, Parent, Stamp;   // Entrance graph, two extra nodes
+            std::vector<std::pair<u32, u32>> Heap;
+            std::vector<u32> Route;
+            std::vector<u32> Cells;
+            std::vector<u32> Corners;
+            u32 Pass = 0;
+        };
+
+        glm::ivec2 CellAt(u32 cell) const { return { static_cast<i32>(cell % m_Width), static_cast<i32>(cell / m_Width) }; }
+        u32 ClusterOf(glm::ivec2 cell) const;
+        void ClusterBounds(u32 cluster, glm::ivec2& min, glm::ivec2& max) const;
+        u32 LocalIndex(u32 cluster, u32 cell) const;
+
+        void Refresh();
+        void Build();
+        void Search(Local& local, u32 cluster, u32 origin) const;
+        void Trace(const Local& local, u32 cell, std::vector<u32>& out) const;
+        bool SearchGraph(Scratch& scratch, u32 startCluster, u32 goalCluster, glm::ivec2 goal) const;
+        PathResult Solve(const Query& query, Scratch& scratch);
+        void Smooth(const std::vector<u32>& cells, glm::vec2 to, Scratch& scratch, std::vector<glm::vec2>& out) const;
+
+        std::unique_ptr<Scratch> AcquireScratch();
+        void ReleaseScratch(std::unique_ptr<Scratch> scratch);
+        void Collect();
+
+        const NavGrid& m_Grid;
+        NavGrid m_Snapshot{ 0, 0 };                 // Walkability as of the build; what searches read
+        JobPool& m_Pool;
+        u32 m_Width = 0, m_Height = 0;
+        u32 m_ClusterSize;
+        u32 m_ClustersX = 0, m_ClustersY = 0;
+        u32 m_BuiltVersion = 0;
+
+        std::vector<u8> m_Steps;                    // Allowed neighbour steps per cell, as of the build
+
+        // Entrance graph; nodes are grouped by cluster
+        std::vector<Node> m_Nodes;
+        std::vector<Edge> m_Edges;
+        std::vector<u32> m_EdgePaths;
+        std::vector<u32> m_ClusterFirst;            // Nodes of cluster c: [c], [c + 1]
+
+        std::unordered_map<u64, std::vector<u32>> m_Cache;
+        std::mutex m_CacheMutex;
+        u32 m_CacheCapacity = 4096;
+
+        std::deque<Query> m_Pending;
+        mutable std::mutex m_PendingMutex;
+        u32 m_NextTicket = 1;
+
+        std::vector<PathResult> m_Finished;
+        std::mutex m_FinishedMutex;
+        std::vector<PathResult> m_Completed;
+        std::atomic<u32> m_InFlight{ 0 };
+
+        std::vector<std::unique_ptr<Scratch>> m_FreeScratch;
+        std::mutex m_ScratchMutex;
+
+        std::atomic<u64> m_Solved{ 0 };
+        std::atomic<u64> m_CacheHits{ 0 };
+        u32 m_Budget = 64;
+        u32 m_BatchSize = 8;
+        bool m_WaitForResults = false;
+    };
+}
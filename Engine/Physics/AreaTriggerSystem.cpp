@@ -0,0 +1,395 @@
+#include "AreaTriggerSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace RiftSpire
+{
+    // Liang-Barsky: does segment ab touch the box?
+    static bool SegmentTouchesBox(glm::vec2 a, glm::vec2 b, glm::vec2 boxMin, glm::vec2 boxMax)
+    {
+        float enter = 0.0f, exit = 1.0f;
+        const glm::vec2 delta = b - a;
+
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            if (delta[axis] == 0.0f)
+            {
+                if (a[axis] < boxMin[axis] || a[axis] > boxMax[axis]) return false;
+                continue;
+            }
+
+            float t0 = (boxMin[axis] - a[axis]) / delta[axis];
+            float t1 = (boxMax[axis] - a[axis]) / delta[axis];
+            if (t0 > t1) std::swap(t0, t1);
+
+            enter = std::max(enter, t0);
+            exit = std::min(exit, t1);
+            if (enter > exit) return false;
+        }
+        return true;
+    }
+
+    // Even-odd rule, so either winding and concave outlines work
+    static bool InsidePolygon(const std::vector<glm::vec2>& corners, float x, float z)
+    {
+        bool inside = false;
+        for (size_t i = 0, j = corners.size() - 1; i < corners.size(); j = i++)
+        {
+            const glm::vec2& a = corners[i];
+            const glm::vec2& b = corners[j];
+            if ((a.y > z) != (b.y > z) && x < (b.x - a.x) * (z - a.y) / (b.y - a.y) + a.x)
+            {
+                inside = !inside;
+            }
+        }
+        return inside;
+    }
+
+    u64 AreaTriggerSystem::CellKey(i32 x, i32 z)
+    {
+        return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u32>(z);
+    }
+
+    bool AreaTriggerSystem::Contains(const Area& area, float x, float z)
+    {
+        if (area.Type == AreaTriggerComponent::Shape::Circle)
+        {
+            const float dx = x - area.Center.x;
+            const float dz = z - area.Center.y;
+            return dx * dx + dz * dz <= area.Radius * area.Radius;
+        }
+        return area.Corners.size() >= 3 && InsidePolygon(area.Corners, x, z);
+    }
+
+    //=========================================================================
+    // Signals
+    //=========================================================================
+
+    void AreaTriggerSystem::Connect(entt::registry& registry)
+    {
+        registry.on_construct<AreaTriggerComponent>().connect<&AreaTriggerSystem::OnAreaAdded>(*this);
+        registry.on_destroy<AreaTriggerComponent>().connect<&AreaTriggerSystem::OnAreaRemoved>(*this);
+        registry.on_destroy<TransformComponent>().connect<&AreaTriggerSystem::OnUnitRemoved>(*this);
+    }
+
+    void AreaTriggerSystem::Disconnect(entt::registry& registry)
+    {
+        registry.on_construct<AreaTriggerComponent>().disconnect<&AreaTriggerSystem::OnAreaAdded>(*this);
+        registry.on_destroy<AreaTriggerComponent>().disconnect<&AreaTriggerSystem::OnAreaRemoved>(*this);
+        registry.on_destroy<TransformComponent>().disconnect<&AreaTriggerSystem::OnUnitRemoved>(*this);
+    }
+
+    void AreaTriggerSystem::OnAreaAdded(entt::registry&, entt::entity entity)
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_AreaOf.size()) m_AreaOf.resize(index + 1, None);
+
+        // Mapped onto cells by the next update
+        m_AreaOf[index] = static_cast<u32>(m_Areas.size());
+        m_Areas.emplace_back().Entity = entity;
+    }
+
+    void AreaTriggerSystem::OnAreaRemoved(entt::registry& registry, entt::entity entity)
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_AreaOf.size() || m_AreaOf[index] == None) return;
+
+        // Still attached while the signal runs; everyone inside leaves
+        const AreaTriggerComponent& component = registry.get<AreaTriggerComponent>(entity);
+        for (entt::entity occupant : component.Occupants)
+        {
+            m_Pending.push_back({ entity, occupant, AreaEvent::Phase::Leave });
+        }
+
+        const u32 slot = m_AreaOf[index];
+        const u32 last = static_cast<u32>(m_Areas.size() - 1);
+        Unregister(slot);
+
+        // Move the last area into the hole and repoint its cells
+        if (slot != last)
+        {
+            for (const Cell& cell : m_Areas[last].Cells)
+            {
+                for (CellArea& entry : m_CellAreas[CellKey(cell.X, cell.Z)])
+                {
+                    if (entry.Area == last) entry.Area = slot;
+                }
+            }
+            m_Areas[slot] = std::move(m_Areas[last]);
+            m_AreaOf[entt::to_entity(m_Areas[slot].Entity)] = slot;
+        }
+
+        m_Areas.pop_back();
+        m_AreaOf[index] = None;
+    }
+
+    void AreaTriggerSystem::OnUnitRemoved(entt::registry& registry, entt::entity entity)
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_Tracked.size() || m_Tracked[index].Entity != entity) return;
+
+        // Only areas covering the unit's last cell can hold it
+        const Tracked& tracked = m_Tracked[index];
+        auto cell = m_CellAreas.find(CellKey(tracked.CellX, tracked.CellZ));
+        if (cell != m_CellAreas.end())
+        {
+            for (const CellArea& entry : cell->second)
+            {
+                AreaTriggerComponent* component = registry.try_get<AreaTriggerComponent>(m_Areas[entry.Area].Entity);
+                if (!component) continue;
+
+                auto it = std::lower_bound(component->Occupants.begin(), component->Occupants.end(), entity);
+                if (it == component->Occupants.end() || *it != entity) continue;
+
+                component->Occupants.erase(it);
+                m_Pending.push_back({ m_Areas[entry.Area].Entity, entity, AreaEvent::Phase::Leave });
+            }
+        }
+
+        m_Tracked[index].Entity = entt::null;
+    }
+
+    //=========================================================================
+    // Cells
+    //=========================================================================
+
+    bool AreaTriggerSystem::NeedsRebuild(const Area& area, const TransformComponent* transform, const SpatialGrid& grid) const
+    {
+        const AreaTriggerComponent& component = *area.Component;
+        const glm::vec3 position = transform ? transform->Position : glm::vec3(0.0f);
+        const float yaw = transform ? transform->Rotation.y : 0.0f;
+
+        return !area.Built || area.Position != position || area.Yaw != yaw || area.CellSize != grid.GetCellSize() ||
+               area.Type != component.Type || area.Radius != component.Radius ||
+               area.HalfExtents != component.HalfExtents || area.Points != component.Points;
+    }
+
+    void AreaTriggerSystem::Unregister(u32 index)
+    {
+        Area& area = m_Areas[index];
+        for (const Cell& cell : area.Cells)
+        {
+            // Emptied lists are kept; the cell is likely to be covered again
+            std::vector<CellArea>& entries = m_CellAreas[CellKey(cell.X, cell.Z)];
+            entries.erase(std::remove_if(entries.begin(), entries.end(), [index](const CellArea& entry) { return entry.Area == index; }), entries.end());
+        }
+        area.Cells.clear();
+    }
+
+    void AreaTriggerSystem::Rebuild(u32 index, const TransformComponent* transform, const SpatialGrid& grid)
+    {
+        Unregister(index);
+
+        Area& area = m_Areas[index];
+        const AreaTriggerComponent& component = *area.Component;
+
+        area.Position = transform ? transform->Position : glm::vec3(0.0f);
+        area.Yaw = transform ? transform->Rotation.y : 0.0f;
+        area.Type = component.Type;
+        area.Radius = component.Radius;
+        area.HalfExtents = component.HalfExtents;
+        area.Points = component.Points;
+        area.CellSize = grid.GetCellSize();
+        area.Built = true;
+
+        area.Center = { area.Position.x, area.Position.z };
+        area.Corners.clear();
+
+        glm::vec2 boundsMin = area.Center - glm::vec2(area.Radius);
+        glm::vec2 boundsMax = area.Center + glm::vec2(area.Radius);
+
+        if (area.Type != AreaTriggerComponent::Shape::Circle)
+        {
+            const glm::vec2 h = area.HalfExtents;
+            const std::vector<glm::vec2> rectangle = { { -h.x, -h.y }, { h.x, -h.y }, { h.x, h.y }, { -h.x, h.y } };
+            const std::vector<glm::vec2>& local = area.Type == AreaTriggerComponent::Shape::Rectangle ? rectangle : area.Points;
+            if (local.size() < 3) return;
+
+            // Same turn as TransformComponent::Rotation.y
+            const float c = std::cos(area.Yaw);
+            const float s = std::sin(area.Yaw);
+            boundsMin = glm::vec2(std::numeric_limits<float>::max());
+            boundsMax = glm::vec2(std::numeric_limits<float>::lowest());
+            for (const glm::vec2& point : local)
+            {
+                const glm::vec2 corner = area.Center + glm::vec2(point.x * c + point.y * s, point.y * c - point.x * s);
+                area.Corners.push_back(corner);
+                boundsMin = glm::min(boundsMin, corner);
+                boundsMax = glm::max(boundsMax, corner);
+            }
+        }
+
+        const float size = area.CellSize;
+        for (i32 z = grid.CellOf(boundsMin.y); z <= grid.CellOf(boundsMax.y); ++z)
+        {
+            for (i32 x = grid.CellOf(boundsMin.x); x <= grid.CellOf(boundsMax.x); ++x)
+            {
+                const glm::vec2 cellMin = glm::vec2(static_cast<float>(x), static_cast<float>(z)) * size;
+                const glm::vec2 cellMax = cellMin + glm::vec2(size);
+
+                bool edge = false;
+                bool inside = false;
+                if (area.Type == AreaTriggerComponent::Shape::Circle)
+                {
+                    const glm::vec2 nearest = glm::clamp(area.Center, cellMin, cellMax);
+                    const glm::vec2 farthest = glm::max(glm::abs(area.Center - cellMin), glm::abs(area.Center - cellMax));
+                    const float radiusSq = area.Radius * area.Radius;
+
+                    if (glm::dot(area.Center - nearest, area.Center - nearest) > radiusSq) continue;
+                    inside = glm::dot(farthest, farthest) <= radiusSq;
+                    edge = !inside;
+                }
+                else
+                {
+                    // No outline segment in the cell: it is wholly in or out
+                    for (size_t i = 0, j = area.Corners.size() - 1; i < area.Corners.size() && !edge; j = i++)
+                    {
+                        edge = SegmentTouchesBox(area.Corners[j], area.Corners[i], cellMin, cellMax);
+                    }
+                    if (!edge)
+                    {
+                        const glm::vec2 center = (cellMin + cellMax) * 0.5f;
+                        if (!InsidePolygon(area.Corners, center.x, center.y)) continue;
+                        inside = true;
+                    }
+                }
+
+                area.Cells.push_back({ x, z, inside });
+                m_CellAreas[CellKey(x, z)].push_back({ index, inside });
+            }
+        }
+    }
+
+    //=========================================================================
+    // Update
+    //=========================================================================
+
+    void AreaTriggerSystem::Evaluate(Area& area, const SpatialGrid::Entry& unit, bool inside)
+    {
+        AreaTriggerComponent& component = *area.Component;
+        const bool accepted = inside && unit.Entity != area.Entity && (component.TeamMask & SpatialFilter::TeamBit(unit.Team));
+
+        auto it = std::lower_bound(component.Occupants.begin(), component.Occupants.end(), unit.Entity);
+        const bool present = it != component.Occupants.end() && *it == unit.Entity;
+        if (accepted == present) return;
+
+        if (accepted)
+        {
+            component.Occupants.insert(it, unit.Entity);
+            m_Events.push_back({ area.Entity, unit.Entity, AreaEvent::Phase::Enter });
+        }
+        else
+        {
+            component.Occupants.erase(it);
+            m_Events.push_back({ area.Entity, unit.Entity, AreaEvent::Phase::Leave });
+        }
+    }
+
+    u32 AreaTriggerSystem::Update(entt::registry& registry, const SpatialGrid& grid)
+    {
+        m_Events.swap(m_Pending);
+        m_Pending.clear();
+
+        auto& components = registry.storage<AreaTriggerComponent>();
+        auto& transforms = registry.storage<TransformComponent>();
+
+        // Areas that moved or changed: remap and recheck everything they cover
+        m_Refreshed.assign(m_Areas.size(), 0);
+        for (u32 i = 0; i < m_Areas.size(); ++i)
+        {
+            Area& area = m_Areas[i];
+            area.Component = &components.get(area.Entity);
+
+            const TransformComponent* transform = transforms.contains(area.Entity) ? &transforms.get(area.Entity) : nullptr;
+            if (!NeedsRebuild(area, transform, grid)) continue;
+
+            Rebuild(i, transform, grid);
+            m_Refreshed[i] = 1;
+
+            m_Scratch = area.Component->Occupants;
+            for (const Cell& cell : area.Cells)
+            {
+                grid.ForEachInCell(cell.X, cell.Z, [&](const SpatialGrid::Entry& unit)
+                {
+                    Evaluate(area, unit, cell.Inside || Contains(area, unit.X, unit.Z));
+                });
+            }
+
+            // Occupants whose cell the area no longer covers
+            for (entt::entity occupant : m_Scratch)
+            {
+                if (const SpatialGrid::Entry* unit = grid.Find(occupant))
+                {
+                    Evaluate(area, *unit, Contains(area, unit->X, unit->Z));
+                }
+            }
+        }
+
+        // Units that changed cell: areas of the old cell may lose them, areas
+        // of the new one may gain them
+        for (entt::entity entity : grid.GetRelinked())
+        {
+            const SpatialGrid::Entry* unit = grid.Find(entity);
+            if (!unit) continue;
+
+            const u32 index = entt::to_entity(entity);
+            if (index >= m_Tracked.size()) m_Tracked.resize(index + 1);
+            Tracked& tracked = m_Tracked[index];
+
+            if (tracked.Entity == entity)
+            {
+                auto cell = m_CellAreas.find(CellKey(tracked.CellX, tracked.CellZ));
+                if (cell != m_CellAreas.end())
+                {
+                    for (const CellArea& entry : cell->second)
+                    {
+                        if (!m_Refreshed[entry.Area]) Evaluate(m_Areas[entry.Area], *unit, Contains(m_Areas[entry.Area], unit->X, unit->Z));
+                    }
+                }
+            }
+
+            auto cell = m_CellAreas.find(CellKey(unit->CellX, unit->CellZ));
+            if (cell != m_CellAreas.end())
+            {
+                for (const CellArea& entry : cell->second)
+                {
+                    if (!m_Refreshed[entry.Area]) Evaluate(m_Areas[entry.Area], *unit, entry.Inside || Contains(m_Areas[entry.Area], unit->X, unit->Z));
+                }
+            }
+
+            tracked = { entity, unit->CellX, unit->CellZ };
+        }
+
+        // Units that stayed in an edge cell may still have crossed the edge
+        for (u32 i = 0; i < m_Areas.size(); ++i)
+        {
+            if (m_Refreshed[i]) continue;
+
+            Area& area = m_Areas[i];
+            for (const Cell& cell : area.Cells)
+            {
+                if (cell.Inside) continue;
+
+                grid.ForEachInCell(cell.X, cell.Z, [&](const SpatialGrid::Entry& unit)
+                {
+                    Evaluate(area, unit, Contains(area, unit.X, unit.Z));
+                });
+            }
+        }
+
+        std::sort(m_Events.begin(), m_Events.end(), [](const AreaEvent& a, const AreaEvent& b)
+        {
+            if (a.Area != b.Area) return entt::to_integral(a.Area) < entt::to_integral(b.Area);
+            if (a.Entity != b.Entity) return entt::to_integral(a.Entity) < entt::to_integral(b.Entity);
+            return a.Type < b.Type;
+        });
+
+        return static_cast<u32>(m_Events.size());
+    }
+
+    SystemAccess AreaTriggerSystem::GetAccess()
+    {
+        return SystemAccess().Read<TransformComponent>().Write<AreaTriggerComponent>().Resource<SpatialGrid>().WriteResource<AreaTriggerSystem>();
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "../ECS/Components.h"
+#include "../ECS/SystemScheduler.h"
+#include "SpatialGrid.h"
+#include <entt/entt.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace RiftSpire
+{
+    struct AreaEvent
+    {
+        enum class Phase : u8 { Enter, Leave };
+
+        entt::entity Area = entt::null;
+        entt::entity Entity = entt::null;
+        Phase Type = Phase::Enter;
+    };
+
+    //=========================================================================
+    // AreaTriggerSystem - Occupancy of AreaTriggerComponent zones
+    //=========================================================================
+
+    /// Each area is mapped onto the spatial grid's cells, split into cells
+    /// it fully covers and cells its edge crosses. A unit only needs testing
+    /// when the grid moved it to another cell or when it stands in an edge
+    /// cell; units deep inside or far outside cost nothing. Areas are
+    /// remapped only when they move, turn or change shape. Events are
+    /// sorted by area, then unit, so the order does not depend on storage
+    /// order. Run after SpatialGrid::Update.
+    class AreaTriggerSystem
+    {
+    public:
+        /// Watch area construction and destruction, and destroyed units
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        /// Returns the number of events
+        u32 Update(entt::registry& registry, const SpatialGrid& grid);
+
+        /// Enter and Leave events since the previous update, including
+        /// Leave for units destroyed in between and for the occupants of
+        /// areas destroyed in between. The scene queues them on the
+        /// EventDispatcher as AreaEnter/AreaLeave (Source area, Target unit).
+        const std::vector<AreaEvent>& GetEvents() const { return m_Events; }
+
+        static SystemAccess GetAccess();
+
+    private:
+        static constexpr u32 None = ~0u;
+
+        struct Cell
+        {
+            i32 X, Z;
+            bool Inside;
+        };
+
+        struct CellArea
+        {
+            u32 Area;
+            bool Inside;
+        };
+
+        struct Area
+        {
+            entt::entity Entity = entt::null;
+            AreaTriggerComponent* Component = nullptr;  // Valid during Update
+
+            // What the cells were built from
+            glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+            float Yaw = 0.0f;
+            AreaTriggerComponent::Shape Type = AreaTriggerComponent::Shape::Circle;
+            float Radius = 0.0f;
+            glm::vec2 HalfExtents = { 0.0f, 0.0f };
+            std::vector<glm::vec2> Points;
+            float CellSize = 0.0f;
+            bool Built = false;
+
+            // World-space shape: center and radius, or polygon corners
+            glm::vec2 Center = { 0.0f, 0.0f };
+            std::vector<glm::vec2> Corners;
+
+            std::vector<Cell> Cells;
+        };
+
+        struct Tracked
+        {
+            entt::entity Entity = entt::null;
+            i32 CellX = 0, CellZ = 0;
+        };
+
+        static u64 CellKey(i32 x, i32 z);
+        static bool Contains(const Area& area, float x, float z);
+
+        void OnAreaAdded(entt::registry& registry, entt::entity entity);
+        void OnAreaRemoved(entt::registry& registry, entt::entity entity);
+        void OnUnitRemoved(entt::registry& registry, entt::entity entity);
+
+        bool NeedsRebuild(const Area& area, const TransformComponent* transform, const SpatialGrid& grid) const;
+        void Rebuild(u32 index, const TransformComponent* transform, const SpatialGrid& grid);
+        void Unregister(u32 index);
+        void Evaluate(Area& area, const SpatialGrid::Entry& unit, bool inside);
+
+        std::vector<Area> m_Areas;
+        std::vector<u32> m_AreaOf;                  // By entity index
+        std::unordered_map<u64, std::vector<CellArea>> m_CellAreas;
+        std::vector<Tracked> m_Tracked;             // Last cell seen per unit, by entity index
+        std::vector<AreaEvent> m_Events;
+        std::vector<AreaEvent> m_Pending;           // From signals between updates
+        std::vector<u8> m_Refreshed;                // Areas remapped this update
+        std::vector<entt::entity> m_Scratch;
+    };
+}
@@ -0,0 +1,252 @@
+#include "CollisionSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace RiftSpire
+{
+    // Squared distance between segments p1 + s * d1 and p2 + t * d2, s and t
+    // in [0, 1] (Ericson, Real-Time Collision Detection 5.1.9)
+    static float SegmentDistanceSq(float p1x, float p1z, float d1x, float d1z, float p2x, float p2z, float d2x, float d2z)
+    {
+        constexpr float Epsilon = 1e-6f;
+
+        const float rx = p1x - p2x, rz = p1z - p2z;
+        const float a = d1x * d1x + d1z * d1z;
+        const float e = d2x * d2x + d2z * d2z;
+        const float f = d2x * rx + d2z * rz;
+
+        float s = 0.0f, t = 0.0f;
+        if (a <= Epsilon && e <= Epsilon)
+        {
+            // Both points
+        }
+        else if (a <= Epsilon)
+        {
+            t = std::clamp(f / e, 0.0f, 1.0f);
+        }
+        else
+        {
+            const float c = d1x * rx + d1z * rz;
+            if (e <= Epsilon)
+            {
+                s = std::clamp(-c / a, 0.0f, 1.0f);
+            }
+            else
+            {
+                const float b = d1x * d2x + d1z * d2z;
+                const float denominator = a * e - b * b;
+                s = denominator != 0.0f ? std::clamp((b * f - c * e) / denominator, 0.0f, 1.0f) : 0.0f;
+                t = (b * s + f) / e;
+
+                if (t < 0.0f)
+                {
+                    t = 0.0f;
+                    s = std::clamp(-c / a, 0.0f, 1.0f);
+                }
+                else if (t > 1.0f)
+                {
+                    t = 1.0f;
+                    s = std::clamp((b - c) / a, 0.0f, 1.0f);
+                }
+            }
+        }
+
+        const float dx = (p1x + d1x * s) - (p2x + d2x * t);
+        const float dz = (p1z + d1z * s) - (p2z + d2z * t);
+        return dx * dx + dz * dz;
+    }
+
+    u64 CollisionSystem::PairKey(entt::entity a, entt::entity b)
+    {
+        const u64 first = entt::to_integral(a);
+        const u64 second = entt::to_integral(b);
+        return first < second ? (first << 32) | second : (second << 32) | first;
+    }
+
+    bool CollisionSystem::Before(const Proxy& a, const Proxy& b)
+    {
+        return a.Min < b.Min || (a.Min == b.Min && entt::to_integral(a.Entity) < entt::to_integral(b.Entity));
+    }
+
+    bool CollisionSystem::Overlaps(const Proxy& a, const Proxy& b)
+    {
+        const float reach = a.Radius + b.Radius;
+        const float distanceSq = SegmentDistanceSq(a.X - a.AxisX, a.Z - a.AxisZ, 2.0f * a.AxisX, 2.0f * a.AxisZ,
+                                                   b.X - b.AxisX, b.Z - b.AxisZ, 2.0f * b.AxisX, 2.0f * b.AxisZ);
+        return distanceSq < reach * reach;
+    }
+
+    void CollisionSystem::Connect(entt::registry& registry)
+    {
+        registry.on_construct<ColliderComponent>().connect<&CollisionSystem::OnColliderAdded>(*this);
+        registry.on_destroy<ColliderComponent>().connect<&CollisionSystem::OnColliderRemoved>(*this);
+    }
+
+    void CollisionSystem::Disconnect(entt::registry& registry)
+    {
+        registry.on_construct<ColliderComponent>().disconnect<&CollisionSystem::OnColliderAdded>(*this);
+        registry.on_destroy<ColliderComponent>().disconnect<&CollisionSystem::OnColliderRemoved>(*this);
+    }
+
+    void CollisionSystem::OnColliderAdded(entt::registry&, entt::entity entity)
+    {
+        // Bounds are filled in by the next Refresh; the sort then moves it into place
+        Proxy proxy{};
+        proxy.Entity = entity;
+        proxy.Min = std::numeric_limits<float>::max();
+        m_Proxies.push_back(proxy);
+    }
+
+    void CollisionSystem::OnColliderRemoved(entt::registry&, entt::entity entity)
+    {
+        // Erase keeps the rest sorted
+        auto it = std::find_if(m_Proxies.begin(), m_Proxies.end(), [entity](const Proxy& proxy) { return proxy.Entity == entity; });
+        if (it != m_Proxies.end()) m_Proxies.erase(it);
+    }
+
+    void CollisionSystem::Refresh(entt::registry& registry)
+    {
+        auto& transforms = registry.storage<TransformComponent>();
+        auto& colliders = registry.storage<ColliderComponent>();
+
+        // Spread of the centers on each axis, to pick the sort axis
+        double sum[2] = { 0.0, 0.0 };
+        double sumSq[2] = { 0.0, 0.0 };
+
+        for (Proxy& proxy : m_Proxies)
+        {
+            const ColliderComponent& collider = colliders.get(proxy.Entity);
+            const glm::vec3 position = transforms.contains(proxy.Entity) ? transforms.get(proxy.Entity).Position : glm::vec3(0.0f);
+
+            proxy.X = position.x;
+            proxy.Z = position.z;
+            proxy.Radius = collider.Radius;
+            proxy.AxisX = 0.0f;
+            proxy.AxisZ = 0.0f;
+
+            if (collider.Type == ColliderComponent::Shape::Capsule && transforms.contains(proxy.Entity))
+            {
+                const float yaw = transforms.get(proxy.Entity).Rotation.y;
+                proxy.AxisX = std::sin(yaw) * collider.HalfLength;
+                proxy.AxisZ = std::cos(yaw) * collider.HalfLength;
+            }
+
+            const float extentX = std::abs(proxy.AxisX) + proxy.Radius;
+            const float extentZ = std::abs(proxy.AxisZ) + proxy.Radius;
+            const float minX = proxy.X - extentX, maxX = proxy.X + extentX;
+            const float minZ = proxy.Z - extentZ, maxZ = proxy.Z + extentZ;
+
+            proxy.Min = m_Axis == 0 ? minX : minZ;
+            proxy.Max = m_Axis == 0 ? maxX : maxZ;
+            proxy.OtherMin = m_Axis == 0 ? minZ : minX;
+            proxy.OtherMax = m_Axis == 0 ? maxZ : maxX;
+
+            sum[0] += proxy.X;
+            sum[1] += proxy.Z;
+            sumSq[0] += static_cast<double>(proxy.X) * proxy.X;
+            sumSq[1] += static_cast<double>(proxy.Z) * proxy.Z;
+        }
+
+        if (m_Proxies.empty()) return;
+
+        // Switch axis only on a clear difference, so the order is not thrown
+        // away every frame when both spreads are similar
+        const double count = static_cast<double>(m_Proxies.size());
+        const double variance[2] = { sumSq[0] / count - (sum[0] / count) * (sum[0] / count),
+                                     sumSq[1] / count - (sum[1] / count) * (sum[1] / count) };
+        const u32 other = 1 - m_Axis;
+        if (variance[other] > variance[m_Axis] * 1.25)
+        {
+            m_Axis = other;
+            for (Proxy& proxy : m_Proxies)
+            {
+                std::swap(proxy.Min, proxy.OtherMin);
+                std::swap(proxy.Max, proxy.OtherMax);
+            }
+
+            // Nothing left of the old order; sort from scratch (in place)
+            std::sort(m_Proxies.begin(), m_Proxies.end(), Before);
+        }
+    }
+
+    void CollisionSystem::Sort()
+    {
+        // Insertion sort: close to linear when bodies moved a little
+        for (size_t i = 1; i < m_Proxies.size(); ++i)
+        {
+            if (!Before(m_Proxies[i], m_Proxies[i - 1])) continue;
+
+            const Proxy proxy = m_Proxies[i];
+            size_t j = i;
+            do
+            {
+                m_Proxies[j] = m_Proxies[j - 1];
+                --j;
+            } while (j > 0 && Before(proxy, m_Proxies[j - 1]));
+            m_Proxies[j] = proxy;
+        }
+    }
+
+    u32 CollisionSystem::Update(entt::registry& registry)
+    {
+        Refresh(registry);
+        Sort();
+
+        // Sweep: each body against the following ones that start before it ends
+        m_PreviousPairs.swap(m_Pairs);
+        m_Pairs.clear();
+
+        const size_t count = m_Proxies.size();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Proxy& a = m_Proxies[i];
+            for (size_t j = i + 1; j < count && m_Proxies[j].Min <= a.Max; ++j)
+            {
+                const Proxy& b = m_Proxies[j];
+                if (b.OtherMin > a.OtherMax || b.OtherMax < a.OtherMin) continue;
+                if (Overlaps(a, b)) m_Pairs.push_back(PairKey(a.Entity, b.Entity));
+            }
+        }
+        std::sort(m_Pairs.begin(), m_Pairs.end());
+
+        // Both lists are sorted: one merge finds what began, stayed and ended
+        m_Events.clear();
+        auto emit = [this](u64 key, CollisionEvent::Phase phase)
+        {
+            m_Events.push_back({ static_cast<entt::entity>(static_cast<entt::id_type>(key >> 32)),
+                                 static_cast<entt::entity>(static_cast<entt::id_type>(key & 0xFFFFFFFFu)), phase });
+        };
+
+        size_t current = 0, previous = 0;
+        while (current < m_Pairs.size() || previous < m_PreviousPairs.size())
+        {
+            if (previous == m_PreviousPairs.size() || (current < m_Pairs.size() && m_Pairs[current] < m_PreviousPairs[previous]))
+            {
+                emit(m_Pairs[current++], CollisionEvent::Phase::Begin);
+            }
+            else if (current == m_Pairs.size() || m_PreviousPairs[previous] < m_Pairs[current])
+            {
+                emit(m_PreviousPairs[previous++], CollisionEvent::Phase::End);
+            }
+            else
+            {
+                if (m_ReportPersist) emit(m_Pairs[current], CollisionEvent::Phase::Persist);
+                current++;
+                previous++;
+            }
+        }
+
+        return static_cast<u32>(m_Pairs.size());
+    }
+
+    bool CollisionSystem::IsTouching(entt::entity a, entt::entity b) const
+    {
+        return std::binary_search(m_Pairs.begin(), m_Pairs.end(), PairKey(a, b));
+    }
+
+    SystemAccess CollisionSystem::GetAccess()
+    {
+        return SystemAccess().Read<TransformComponent, ColliderComponent>().WriteResource<CollisionSystem>();
+    }
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "../ECS/Components.h"
+#include "../ECS/SystemScheduler.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    /// A and B are ordered by entity value. End is also reported when one
+    /// side lost its collider or was destroyed since the last update.
+    struct CollisionEvent
+    {
+        enum class Phase : u8 { Begin, Persist, End };
+
+        entt::entity A = entt::null;
+        entt::entity B = entt::null;
+        Phase Type = Phase::Begin;
+    };
+
+    //=========================================================================
+    // CollisionSystem - Sort-and-sweep broadphase with a pair cache
+    //=========================================================================
+
+    /// Keeps one proxy per ColliderComponent, sorted by the lower edge of
+    /// its bounds on the axis the bodies are most spread along. Bodies move
+    /// little between frames, so an insertion sort restores the order in
+    /// near-linear time; the sweep then only tests bodies whose intervals
+    /// overlap. Overlapping pairs are kept sorted and compared with the
+    /// previous frame's to report Begin, Persist and End. Ties are broken
+    /// by entity, so results do not depend on insertion history, and
+    /// buffers only grow (no allocation once warmed up).
+    class CollisionSystem
+    {
+    public:
+        /// Watch ColliderComponent construction and destruction
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        /// Returns how many pairs overlap
+        u32 Update(entt::registry& registry);
+
+        /// Events from the last update, in pair order. Persist events can
+        /// be turned off when only changes matter. The scene queues them on
+        /// the EventDispatcher as CollisionBegin/Stay/End (Source A, Target B).
+        const std::vector<CollisionEvent>& GetEvents() const { return m_Events; }
+        void SetReportPersist(bool report) { m_ReportPersist = report; }
+
+        bool IsTouching(entt::entity a, entt::entity b) const;
+
+        static SystemAccess GetAccess();
+
+    private:
+        struct Proxy
+        {
+            entt::entity Entity;
+            float Min, Max;                 // Bounds on the sort axis
+            float OtherMin, OtherMax;       // Bounds on the other axis
+            float X, Z;                     // Center
+            float AxisX, AxisZ;             // Capsule half segment
+            float Radius;
+        };
+
+        static u64 PairKey(entt::entity a, entt::entity b);
+        static bool Before(const Proxy& a, const Proxy& b);
+        static bool Overlaps(const Proxy& a, const Proxy& b);
+
+        void OnColliderAdded(entt::registry& registry, entt::entity entity);
+        void OnColliderRemoved(entt::registry& registry, entt::entity entity);
+
+        void Refresh(entt::registry& registry);
+        void Sort();
+
+        std::vector<Proxy> m_Proxies;
+        std::vector<u64> m_Pairs;
+        std::vector<u64> m_PreviousPairs;
+        std::vector<CollisionEvent> m_Events;
+        u32 m_Axis = 0;                     // 0 = X, 1 = Z
+        bool m_ReportPersist = true;
+    };
+}
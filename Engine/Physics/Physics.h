@@ -1,8 +1,7 @@
-// Physics module placeholder
+// Physics module
 #pragma once
 
-namespace RiftSpire
-{
-    // Physics system will be implemented here
-    // For MOBA: collision detection, projectiles, area effects
-}
+#include "SpatialGrid.h"
+#include "CollisionSystem.h"
+#include "AreaTriggerSystem.h"
+#include "ProjectileSystem.h"
@@ -0,0 +1,253 @@
+#include "ProjectileSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RiftSpire
+{
+    // Earliest fraction t in [0, 1] at which p + t * d comes within radius
+    // of c, or -1 if it never does
+    static float SweepCircle(float px, float pz, float dx, float dz, float cx, float cz, float radius)
+    {
+        const float fx = px - cx, fz = pz - cz;
+        const float c = fx * fx + fz * fz - radius * radius;
+        if (c <= 0.0f) return 0.0f;
+
+        const float a = dx * dx + dz * dz;
+        const float b = fx * dx + fz * dz;
+        if (a <= 1e-12f || b >= 0.0f) return -1.0f;
+
+        const float discriminant = b * b - a * c;
+        if (discriminant < 0.0f) return -1.0f;
+
+        const float t = (-b - std::sqrt(discriminant)) / a;
+        return t <= 1.0f ? t : -1.0f;
+    }
+
+    // Capsules are tested as their bounding circle
+    static float TargetRadius(const ColliderComponent* collider)
+    {
+        if (!collider) return 0.0f;
+        return collider->Type == ColliderComponent::Shape::Capsule ? collider->Radius + collider->HalfLength : collider->Radius;
+    }
+
+    template<typename T>
+    static void SwapRemove(std::vector<T>& column, u32 slot)
+    {
+        if (slot + 1 != column.size()) column[slot] = std::move(column.back());
+        column.pop_back();
+    }
+
+    void ProjectileSystem::Reserve(entt::registry& registry, u32 count)
+    {
+        for (u32 i = 0; i < count; ++i)
+        {
+            const entt::entity entity = registry.create();
+            registry.emplace<ProjectileComponent>(entity);
+            m_FreeVisuals.push_back(entity);
+        }
+    }
+
+    u32 ProjectileSystem::Spawn(entt::registry& registry, const ProjectileDesc& desc)
+    {
+        const u32 id = m_NextId++;
+
+        const float length = glm::length(desc.Direction);
+        const glm::vec2 direction = length > 0.0f ? desc.Direction / length : glm::vec2(0.0f, 1.0f);
+
+        // Pooled entities destroyed from outside are dropped
+        entt::entity visual = entt::null;
+        while (!m_FreeVisuals.empty() && visual == entt::null)
+        {
+            if (registry.valid(m_FreeVisuals.back())) visual = m_FreeVisuals.back();
+            m_FreeVisuals.pop_back();
+        }
+        if (visual == entt::null)
+        {
+            visual = registry.create();
+            registry.emplace<ProjectileComponent>(visual);
+        }
+
+        ProjectileComponent& component = registry.get_or_emplace<ProjectileComponent>(visual);
+        component.Position = desc.Position;
+        component.Direction = { direction.x, 0.0f, direction.y };
+        component.Id = id;
+        component.Active = true;
+
+        SpatialFilter filter = desc.Filter;
+        filter.Exclude = desc.Owner;
+
+        m_Ids.push_back(id);
+        m_X.push_back(desc.Position.x);
+        m_Y.push_back(desc.Position.y);
+        m_Z.push_back(desc.Position.z);
+        m_DirectionX.push_back(direction.x);
+        m_DirectionZ.push_back(direction.y);
+        m_Speed.push_back(desc.Speed);
+        m_Radius.push_back(desc.Radius);
+        m_Remaining.push_back(desc.Lifetime);
+        m_Pierce.push_back(desc.Pierce);
+        m_Owner.push_back(desc.Owner);
+        m_Visual.push_back(visual);
+        m_Filter.push_back(filter);
+
+        if (m_FreeHitLists.empty())
+        {
+            m_HitTargets.emplace_back();
+        }
+        else
+        {
+            m_HitTargets.push_back(std::move(m_FreeHitLists.back()));
+            m_FreeHitLists.pop_back();
+        }
+
+        return id;
+    }
+
+    void ProjectileSystem::Release(entt::registry& registry, u32 slot)
+    {
+        const entt::entity visual = m_Visual[slot];
+        if (registry.valid(visual))
+        {
+            if (ProjectileComponent* component = registry.try_get<ProjectileComponent>(visual)) component->Active = false;
+            m_FreeVisuals.push_back(visual);
+        }
+
+        // Readable until the next update, for this update's event handlers
+        m_FinishedIds.push_back(m_Ids[slot]);
+        m_FinishedHitLists.push_back(std::move(m_HitTargets[slot]));
+
+        SwapRemove(m_Ids, slot);
+        SwapRemove(m_X, slot);
+        SwapRemove(m_Y, slot);
+        SwapRemove(m_Z, slot);
+        SwapRemove(m_DirectionX, slot);
+        SwapRemove(m_DirectionZ, slot);
+        SwapRemove(m_Speed, slot);
+        SwapRemove(m_Radius, slot);
+        SwapRemove(m_Remaining, slot);
+        SwapRemove(m_Pierce, slot);
+        SwapRemove(m_Owner, slot);
+        SwapRemove(m_Visual, slot);
+        SwapRemove(m_Filter, slot);
+        SwapRemove(m_HitTargets, slot);
+    }
+
+    u32 ProjectileSystem::Update(entt::registry& registry, const SpatialGrid& grid, float deltaTime)
+    {
+        m_Events.clear();
+
+        for (std::vector<entt::entity>& hits : m_FinishedHitLists)
+        {
+            hits.clear();
+            m_FreeHitLists.push_back(std::move(hits));
+        }
+        m_FinishedHitLists.clear();
+        m_FinishedIds.clear();
+
+        const u32 count = GetCount();
+        if (count == 0) return 0;
+
+        // Colliders can be resized by direct writes, so the widest is
+        // looked up again every update rather than tracked through signals
+        float maxTargetRadius = 0.0f;
+        registry.view<const ColliderComponent>().each([&](const ColliderComponent& collider)
+        {
+            maxTargetRadius = std::max(maxTargetRadius, TargetRadius(&collider));
+        });
+
+        // Broadphase: one box per projectile around its whole path this tick
+        m_Queries.resize(count);
+        for (u32 i = 0; i < count; ++i)
+        {
+            const float travel = m_Speed[i] * std::min(deltaTime, m_Remaining[i]);
+            const float margin = m_Radius[i] + maxTargetRadius;
+            const glm::vec2 direction = { m_DirectionX[i], m_DirectionZ[i] };
+            const glm::vec2 center = glm::vec2(m_X[i], m_Z[i]) + direction * (travel * 0.5f);
+
+            m_Queries[i] = SpatialQuery::Box(center, direction, { margin, travel * 0.5f + margin }, m_Filter[i]);
+        }
+        grid.Query(m_Queries.data(), count, m_Results);
+
+        auto& colliders = registry.storage<ColliderComponent>();
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            const float travel = m_Speed[i] * std::min(deltaTime, m_Remaining[i]);
+            const float dx = m_DirectionX[i] * travel;
+            const float dz = m_DirectionZ[i] * travel;
+            std::vector<entt::entity>& hits = m_HitTargets[i];
+
+            // Narrowphase: swept circle against each target, positions as the grid has them
+            m_Candidates.clear();
+            const entt::entity* found = m_Results.GetBegin(i);
+            for (u32 j = 0, n = m_Results.GetCount(i); j < n; ++j)
+            {
+                const SpatialGrid::Entry* target = grid.Find(found[j]);
+                if (!target || std::find(hits.begin(), hits.end(), found[j]) != hits.end()) continue;
+
+                const float radius = m_Radius[i] + TargetRadius(colliders.contains(found[j]) ? &colliders.get(found[j]) : nullptr);
+                const float time = SweepCircle(m_X[i], m_Z[i], dx, dz, target->X, target->Z, radius);
+                if (time >= 0.0f) m_Candidates.push_back({ time, found[j] });
+            }
+
+            std::sort(m_Candidates.begin(), m_Candidates.end(), [](const Candidate& a, const Candidate& b)
+            {
+                return a.Time != b.Time ? a.Time < b.Time : a.Target < b.Target;
+            });
+
+            // Hits in path order until the pierce count runs out
+            float reached = 1.0f;
+            bool stopped = false;
+            for (const Candidate& candidate : m_Candidates)
+            {
+                hits.push_back(candidate.Target);
+                m_Events.push_back({ EventType::AbilityHit, m_Ids[i], m_Owner[i], candidate.Target,
+                                     { m_X[i] + dx * candidate.Time, m_Y[i], m_Z[i] + dz * candidate.Time } });
+
+                if (m_Pierce[i] == 0)
+                {
+                    reached = candidate.Time;
+                    stopped = true;
+                    break;
+                }
+                m_Pierce[i]--;
+            }
+
+            m_X[i] += dx * reached;
+            m_Z[i] += dz * reached;
+            m_Remaining[i] = stopped ? 0.0f : m_Remaining[i] - deltaTime;
+
+            if (!stopped && m_Remaining[i] <= 0.0f && hits.empty())
+            {
+                m_Events.push_back({ EventType::AbilityMiss, m_Ids[i], m_Owner[i], entt::null, { m_X[i], m_Y[i], m_Z[i] } });
+            }
+
+            if (registry.valid(m_Visual[i]))
+            {
+                if (ProjectileComponent* component = registry.try_get<ProjectileComponent>(m_Visual[i])) component->Position = { m_X[i], m_Y[i], m_Z[i] };
+            }
+        }
+
+        // Back to front, so every projectile swapped in has been handled already
+        for (u32 i = count; i-- > 0;)
+        {
+            if (m_Remaining[i] <= 0.0f) Release(registry, i);
+        }
+
+        return GetCount();
+    }
+
+    const std::vector<entt::entity>* ProjectileSystem::GetHitTargets(u32 projectile) const
+    {
+        const auto it = std::find(m_Ids.begin(), m_Ids.end(), projectile);
+        if (it != m_Ids.end()) return &m_HitTargets[it - m_Ids.begin()];
+
+        const auto finished = std::find(m_FinishedIds.begin(), m_FinishedIds.end(), projectile);
+        return finished != m_FinishedIds.end() ? &m_FinishedHitLists[finished - m_FinishedIds.begin()] : nullptr;
+    }
+
+    SystemAccess ProjectileSystem::GetAccess()
+    {
+        return SystemAccess().Read<ColliderComponent>().Write<ProjectileComponent>().Resource<SpatialGrid>().WriteResource<ProjectileSystem>();
+    }
+}
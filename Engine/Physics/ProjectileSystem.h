@@ -0,0 +1,111 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "../ECS/Components.h"
+#include "../ECS/SystemScheduler.h"
+#include "../Scripting/Execution/EventSystem.h"
+#include "SpatialGrid.h"
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    struct ProjectileDesc
+    {
+        entt::entity Owner = entt::null;
+        glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+        glm::vec2 Direction = { 0.0f, 1.0f };       // X/Z, normalized on spawn
+        float Speed = 1500.0f;
+        float Radius = 30.0f;
+        float Lifetime = 1.0f;                      // Seconds; range is Speed * Lifetime
+        u32 Pierce = 0;                             // Extra targets after the first
+        SpatialFilter Filter;                       // Owner is always excluded
+    };
+
+    /// AbilityHit for every target struck, AbilityMiss when a projectile
+    /// expires without hitting anything
+    struct ProjectileEvent
+    {
+        EventType Type = EventType::AbilityHit;
+        u32 Projectile = 0;
+        entt::entity Owner = entt::null;
+        entt::entity Target = entt::null;
+        glm::vec3 Position = { 0.0f, 0.0f, 0.0f };
+    };
+
+    //=========================================================================
+    // ProjectileSystem - Swept skillshots against the spatial grid
+    //=========================================================================
+
+    /// Live projectiles are kept packed in parallel arrays. Each update
+    /// moves every projectile along a segment and tests the whole segment,
+    /// not just its end point, against targets found by one batched grid
+    /// query, so fast thin projectiles cannot tunnel through targets between
+    /// ticks. Targets are circles of their ColliderComponent radius (points
+    /// without one); the broadphase is widened by the widest collider in
+    /// the registry. Hits along a segment are taken in order of distance,
+    /// then entity, and each target is hit at most once per projectile
+    /// (HitTargets, mirrored into AbilityContext::HitTargets by the ability
+    /// code). Visual entities carry a ProjectileComponent and are recycled;
+    /// the simulation itself never touches entity storage structurally.
+    class ProjectileSystem
+    {
+    public:
+        /// Create pooled visual entities up front, so Spawn() does not
+        /// have to create any
+        void Reserve(entt::registry& registry, u32 count);
+
+        /// Not thread-safe: call between updates (or through a command
+        /// buffer). Creates a visual entity only when the pool is empty.
+        u32 Spawn(entt::registry& registry, const ProjectileDesc& desc);
+
+        /// Returns how many projectiles are still flying
+        u32 Update(entt::registry& registry, const SpatialGrid& grid, float deltaTime);
+
+        /// Events from the last update. The scene queues them on the
+        /// EventDispatcher (Source owner, InstanceId the projectile).
+        const std::vector<ProjectileEvent>& GetEvents() const { return m_Events; }
+
+        /// Targets already hit, in hit order, by a live projectile or by one
+        /// that finished in the last update (kept until the next update)
+        const std::vector<entt::entity>* GetHitTargets(u32 projectile) const;
+
+        u32 GetCount() const { return static_cast<u32>(m_Ids.size()); }
+
+        static SystemAccess GetAccess();
+
+    private:
+        struct Candidate
+        {
+            float Time;
+            entt::entity Target;
+        };
+
+        void Release(entt::registry& registry, u32 slot);
+
+        // One entry per live projectile, same index in every array
+        std::vector<u32> m_Ids;
+        std::vector<float> m_X, m_Y, m_Z;
+        std::vector<float> m_DirectionX, m_DirectionZ;
+        std::vector<float> m_Speed;
+        std::vector<float> m_Radius;
+        std::vector<float> m_Remaining;
+        std::vector<u32> m_Pierce;
+        std::vector<entt::entity> m_Owner;
+        std::vector<entt::entity> m_Visual;
+        std::vector<SpatialFilter> m_Filter;
+        std::vector<std::vector<entt::entity>> m_HitTargets;
+
+        std::vector<u32> m_FinishedIds;                         // Released in the last update
+        std::vector<std::vector<entt::entity>> m_FinishedHitLists;
+        std::vector<std::vector<entt::entity>> m_FreeHitLists;  // Keep their capacity
+        std::vector<entt::entity> m_FreeVisuals;
+
+        std::vector<SpatialQuery> m_Queries;
+        SpatialResults m_Results;
+        std::vector<Candidate> m_Candidates;
+        std::vector<ProjectileEvent> m_Events;
+
+        u32 m_NextId = 1;
+    };
+}
@@ -0,0 +1,262 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // SpatialQuery
+    //=========================================================================
+
+    SpatialQuery SpatialQuery::Circle(glm::vec2 center, float radius, const SpatialFilter& filter)
+    {
+        SpatialQuery query;
+        query.Type = Shape::Circle;
+        query.Center = center;
+        query.Range = radius;
+        query.Filter = filter;
+        return query;
+    }
+
+    SpatialQuery SpatialQuery::Cone(glm::vec2 center, glm::vec2 direction, float range, float halfAngle, const SpatialFilter& filter)
+    {
+        SpatialQuery query;
+        query.Type = Shape::Cone;
+        query.Center = center;
+        query.Direction = direction;
+        query.Range = range;
+        query.CosHalfAngle = std::cos(halfAngle);
+        query.Filter = filter;
+        return query;
+    }
+
+    SpatialQuery SpatialQuery::Box(glm::vec2 center, glm::vec2 direction, glm::vec2 halfExtents, const SpatialFilter& filter)
+    {
+        SpatialQuery query;
+        query.Type = Shape::Box;
+        query.Center = center;
+        query.Direction = direction;
+        query.HalfExtents = halfExtents;
+        query.Filter = filter;
+        return query;
+    }
+
+    // Point test against the query shape, offset from its center
+    static bool Contains(const SpatialQuery& query, float dx, float dz)
+    {
+        const float distanceSq = dx * dx + dz * dz;
+        const float along = dx * query.Direction.x + dz * query.Direction.y;
+
+        switch (query.Type)
+        {
+        case SpatialQuery::Shape::Circle:
+            return distanceSq <= query.Range * query.Range;
+
+        case SpatialQuery::Shape::Cone:
+        {
+            if (distanceSq > query.Range * query.Range) return false;
+
+            // along >= cos * |d|, squared to avoid the root
+            const float threshold = query.CosHalfAngle * query.CosHalfAngle * distanceSq;
+            return query.CosHalfAngle >= 0.0f ? along >= 0.0f && along * along >= threshold
+                                              : along >= 0.0f || along * along <= threshold;
+        }
+
+        case SpatialQuery::Shape::Box:
+        {
+            const float across = dx * query.Direction.y - dz * query.Direction.x;
+            return std::abs(along) <= query.HalfExtents.y && std::abs(across) <= query.HalfExtents.x;
+        }
+        }
+        return false;
+    }
+
+    static float ReachOf(const SpatialQuery& query)
+    {
+        return query.Type == SpatialQuery::Shape::Box ? glm::length(query.HalfExtents) : query.Range;
+    }
+
+    //=========================================================================
+    // SpatialGrid
+    //=========================================================================
+
+    SpatialGrid::SpatialGrid(float cellSize, u32 bucketCount)
+        : m_CellSize(cellSize), m_InverseCellSize(1.0f / cellSize)
+    {
+        u32 buckets = 1;
+        while (buckets < bucketCount) buckets <<= 1;
+
+        m_BucketMask = buckets - 1;
+        m_Buckets.resize(buckets);
+    }
+
+    void SpatialGrid::Connect(entt::registry& registry)
+    {
+        registry.on_destroy<TransformComponent>().connect<&SpatialGrid::OnTransformDestroyed>(*this);
+    }
+
+    void SpatialGrid::Disconnect(entt::registry& registry)
+    {
+        registry.on_destroy<TransformComponent>().disconnect<&SpatialGrid::OnTransformDestroyed>(*this);
+    }
+
+    void SpatialGrid::OnTransformDestroyed(entt::registry&, entt::entity entity)
+    {
+        Remove(entity);
+    }
+
+    i32 SpatialGrid::CellOf(float coordinate) const
+    {
+        return static_cast<i32>(std::floor(coordinate * m_InverseCellSize));
+    }
+
+    u32 SpatialGrid::BucketOf(i32 cellX, i32 cellZ) const
+    {
+        return (static_cast<u32>(cellX) * 73856093u ^ static_cast<u32>(cellZ) * 19349663u) & m_BucketMask;
+    }
+
+    void SpatialGrid::Insert(entt::entity entity, float x, float z, u8 team)
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_Locations.size()) m_Locations.resize(index + 1);
+
+        const i32 cellX = CellOf(x);
+        const i32 cellZ = CellOf(z);
+        const u32 bucket = BucketOf(cellX, cellZ);
+
+        m_Locations[index] = { bucket, static_cast<u32>(m_Buckets[bucket].size()) };
+        m_Buckets[bucket].push_back({ entity, x, z, cellX, cellZ, team });
+        m_Size++;
+    }
+
+    void SpatialGrid::Remove(entt::entity entity)
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_Locations.size() || m_Locations[index].Bucket == None) return;
+
+        Location& location = m_Locations[index];
+        std::vector<Entry>& bucket = m_Buckets[location.Bucket];
+        if (bucket[location.Slot].Entity != entity) return;
+
+        // Swap with the last entry of the bucket
+        bucket[location.Slot] = bucket.back();
+        m_Locations[entt::to_entity(bucket[location.Slot].Entity)].Slot = location.Slot;
+        bucket.pop_back();
+
+        location.Bucket = None;
+        m_Size--;
+    }
+
+    const SpatialGrid::Entry* SpatialGrid::Find(entt::entity entity) const
+    {
+        const u32 index = entt::to_entity(entity);
+        if (index >= m_Locations.size() || m_Locations[index].Bucket == None) return nullptr;
+
+        const Entry& entry = m_Buckets[m_Locations[index].Bucket][m_Locations[index].Slot];
+        return entry.Entity == entity ? &entry : nullptr;
+    }
+
+    u32 SpatialGrid::Update(entt::registry& registry)
+    {
+        auto& teams = registry.storage<TeamComponent>();
+        m_Relinked.clear();
+
+        registry.view<TransformComponent>().each([&](entt::entity entity, const TransformComponent& transform)
+        {
+            const float x = transform.Position.x;
+            const float z = transform.Position.z;
+            const u8 team = teams.contains(entity) ? teams.get(entity).TeamId : SpatialFilter::NoTeam;
+
+            const u32 index = entt::to_entity(entity);
+            if (index < m_Locations.size() && m_Locations[index].Bucket != None)
+            {
+                const Location location = m_Locations[index];
+                Entry& entry = m_Buckets[location.Bucket][location.Slot];
+                if (entry.Entity == entity && entry.CellX == CellOf(x) && entry.CellZ == CellOf(z))
+                {
+                    entry.X = x;
+                    entry.Z = z;
+                    entry.Team = team;
+                    return;
+                }
+                Remove(entry.Entity);
+            }
+
+            Insert(entity, x, z, team);
+            m_Relinked.push_back(entity);
+        });
+
+        return static_cast<u32>(m_Relinked.size());
+    }
+
+    template<typename Visit>
+    void SpatialGrid::ForEachInRange(const SpatialQuery& query, float reach, Visit&& visit) const
+    {
+        const i32 minX = CellOf(query.Center.x - reach);
+        const i32 maxX = CellOf(query.Center.x + reach);
+        const i32 minZ = CellOf(query.Center.y - reach);
+        const i32 maxZ = CellOf(query.Center.y + reach);
+
+        // Cells sharing a bucket are told apart by the cell stored in each entry
+        const u64 cells = static_cast<u64>(maxX - minX + 1) * static_cast<u64>(maxZ - minZ + 1);
+        if (cells > m_Buckets.size())
+        {
+            // Range covers more cells than there are buckets: one pass over everything
+            for (const std::vector<Entry>& bucket : m_Buckets)
+            {
+                for (const Entry& entry : bucket)
+                {
+                    if (entry.CellX >= minX && entry.CellX <= maxX && entry.CellZ >= minZ && entry.CellZ <= maxZ) visit(entry);
+                }
+            }
+            return;
+        }
+
+        for (i32 cellZ = minZ; cellZ <= maxZ; ++cellZ)
+        {
+            for (i32 cellX = minX; cellX <= maxX; ++cellX)
+            {
+                ForEachInCell(cellX, cellZ, visit);
+            }
+        }
+    }
+
+    void SpatialGrid::Query(const SpatialQuery* queries, u32 count, SpatialResults& results) const
+    {
+        results.Entities.clear();
+        results.Offsets.clear();
+        results.Offsets.push_back(0);
+
+        for (u32 i = 0; i < count; ++i)
+        {
+            const SpatialQuery& query = queries[i];
+            ForEachInRange(query, ReachOf(query), [&](const Entry& entry)
+            {
+                if (Contains(query, entry.X - query.Center.x, entry.Z - query.Center.y) && query.Filter.Accepts(entry.Entity, entry.Team))
+                {
+                    results.Entities.push_back(entry.Entity);
+                }
+            });
+            results.Offsets.push_back(static_cast<u32>(results.Entities.size()));
+        }
+    }
+
+    u32 SpatialGrid::Query(const SpatialQuery& query, entt::entity* out, u32 capacity) const
+    {
+        u32 found = 0;
+        ForEachInRange(query, ReachOf(query), [&](const Entry& entry)
+        {
+            if (Contains(query, entry.X - query.Center.x, entry.Z - query.Center.y) && query.Filter.Accepts(entry.Entity, entry.Team))
+            {
+                if (found < capacity) out[found] = entry.Entity;
+                found++;
+            }
+        });
+        return found;
+    }
+
+    SystemAccess SpatialGrid::GetAccess()
+    {
+        return SystemAccess().Read<TransformComponent, TeamComponent>().WriteResource<SpatialGrid>();
+    }
+}
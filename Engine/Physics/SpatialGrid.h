@@ -0,0 +1,163 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "../ECS/Components.h"
+#include "../ECS/SystemScheduler.h"
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // SpatialFilter - Which entities a query accepts
+    //=========================================================================
+
+    struct SpatialFilter
+    {
+        /// Team bit used for entities without a TeamComponent
+        static constexpr u8 NoTeam = 31;
+
+        u32 TeamMask = ~0u;                         // Bit per TeamComponent::TeamId
+        entt::entity Exclude = entt::null;          // Usually the caster
+        const entt::sparse_set* Require = nullptr;  // registry.storage<T>() the entity must be in
+        const entt::sparse_set* Forbid = nullptr;   // registry.storage<T>() the entity must not be in
+
+        static u32 TeamBit(u8 team) { return 1u << (team < NoTeam ? team : NoTeam); }
+
+        /// Every team except `team` (and entities without one)
+        static SpatialFilter EnemiesOf(u8 team)
+        {
+            SpatialFilter filter;
+            filter.TeamMask = ~TeamBit(team) & ~TeamBit(NoTeam);
+            return filter;
+        }
+
+        bool Accepts(entt::entity entity, u8 team) const
+        {
+            return (TeamMask & TeamBit(team)) && entity != Exclude &&
+                   (!Require || Require->contains(entity)) && (!Forbid || !Forbid->contains(entity));
+        }
+    };
+
+    //=========================================================================
+    // SpatialQuery - Circle, cone or oriented box on the X/Z plane
+    //=========================================================================
+
+    struct SpatialQuery
+    {
+        enum class Shape : u8 { Circle, Cone, Box };
+
+        Shape Type = Shape::Circle;
+        glm::vec2 Center = { 0.0f, 0.0f };
+        glm::vec2 Direction = { 0.0f, 1.0f };      // Unit length; cone axis or box forward
+        float Range = 0.0f;                         // Circle and cone radius
+        float CosHalfAngle = 1.0f;                  // Cone
+        glm::vec2 HalfExtents = { 0.0f, 0.0f };     // Box: x across, y along Direction
+        SpatialFilter Filter;
+
+        static SpatialQuery Circle(glm::vec2 center, float radius, const SpatialFilter& filter = {});
+        static SpatialQuery Cone(glm::vec2 center, glm::vec2 direction, float range, float halfAngle, const SpatialFilter& filter = {});
+        static SpatialQuery Box(glm::vec2 center, glm::vec2 direction, glm::vec2 halfExtents, const SpatialFilter& filter = {});
+    };
+
+    /// Results of a batch: query i found Entities[Offsets[i]] up to
+    /// Entities[Offsets[i + 1]]. Keep one around; it stops allocating once
+    /// it has grown to the largest batch.
+    struct SpatialResults
+    {
+        std::vector<entt::entity> Entities;
+        std::vector<u32> Offsets;
+
+        u32 GetCount(u32 query) const { return Offsets[query + 1] - Offsets[query]; }
+        const entt::entity* GetBegin(u32 query) const { return Entities.data() + Offsets[query]; }
+    };
+
+    //=========================================================================
+    // SpatialGrid - Uniform hash grid over TransformComponent X/Z
+    //=========================================================================
+
+    /// Every TransformComponent entity lives in the bucket of its cell, with
+    /// a copy of its X/Z position and team, so queries never touch the
+    /// registry except for component filters. Update() refreshes positions
+    /// in place and only relinks entities that moved to another cell. Cells
+    /// are hashed into a fixed number of buckets, so the map needs no
+    /// bounds. Systems that query the grid declare Resource<SpatialGrid>() so
+    /// they never overlap its update.
+    class SpatialGrid
+    {
+    public:
+        explicit SpatialGrid(float cellSize = 500.0f, u32 bucketCount = 4096);
+
+        /// Watch TransformComponent destruction
+        void Connect(entt::registry& registry);
+        void Disconnect(entt::registry& registry);
+
+        /// Returns how many entities were inserted or changed cell
+        u32 Update(entt::registry& registry);
+
+        /// Run queries in order, replacing the contents of results
+        void Query(const SpatialQuery* queries, u32 count, SpatialResults& results) const;
+
+        /// Write up to `capacity` matches to out; returns the number of
+        /// matches, which may be larger
+        u32 Query(const SpatialQuery& query, entt::entity* out, u32 capacity) const;
+
+        /// Position, cell and team as of the last update
+        struct Entry
+        {
+            entt::entity Entity;
+            float X, Z;
+            i32 CellX, CellZ;
+            u8 Team;
+        };
+
+        /// Entities inserted or moved to another cell by the last update
+        const std::vector<entt::entity>& GetRelinked() const { return m_Relinked; }
+
+        /// Null if the entity is not in the grid
+        const Entry* Find(entt::entity entity) const;
+
+        /// Visit every entry of one cell
+        template<typename Visit>
+        void ForEachInCell(i32 cellX, i32 cellZ, Visit&& visit) const
+        {
+            for (const Entry& entry : m_Buckets[BucketOf(cellX, cellZ)])
+            {
+                if (entry.CellX == cellX && entry.CellZ == cellZ) visit(entry);
+            }
+        }
+
+        i32 CellOf(float coordinate) const;
+        size_t GetSize() const { return m_Size; }
+        float GetCellSize() const { return m_CellSize; }
+
+        static SystemAccess GetAccess();
+
+    private:
+        static constexpr u32 None = ~0u;
+
+        struct Location
+        {
+            u32 Bucket = None;
+            u32 Slot = 0;
+        };
+
+        u32 BucketOf(i32 cellX, i32 cellZ) const;
+
+        void Insert(entt::entity entity, float x, float z, u8 team);
+        void Remove(entt::entity entity);
+        void OnTransformDestroyed(entt::registry& registry, entt::entity entity);
+
+        template<typename Visit>
+        void ForEachInRange(const SpatialQuery& query, float reach, Visit&& visit) const;
+
+        float m_CellSize;
+        float m_InverseCellSize;
+        u32 m_BucketMask;
+        std::vector<std::vector<Entry>> m_Buckets;
+        std::vector<Location> m_Locations;          // By entity index
+        std::vector<entt::entity> m_Relinked;
+        size_t m_Size = 0;
+    };
+}
@@ -6,23 +6,22 @@ namespace RiftSpire
 {
     static ScriptVM s_ControlVM;
     
-    void RegisterControlFlowBlocks()
+    static constexpr StaticBlockDefinition s_ControlFlowBlocks[] =
     {
-        auto& registry = BlockRegistry::Get();
-        
         //=====================================================================
         // Conditional Blocks
         //=====================================================================
         
-        registry.DefineBlock("control.if")
-            .DisplayName("If")
-            .Description("Execute blocks if condition is true")
-            .Icon("❓")
-            .Shape(BlockShape::ConditionalNested)
-            .Category(BlockCategory::ControlFlow)
-            .Input("condition", ValueType::Bool, Value(true))
-            .NestedBody("then")
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.if",
+            .DisplayName = "If",
+            .Description = "Execute blocks if condition is true",
+            .Icon = "❓",
+            .Shape = BlockShape::ConditionalNested,
+            .Category = BlockCategory::ControlFlow,
+            .Inputs = {{ { "condition", ValueType::Bool, StaticValue::Bool(true) } }},
+            .NestedBodies = { "then" },
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 Value condition = s_ControlVM.GetSlotValue(block->GetInputSlot("condition"), ctx);
                 
                 if (condition.AsBool())
@@ -34,19 +33,19 @@ namespace RiftSpire
                 }
                 
                 return Value();
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.if_else")
-            .DisplayName("If-Else")
-            .Description("Execute different blocks based on condition")
-            .Icon("❓")
-            .Shape(BlockShape::MultiNested)
-            .Category(BlockCategory::ControlFlow)
-            .Input("condition", ValueType::Bool, Value(true))
-            .NestedBody("then")
-            .NestedBody("else")
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.if_else",
+            .DisplayName = "If-Else",
+            .Description = "Execute different blocks based on condition",
+            .Icon = "❓",
+            .Shape = BlockShape::MultiNested,
+            .Category = BlockCategory::ControlFlow,
+            .Inputs = {{ { "condition", ValueType::Bool, StaticValue::Bool(true) } }},
+            .NestedBodies = { "then", "else" },
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 Value condition = s_ControlVM.GetSlotValue(block->GetInputSlot("condition"), ctx);
                 
                 if (condition.AsBool())
@@ -65,22 +64,23 @@ namespace RiftSpire
                 }
                 
                 return Value();
-            })
-            .Register();
+            }
+        },
         
         //=====================================================================
         // Loop Blocks
         //=====================================================================
         
-        registry.DefineBlock("control.repeat")
-            .DisplayName("Repeat")
-            .Description("Repeat blocks a number of times")
-            .Icon("🔁")
-            .Shape(BlockShape::LoopNested)
-            .Category(BlockCategory::ControlFlow)
-            .Input("count", ValueType::Int, Value(10))
-            .NestedBody("body")
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.repeat",
+            .DisplayName = "Repeat",
+            .Description = "Repeat blocks a number of times",
+            .Icon = "🔁",
+            .Shape = BlockShape::LoopNested,
+            .Category = BlockCategory::ControlFlow,
+            .Inputs = {{ { "count", ValueType::Int, StaticValue::Integer(10) } }},
+            .NestedBodies = { "body" },
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 i64 count = s_ControlVM.GetSlotValue(block->GetInputSlot("count"), ctx).AsInt();
                 auto* bodySlot = block->GetNestedSlot("body");
                 
@@ -109,18 +109,19 @@ namespace RiftSpire
                 }
                 
                 return lastResult;
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.while")
-            .DisplayName("While")
-            .Description("Repeat blocks while condition is true")
-            .Icon("🔄")
-            .Shape(BlockShape::LoopNested)
-            .Category(BlockCategory::ControlFlow)
-            .Input("condition", ValueType::Bool, Value(true))
-            .NestedBody("body")
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.while",
+            .DisplayName = "While",
+            .Description = "Repeat blocks while condition is true",
+            .Icon = "🔄",
+            .Shape = BlockShape::LoopNested,
+            .Category = BlockCategory::ControlFlow,
+            .Inputs = {{ { "condition", ValueType::Bool, StaticValue::Bool(true) } }},
+            .NestedBodies = { "body" },
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 auto* bodySlot = block->GetNestedSlot("body");
                 if (!bodySlot) return Value();
                 
@@ -160,17 +161,18 @@ namespace RiftSpire
                 }
                 
                 return lastResult;
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.forever")
-            .DisplayName("Forever")
-            .Description("Repeat blocks forever (until stopped)")
-            .Icon("∞")
-            .Shape(BlockShape::LoopNested)
-            .Category(BlockCategory::ControlFlow)
-            .NestedBody("body")
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.forever",
+            .DisplayName = "Forever",
+            .Description = "Repeat blocks forever (until stopped)",
+            .Icon = "∞",
+            .Shape = BlockShape::LoopNested,
+            .Category = BlockCategory::ControlFlow,
+            .NestedBodies = { "body" },
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 auto* bodySlot = block->GetNestedSlot("body");
                 if (!bodySlot) return Value();
                 
@@ -200,18 +202,19 @@ namespace RiftSpire
                 }
                 
                 return lastResult;
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.for_each")
-            .DisplayName("For Each")
-            .Description("Iterate over items in a list")
-            .Icon("📝")
-            .Shape(BlockShape::LoopNested)
-            .Category(BlockCategory::ControlFlow)
-            .Input("list", ValueType::List)
-            .NestedBody("body")
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.for_each",
+            .DisplayName = "For Each",
+            .Description = "Iterate over items in a list",
+            .Icon = "📝",
+            .Shape = BlockShape::LoopNested,
+            .Category = BlockCategory::ControlFlow,
+            .Inputs = {{ { "list", ValueType::List } }},
+            .NestedBodies = { "body" },
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 Value listValue = s_ControlVM.GetSlotValue(block->GetInputSlot("list"), ctx);
                 auto* bodySlot = block->GetNestedSlot("body");
                 
@@ -244,89 +247,102 @@ namespace RiftSpire
                 }
                 
                 return lastResult;
-            })
-            .Register();
+            }
+        },
         
         //=====================================================================
         // Control Statements
         //=====================================================================
         
-        registry.DefineBlock("control.break")
-            .DisplayName("Break")
-            .Description("Exit the current loop")
-            .Icon("⛔")
-            .Shape(BlockShape::Flat)
-            .Category(BlockCategory::ControlFlow)
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.break",
+            .DisplayName = "Break",
+            .Description = "Exit the current loop",
+            .Icon = "⛔",
+            .Shape = BlockShape::Flat,
+            .Category = BlockCategory::ControlFlow,
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 ctx.RequestBreak();
                 return Value();
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.continue")
-            .DisplayName("Continue")
-            .Description("Skip to the next loop iteration")
-            .Icon("⏭")
-            .Shape(BlockShape::Flat)
-            .Category(BlockCategory::ControlFlow)
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.continue",
+            .DisplayName = "Continue",
+            .Description = "Skip to the next loop iteration",
+            .Icon = "⏭",
+            .Shape = BlockShape::Flat,
+            .Category = BlockCategory::ControlFlow,
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 ctx.RequestContinue();
                 return Value();
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.return")
-            .DisplayName("Return")
-            .Description("Return a value from the script")
-            .Icon("↩")
-            .Shape(BlockShape::ValueNested)
-            .Category(BlockCategory::ControlFlow)
-            .Input("value", ValueType::Any)
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.return",
+            .DisplayName = "Return",
+            .Description = "Return a value from the script",
+            .Icon = "↩",
+            .Shape = BlockShape::ValueNested,
+            .Category = BlockCategory::ControlFlow,
+            .Inputs = {{ { "value", ValueType::Any } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 Value returnValue = s_ControlVM.GetSlotValue(block->GetInputSlot("value"), ctx);
                 ctx.RequestReturn(returnValue);
                 return returnValue;
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.stop")
-            .DisplayName("Stop Script")
-            .Description("Stop executing this script entirely")
-            .Icon("🛑")
-            .Shape(BlockShape::Flat)
-            .Category(BlockCategory::ControlFlow)
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.stop",
+            .DisplayName = "Stop Script",
+            .Description = "Stop executing this script entirely",
+            .Icon = "🛑",
+            .Shape = BlockShape::Flat,
+            .Category = BlockCategory::ControlFlow,
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 ctx.RequestStop();
                 return Value();
-            })
-            .Register();
+            }
+        },
         
         //=====================================================================
         // Utility Blocks
         //=====================================================================
         
-        registry.DefineBlock("control.get_iteration")
-            .DisplayName("Get Iteration Index")
-            .Description("Get the current loop iteration index (0-based)")
-            .Icon("🔢")
-            .Shape(BlockShape::Flat)
-            .Category(BlockCategory::ControlFlow)
-            .ReturnsValue(ValueType::Int)
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.get_iteration",
+            .DisplayName = "Get Iteration Index",
+            .Description = "Get the current loop iteration index (0-based)",
+            .Icon = "🔢",
+            .Shape = BlockShape::Flat,
+            .Category = BlockCategory::ControlFlow,
+            .IsValueBlock = true,
+            .ReturnType = ValueType::Int,
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 return Value(ctx.GetIterationIndex());
-            })
-            .Register();
+            }
+        },
         
-        registry.DefineBlock("control.get_item")
-            .DisplayName("Get Current Item")
-            .Description("Get the current item in a for-each loop")
-            .Icon("📦")
-            .Shape(BlockShape::Flat)
-            .Category(BlockCategory::ControlFlow)
-            .ReturnsValue(ValueType::Any)
-            .OnExecute([](Block* block, ExecutionContext& ctx) -> Value {
+        {
+            .TypeId = "control.get_item",
+            .DisplayName = "Get Current Item",
+            .Description = "Get the current item in a for-each loop",
+            .Icon = "📦",
+            .Shape = BlockShape::Flat,
+            .Category = BlockCategory::ControlFlow,
+            .IsValueBlock = true,
+            .ReturnType = ValueType::Any,
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
                 return ctx.GetIterationItem();
-            })
-            .Register();
+            }
+        },
+    };
+    
+    void RegisterControlFlowBlocks()
+    {
+        BlockRegistry::Get().RegisterTable(s_ControlFlowBlocks);
     }
 }
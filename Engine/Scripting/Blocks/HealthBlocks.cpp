@@ -1,2 +1,106 @@
 #include "HealthBlocks.h"
-namespace RiftSpire { void RegisterHealthBlocks() { /* TODO */ } }
+#include "../Execution/ExecutionContext.h"
+#include "../Execution/ScriptVM.h"
+
+namespace RiftSpire
+{
+    static ScriptVM s_HealthVM;
+
+    //=========================================================================
+    // HealthOrderQueue
+    //=========================================================================
+
+    void HealthOrderQueue::Push(const HealthOrder& order)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Orders.push_back(order);
+    }
+
+    void HealthOrderQueue::Drain(std::vector<HealthOrder>& out)
+    {
+        out.clear();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        out.swap(m_Orders);
+    }
+
+    static void PushOrder(Block* block, ExecutionContext& ctx, const char* input, HealthOrder::Kind kind)
+    {
+        HealthOrderQueue* orders = ctx.GetHealthOrders();
+        if (!orders) return;
+
+        const f64 amount = s_HealthVM.GetSlotValue(block->GetInputSlot(input), ctx).AsFloat();
+        orders->Push({ ctx.GetSelf(), kind, static_cast<f32>(amount) });
+    }
+
+    //=========================================================================
+    // Health Blocks
+    //=========================================================================
+
+    static constexpr StaticBlockDefinition s_HealthBlocks[] =
+    {
+        {
+            .TypeId = "health.heal",
+            .DisplayName = "Heal",
+            .Description = "Restore health to this entity, up to its maximum",
+            .Icon = "💚",
+            .Shape = BlockShape::ValueNested,
+            .Category = BlockCategory::Health,
+            .ChangesState = true,
+            .Inputs = {{ { "amount", ValueType::Float, StaticValue::Float(10.0) } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
+                PushOrder(block, ctx, "amount", HealthOrder::Kind::Heal);
+                return Value();
+            }
+        },
+
+        {
+            .TypeId = "health.set_regen",
+            .DisplayName = "Set Health Regen",
+            .Description = "Health this entity regenerates per second",
+            .Icon = "➕",
+            .Shape = BlockShape::ValueNested,
+            .Category = BlockCategory::Health,
+            .ChangesState = true,
+            .Inputs = {{ { "per_second", ValueType::Float, StaticValue::Float(1.0) } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
+                PushOrder(block, ctx, "per_second", HealthOrder::Kind::SetHealthRegen);
+                return Value();
+            }
+        },
+
+        {
+            .TypeId = "mana.restore",
+            .DisplayName = "Restore Mana",
+            .Description = "Restore mana to this entity, up to its maximum",
+            .Icon = "🔷",
+            .Shape = BlockShape::ValueNested,
+            .Category = BlockCategory::MannaEnergy,
+            .ChangesState = true,
+            .Inputs = {{ { "amount", ValueType::Float, StaticValue::Float(10.0) } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
+                PushOrder(block, ctx, "amount", HealthOrder::Kind::RestoreMana);
+                return Value();
+            }
+        },
+
+        {
+            .TypeId = "mana.set_regen",
+            .DisplayName = "Set Mana Regen",
+            .Description = "Mana this entity regenerates per second",
+            .Icon = "🔹",
+            .Shape = BlockShape::ValueNested,
+            .Category = BlockCategory::MannaEnergy,
+            .ChangesState = true,
+            .Inputs = {{ { "per_second", ValueType::Float, StaticValue::Float(1.0) } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
+                PushOrder(block, ctx, "per_second", HealthOrder::Kind::SetManaRegen);
+                return Value();
+            }
+        },
+    };
+
+    void RegisterHealthBlocks()
+    {
+        BlockRegistry::Get().RegisterTable(s_HealthBlocks);
+    }
+}
@@ -1,3 +1,40 @@
 #pragma once
+
 #include "../Core/BlockRegistry.h"
-namespace RiftSpire { void RegisterHealthBlocks(); }
+#include <mutex>
+#include <vector>
+
+namespace RiftSpire
+{
+    void RegisterHealthBlocks();
+
+    //=========================================================================
+    // HealthOrderQueue - Health and mana changes from scripts
+    //=========================================================================
+
+    /// Queued by the health blocks and applied by the engine's RegenSystem
+    /// at the start of its update, the same way MoveOrderQueue works: each
+    /// scene owns one and hands it to its scripts through
+    /// ExecutionContext::SetHealthOrders. Entity is the script entity handle.
+    struct HealthOrder
+    {
+        enum class Kind : u8 { Heal, RestoreMana, SetHealthRegen, SetManaRegen };
+
+        u64 Entity = 0;
+        Kind Type = Kind::Heal;
+        f32 Amount = 0.0f;
+    };
+
+    class HealthOrderQueue
+    {
+    public:
+        void Push(const HealthOrder& order);
+
+        /// Move the queued orders into `out` (cleared first), oldest first
+        void Drain(std::vector<HealthOrder>& out);
+
+    private:
+        std::mutex m_Mutex;
+        std::vector<HealthOrder> m_Orders;
+    };
+}
@@ -1,2 +1,111 @@
 #include "MovementBlocks.h"
-namespace RiftSpire { void RegisterMovementBlocks() { /* TODO */ } }
+#include "../Execution/ExecutionContext.h"
+#include "../Execution/ScriptVM.h"
+
+namespace RiftSpire
+{
+    static ScriptVM s_MovementVM;
+
+    //=========================================================================
+    // MoveOrderQueue
+    //=========================================================================
+
+    void MoveOrderQueue::Push(const MoveOrder& order)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Orders.push_back(order);
+    }
+
+    void MoveOrderQueue::PushGroup(const std::vector<u64>& entities, f32 x, f32 y, f32 z)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Orders.reserve(m_Orders.size() + entities.size());
+        for (u64 entity : entities)
+        {
+            m_Orders.push_back({ entity, x, y, z, false });
+        }
+    }
+
+    void MoveOrderQueue::Drain(std::vector<MoveOrder>& out)
+    {
+        out.clear();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        out.swap(m_Orders);
+    }
+
+    //=========================================================================
+    // Movement Blocks
+    //=========================================================================
+
+    static constexpr StaticBlockDefinition s_MovementBlocks[] =
+    {
+        {
+            .TypeId = "movement.move_to",
+            .DisplayName = "Move To",
+            .Description = "Walk this entity to a position",
+            .Icon = "🏃",
+            .Shape = BlockShape::ValueNested,
+            .Category = BlockCategory::Movement,
+            .ChangesState = true,
+            .Inputs = {{ { "position", ValueType::Vector3, StaticValue::Vector3(0.0, 0.0, 0.0) } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
+                MoveOrderQueue* orders = ctx.GetMoveOrders();
+                if (!orders) return Value();
+
+                glm::vec3 position = s_MovementVM.GetSlotValue(block->GetInputSlot("position"), ctx).AsVector3();
+                orders->Push({ ctx.GetSelf(), position.x, position.y, position.z, false });
+                return Value();
+            }
+        },
+
+        {
+            .TypeId = "movement.move_units_to",
+            .DisplayName = "Move Units To",
+            .Description = "Walk every entity in a list to a position",
+            .Icon = "👥",
+            .Shape = BlockShape::MultiValueNested,
+            .Category = BlockCategory::Movement,
+            .ChangesState = true,
+            .Inputs = {{ { "units", ValueType::List }, { "position", ValueType::Vector3, StaticValue::Vector3(0.0, 0.0, 0.0) } }},
+            .Execute = [](Block* block, ExecutionContext& ctx) -> Value {
+                MoveOrderQueue* orders = ctx.GetMoveOrders();
+                if (!orders) return Value();
+
+                Value units = s_MovementVM.GetSlotValue(block->GetInputSlot("units"), ctx);
+                glm::vec3 position = s_MovementVM.GetSlotValue(block->GetInputSlot("position"), ctx).AsVector3();
+
+                std::vector<u64> entities;
+                entities.reserve(units.AsList().size());
+                for (const Value& unit : units.AsList())
+                {
+                    if (unit.IsEntity()) entities.push_back(unit.AsEntityHandle());
+                }
+
+                orders->PushGroup(entities, position.x, position.y, position.z);
+                return Value();
+            }
+        },
+
+        {
+            .TypeId = "movement.stop",
+            .DisplayName = "Stop Moving",
+            .Description = "Cancel this entity's move order",
+            .Icon = "✋",
+            .Shape = BlockShape::Flat,
+            .Category = BlockCategory::Movement,
+            .ChangesState = true,
+            .Execute = [](Block*, ExecutionContext& ctx) -> Value {
+                if (MoveOrderQueue* orders = ctx.GetMoveOrders())
+                {
+                    orders->Push({ ctx.GetSelf(), 0.0f, 0.0f, 0.0f, true });
+                }
+                return Value();
+            }
+        },
+    };
+
+    void RegisterMovementBlocks()
+    {
+        BlockRegistry::Get().RegisterTable(s_MovementBlocks);
+    }
+}
@@ -1,3 +1,42 @@
 #pragma once
+
 #include "../Core/BlockRegistry.h"
-namespace RiftSpire { void RegisterMovementBlocks(); }
+#include <mutex>
+#include <vector>
+
+namespace RiftSpire
+{
+    void RegisterMovementBlocks();
+
+    //=========================================================================
+    // MoveOrderQueue - Move orders from scripts, applied by the engine
+    //=========================================================================
+
+    /// Scripts cannot reach the scene's components, so movement blocks queue
+    /// orders here and the engine's MovementSystem applies them in one batch
+    /// at the start of its update. Each scene owns its queue and hands it to
+    /// the scripts it runs through ExecutionContext::SetMoveOrders. Entity is
+    /// the script entity handle, only meaningful in that scene.
+    struct MoveOrder
+    {
+        u64 Entity = 0;
+        f32 X = 0.0f, Y = 0.0f, Z = 0.0f;
+        bool Stop = false;
+    };
+
+    class MoveOrderQueue
+    {
+    public:
+        void Push(const MoveOrder& order);
+
+        /// One destination for many entities, under a single lock
+        void PushGroup(const std::vector<u64>& entities, f32 x, f32 y, f32 z);
+
+        /// Move the queued orders into `out` (cleared first), oldest first
+        void Drain(std::vector<MoveOrder>& out);
+
+    private:
+        std::mutex m_Mutex;
+        std::vector<MoveOrder> m_Orders;
+    };
+}
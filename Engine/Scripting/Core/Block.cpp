@@ -115,7 +115,12 @@ namespace RiftSpire
     //=========================================================================
     
     Block::Block(const BlockDefinition* definition)
-        : m_Id(UUID::Generate())
+        : Block(definition, UUID::Generate())
+    {
+    }
+    
+    Block::Block(const BlockDefinition* definition, const UUID& id)
+        : m_Id(id)
         , m_Definition(definition)
     {
         // Copy slots from definition
@@ -228,6 +233,33 @@ namespace RiftSpire
         return nullptr;
     }
     
+    static size_t FindSlot(const std::vector<BlockSlot>& slots, std::string_view name, size_t hint)
+    {
+        if (hint < slots.size() && slots[hint].GetName() == name)
+        {
+            return hint;
+        }
+        
+        for (size_t i = 0; i < slots.size(); ++i)
+        {
+            if (slots[i].GetName() == name)
+            {
+                return i;
+            }
+        }
+        return Block::InvalidSlot;
+    }
+    
+    size_t Block::FindInputSlot(std::string_view name, size_t hint) const
+    {
+        return FindSlot(m_InputSlots, name, hint);
+    }
+    
+    size_t Block::FindNestedSlot(std::string_view name, size_t hint) const
+    {
+        return FindSlot(m_NestedSlots, name, hint);
+    }
+    
     //---------------------------------------------------------------------
     // Statement Connections
     //---------------------------------------------------------------------
@@ -267,6 +299,11 @@ namespace RiftSpire
         }
         
         // Execute using definition's function
+        if (m_Definition && m_Definition->ExecuteFn)
+        {
+            return m_Definition->ExecuteFn(this, context);
+        }
+        
         if (m_Definition && m_Definition->Execute)
         {
             return m_Definition->Execute(this, context);
@@ -3,8 +3,10 @@
 #include "Value.h"
 #include "BlockTypes.h"
 #include <Core/UUID.h>
+#include <Core/RuntimeId.h>
 #include <glm/glm.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <memory>
 #include <functional>
@@ -19,6 +21,9 @@ namespace RiftSpire
     using BlockPtr = std::shared_ptr<Block>;
     using BlockWeakPtr = std::weak_ptr<Block>;
     
+    /// Plain execution function, used by constexpr block tables
+    using BlockExecuteFn = Value(*)(Block*, ExecutionContext&);
+    
     //=========================================================================
     // BlockSlot - Input/Output connection points on blocks
     //=========================================================================
@@ -71,6 +76,7 @@ namespace RiftSpire
     struct BlockDefinition
     {
         std::string TypeId;                     // Unique identifier (e.g., "operators.add")
+        TypeIndex Index = InvalidTypeIndex;     // Numeric id, assigned at registration
         std::string DisplayName;                // User-facing name (e.g., "Add")
         std::string Description;                // Tooltip description
         std::string Icon;                       // Icon/emoji for display
@@ -89,6 +95,7 @@ namespace RiftSpire
         // Execution function pointer
         using ExecuteFunc = std::function<Value(Block*, ExecutionContext&)>;
         ExecuteFunc Execute = nullptr;
+        BlockExecuteFn ExecuteFn = nullptr;     // Preferred over Execute when set
     };
     
     //=========================================================================
@@ -100,6 +107,7 @@ namespace RiftSpire
     public:
         Block() = default;
         explicit Block(const BlockDefinition* definition);
+        Block(const BlockDefinition* definition, const UUID& id);  // Restores a saved id
         ~Block() = default;
         
         // Prevent copying
@@ -115,8 +123,10 @@ namespace RiftSpire
         //---------------------------------------------------------------------
         
         UUID GetId() const { return m_Id; }
+        RuntimeId GetRuntimeId() const { return m_RuntimeId.Get(m_Id); }
         const BlockDefinition* GetDefinition() const { return m_Definition; }
         const std::string& GetTypeId() const { return m_Definition->TypeId; }
+        TypeIndex GetTypeIndex() const { return m_Definition->Index; }
         
         //---------------------------------------------------------------------
         // Properties from definition
@@ -149,6 +159,12 @@ namespace RiftSpire
         const BlockSlot* GetNestedSlot(size_t index) const;
         const BlockSlot* GetNestedSlot(const std::string& name) const;
         
+        /// Slot index by name for loaders: the saved position is tried first,
+        /// then a search by name (definitions may have gained or reordered slots)
+        static constexpr size_t InvalidSlot = static_cast<size_t>(-1);
+        size_t FindInputSlot(std::string_view name, size_t hint) const;
+        size_t FindNestedSlot(std::string_view name, size_t hint) const;
+        
         //---------------------------------------------------------------------
         // Statement connections (block chain)
         //---------------------------------------------------------------------
@@ -188,6 +204,7 @@ namespace RiftSpire
         
     private:
         UUID m_Id;
+        LazyRuntimeId m_RuntimeId;              // Compact id, taken on first lookup
         const BlockDefinition* m_Definition = nullptr;
         
         // Slot instances (copied from definition, can be modified)
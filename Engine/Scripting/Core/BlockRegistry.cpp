@@ -1,5 +1,7 @@
 #include "BlockRegistry.h"
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 
 namespace RiftSpire
 {
@@ -111,27 +113,391 @@ namespace RiftSpire
     
     void BlockRegistry::RegisterDefinition(BlockDefinition definition)
     {
-        m_Definitions[definition.TypeId] = std::move(definition);
+        // Re-registering a type keeps its index but swaps in a new definition;
+        // blocks created from the old one keep pointing at it
+        auto it = m_IndexByName.find(definition.TypeId);
+        if (it != m_IndexByName.end())
+        {
+            Entry& entry = m_Entries[it->second];
+            definition.Index = it->second;
+            
+            std::lock_guard<std::mutex> lock(m_MaterializeMutex);
+            BlockDefinition& stored = m_Definitions.emplace_back(std::move(definition));
+            entry.TypeId = stored.TypeId;
+            std::atomic_ref<BlockDefinition*>(entry.Definition).store(&stored, std::memory_order_release);
+            
+            // The frozen table holds views of the old name
+            Refreeze();
+            return;
+        }
+        
+        // TypeIndex space exhausted (InvalidTypeIndex is reserved)
+        if (m_Entries.size() >= InvalidTypeIndex)
+        {
+            return;
+        }
+        
+        definition.Index = static_cast<TypeIndex>(m_Entries.size());
+        BlockDefinition& stored = m_Definitions.emplace_back(std::move(definition));
+        
+        m_IndexByName.emplace(stored.TypeId, stored.Index);
+        m_Entries.push_back({ stored.TypeId, nullptr, &stored });
+        
+        // New names are not in the perfect-hash table yet
+        Refreeze();
+    }
+    
+    void BlockRegistry::RegisterTable(std::span<const StaticBlockDefinition> table)
+    {
+        m_Entries.reserve(m_Entries.size() + table.size());
+        
+        for (const StaticBlockDefinition& def : table)
+        {
+            if (m_Entries.size() >= InvalidTypeIndex)
+            {
+                break;
+            }
+            
+            // Shadow a builder registration of the same type
+            auto it = m_IndexByName.find(def.TypeId);
+            if (it != m_IndexByName.end())
+            {
+                m_IndexByName.erase(it);
+            }
+            
+            m_Entries.push_back({ def.TypeId, &def, nullptr });
+        }
+        
+        Refreeze();
     }
     
-    const BlockDefinition* BlockRegistry::GetDefinition(const std::string& typeId) const
+    void BlockRegistry::Refreeze()
     {
-        auto it = m_Definitions.find(typeId);
-        if (it != m_Definitions.end())
+        // Once frozen, every registration rebuilds the table, so lookups
+        // never fall back to scanning the static entries
+        if (m_Frozen)
         {
-            return &it->second;
+            Freeze();
         }
-        return nullptr;
     }
     
-    bool BlockRegistry::HasDefinition(const std::string& typeId) const
+    const BlockDefinition* BlockRegistry::Materialize(TypeIndex index) const
+    {
+        const Entry& entry = m_Entries[index];
+        
+        std::lock_guard<std::mutex> lock(m_MaterializeMutex);
+        if (entry.Definition)
+        {
+            return entry.Definition;
+        }
+        
+        const StaticBlockDefinition& source = *entry.Static;
+        BlockDefinition& def = m_Definitions.emplace_back();
+        
+        def.TypeId = source.TypeId;
+        def.Index = index;
+        def.DisplayName = source.DisplayName.empty() ? source.TypeId : source.DisplayName;
+        def.Description = source.Description;
+        def.Icon = source.Icon;
+        def.Shape = source.Shape;
+        def.Category = source.Category;
+        def.Authority = source.Authority;
+        def.ChangesState = source.ChangesState;
+        def.IsValueBlock = source.IsValueBlock;
+        def.ReturnType = source.ReturnType;
+        def.ExecuteFn = source.Execute;
+        
+        const size_t inputCount = source.GetInputCount();
+        def.InputSlots.reserve(inputCount);
+        for (size_t i = 0; i < inputCount; ++i)
+        {
+            const StaticSlotDefinition& input = source.Inputs[i];
+            BlockSlot& slot = def.InputSlots.emplace_back(std::string(input.Name), SlotType::ValueInput, input.Type);
+            slot.SetDefaultValue(input.Default.ToValue());
+        }
+        
+        const size_t nestedCount = source.GetNestedCount();
+        def.NestedSlots.reserve(nestedCount);
+        for (size_t i = 0; i < nestedCount; ++i)
+        {
+            def.NestedSlots.emplace_back(std::string(source.NestedBodies[i]), SlotType::NestedBody);
+        }
+        
+        // Publish after the definition is complete; readers check without the lock
+        std::atomic_ref<BlockDefinition*>(entry.Definition).store(&def, std::memory_order_release);
+        return &def;
+    }
+    
+    size_t BlockRegistry::GetMaterializedCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_MaterializeMutex);
+        return m_Definitions.size();
+    }
+    
+    BlockCategory BlockRegistry::GetEntryCategory(const Entry& entry) const
+    {
+        return entry.Static ? entry.Static->Category : entry.Definition->Category;
+    }
+    
+    //-------------------------------------------------------------------------
+    // Perfect Hashing (hash-and-displace)
+    //-------------------------------------------------------------------------
+    
+    static u64 HashTypeId(std::string_view typeId)
+    {
+        // Word-at-a-time multiply/xorshift hash, one pass over the name
+        u64 hash = 0x9E3779B97F4A7C15ULL ^ typeId.size();
+        const char* data = typeId.data();
+        size_t remaining = typeId.size();
+        
+        while (remaining >= 8)
+        {
+            u64 word;
+            std::memcpy(&word, data, 8);
+            hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+            hash ^= hash >> 29;
+            data += 8;
+            remaining -= 8;
+        }
+        
+        if (remaining > 0)
+        {
+            u64 word = 0;
+            for (size_t i = 0; i < remaining; ++i)
+            {
+                word |= static_cast<u64>(static_cast<u8>(data[i])) << (i * 8);
+            }
+            hash = (hash ^ word) * 0xFF51AFD7ED558CCDULL;
+            hash ^= hash >> 29;
+        }
+        
+        return hash;
+    }
+    
+    static u64 MixSeed(u64 hash, u64 seed)
+    {
+        u64 x = hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+        x ^= x >> 33;
+        x *= 0xC4CEB9FE1A85EC53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+    
+    static size_t NextPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+    
+    void BlockRegistry::Freeze()
+    {
+        const size_t count = m_Entries.size();
+        m_BucketSeeds.clear();
+        m_Slots.clear();
+        m_SlotNames.clear();
+        
+        if (count == 0)
+        {
+            m_Frozen = true;
+            return;
+        }
+        
+        std::vector<u64> hashes(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            hashes[i] = HashTypeId(m_Entries[i].TypeId);
+        }
+        
+        // Only the newest entry of a name is reachable; shadowed ones keep their
+        // index for blocks that already point at them but leave the table
+        std::vector<TypeIndex> keys(count);
+        for (size_t i = 0; i < count; ++i) keys[i] = static_cast<TypeIndex>(i);
+        std::sort(keys.begin(), keys.end(), [&](TypeIndex a, TypeIndex b) {
+            return hashes[a] != hashes[b] ? hashes[a] < hashes[b] : a > b;
+        });
+        
+        size_t unique = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            bool shadowed = false;
+            for (size_t j = unique; j-- > 0 && hashes[keys[j]] == hashes[keys[i]];)
+            {
+                if (m_Entries[keys[j]].TypeId == m_Entries[keys[i]].TypeId)
+                {
+                    shadowed = true;
+                    break;
+                }
+            }
+            if (!shadowed) keys[unique++] = keys[i];
+        }
+        keys.resize(unique);
+        
+        // ~4 keys per bucket, table at least 25% larger than the key count
+        const size_t bucketCount = NextPowerOfTwo(unique / 4 + 1);
+        size_t tableSize = NextPowerOfTwo(unique + unique / 4 + 1);
+        
+        std::vector<std::vector<TypeIndex>> buckets(bucketCount);
+        for (TypeIndex key : keys)
+        {
+            buckets[MixSeed(hashes[key], 0) & (bucketCount - 1)].push_back(key);
+        }
+        
+        // Place the largest buckets first while the table is still sparse
+        std::vector<size_t> order(bucketCount);
+        for (size_t i = 0; i < bucketCount; ++i) order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return buckets[a].size() > buckets[b].size();
+        });
+        
+        constexpr u32 MaxSeed = 1u << 16;
+        
+        for (;;)
+        {
+            m_BucketSeeds.assign(bucketCount, 0);
+            m_Slots.assign(tableSize, InvalidTypeIndex);
+            
+            bool placedAll = true;
+            std::vector<size_t> candidate;
+            
+            for (size_t bucket : order)
+            {
+                const auto& keys = buckets[bucket];
+                if (keys.empty()) break;
+                
+                bool placed = false;
+                for (u32 seed = 1; seed < MaxSeed && !placed; ++seed)
+                {
+                    candidate.clear();
+                    placed = true;
+                    
+                    for (TypeIndex key : keys)
+                    {
+                        size_t slot = MixSeed(hashes[key], seed) & (tableSize - 1);
+                        if (m_Slots[slot] != InvalidTypeIndex ||
+                            std::find(candidate.begin(), candidate.end(), slot) != candidate.end())
+                        {
+                            placed = false;
+                            break;
+                        }
+                        candidate.push_back(slot);
+                    }
+                    
+                    if (placed)
+                    {
+                        m_BucketSeeds[bucket] = seed;
+                        for (size_t i = 0; i < keys.size(); ++i)
+                        {
+                            m_Slots[candidate[i]] = keys[i];
+                        }
+                    }
+                }
+                
+                if (!placed)
+                {
+                    placedAll = false;
+                    break;
+                }
+            }
+            
+            if (placedAll) break;
+            
+            // Practically unreachable; retry with more room
+            tableSize <<= 1;
+        }
+        
+        // Names next to slots so a lookup touches one cache line for the compare
+        m_SlotNames.resize(tableSize);
+        for (size_t i = 0; i < tableSize; ++i)
+        {
+            if (m_Slots[i] != InvalidTypeIndex)
+            {
+                m_SlotNames[i] = m_Entries[m_Slots[i]].TypeId;
+            }
+        }
+        
+        m_Frozen = true;
+    }
+    
+    TypeIndex BlockRegistry::FindFrozen(std::string_view typeId) const
+    {
+        u64 hash = HashTypeId(typeId);
+        u32 seed = m_BucketSeeds[MixSeed(hash, 0) & (m_BucketSeeds.size() - 1)];
+        if (seed == 0) return InvalidTypeIndex;
+        
+        size_t slot = MixSeed(hash, seed) & (m_Slots.size() - 1);
+        if (m_Slots[slot] != InvalidTypeIndex && m_SlotNames[slot] == typeId)
+        {
+            return m_Slots[slot];
+        }
+        return InvalidTypeIndex;
+    }
+    
+    //-------------------------------------------------------------------------
+    // Lookup
+    //-------------------------------------------------------------------------
+    
+    TypeIndex BlockRegistry::GetTypeIndex(std::string_view typeId) const
     {
-        return m_Definitions.find(typeId) != m_Definitions.end();
+        if (m_Frozen)
+        {
+            return m_Entries.empty() ? InvalidTypeIndex : FindFrozen(typeId);
+        }
+        
+        auto it = m_IndexByName.find(typeId);
+        return it != m_IndexByName.end() ? it->second : FindStatic(typeId);
     }
     
-    BlockPtr BlockRegistry::CreateBlock(const std::string& typeId) const
+    TypeIndex BlockRegistry::FindStatic(std::string_view typeId) const
     {
-        const BlockDefinition* def = GetDefinition(typeId);
+        // Only used between RegisterTable and Freeze; newest entry wins
+        for (size_t i = m_Entries.size(); i-- > 0;)
+        {
+            if (m_Entries[i].Static && m_Entries[i].TypeId == typeId)
+            {
+                return static_cast<TypeIndex>(i);
+            }
+        }
+        return InvalidTypeIndex;
+    }
+    
+    const BlockDefinition* BlockRegistry::GetDefinition(std::string_view typeId) const
+    {
+        return GetDefinition(GetTypeIndex(typeId));
+    }
+    
+    const BlockDefinition* BlockRegistry::GetDefinition(TypeIndex index) const
+    {
+        if (index >= m_Entries.size())
+        {
+            return nullptr;
+        }
+        
+        const Entry& entry = m_Entries[index];
+        if (const BlockDefinition* def = std::atomic_ref<BlockDefinition*>(entry.Definition).load(std::memory_order_acquire))
+        {
+            return def;
+        }
+        return Materialize(index);
+    }
+    
+    bool BlockRegistry::HasDefinition(std::string_view typeId) const
+    {
+        return GetTypeIndex(typeId) != InvalidTypeIndex;
+    }
+    
+    //-------------------------------------------------------------------------
+    // Creation
+    //-------------------------------------------------------------------------
+    
+    BlockPtr BlockRegistry::CreateBlock(std::string_view typeId) const
+    {
+        return CreateBlock(GetTypeIndex(typeId));
+    }
+    
+    BlockPtr BlockRegistry::CreateBlock(TypeIndex index) const
+    {
+        const BlockDefinition* def = GetDefinition(index);
         if (def)
         {
             return std::make_shared<Block>(def);
@@ -139,17 +505,41 @@ namespace RiftSpire
         return nullptr;
     }
     
+    BlockPtr BlockRegistry::CreateBlock(TypeIndex index, const UUID& id) const
+    {
+        const BlockDefinition* def = GetDefinition(index);
+        if (def)
+        {
+            return std::make_shared<Block>(def, id);
+        }
+        return nullptr;
+    }
+    
+    std::vector<BlockPtr> BlockRegistry::CreateBlocks(const std::vector<TypeIndex>& types) const
+    {
+        std::vector<BlockPtr> blocks;
+        blocks.reserve(types.size());
+        
+        for (TypeIndex index : types)
+        {
+            blocks.push_back(CreateBlock(index));
+        }
+        
+        return blocks;
+    }
+    
     std::vector<std::string> BlockRegistry::GetAllTypeIds() const
     {
         std::vector<std::string> ids;
-        ids.reserve(m_Definitions.size());
+        ids.reserve(m_Entries.size());
         
-        for (const auto& [id, def] : m_Definitions)
+        for (const auto& entry : m_Entries)
         {
-            ids.push_back(id);
+            ids.emplace_back(entry.TypeId);
         }
         
         std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
         return ids;
     }
     
@@ -157,11 +547,12 @@ namespace RiftSpire
     {
         std::vector<const BlockDefinition*> blocks;
         
-        for (const auto& [id, def] : m_Definitions)
+        for (size_t i = 0; i < m_Entries.size(); ++i)
         {
-            if (def.Category == category)
+            const Entry& entry = m_Entries[i];
+            if (GetEntryCategory(entry) == category && GetTypeIndex(entry.TypeId) == i)
             {
-                blocks.push_back(&def);
+                blocks.push_back(GetDefinition(static_cast<TypeIndex>(i)));
             }
         }
         
@@ -178,12 +569,13 @@ namespace RiftSpire
     {
         std::vector<BlockCategory> categories;
         
-        for (const auto& [id, def] : m_Definitions)
+        for (const auto& entry : m_Entries)
         {
-            auto it = std::find(categories.begin(), categories.end(), def.Category);
+            BlockCategory category = GetEntryCategory(entry);
+            auto it = std::find(categories.begin(), categories.end(), category);
             if (it == categories.end())
             {
-                categories.push_back(def.Category);
+                categories.push_back(category);
             }
         }
         
@@ -192,6 +584,65 @@ namespace RiftSpire
         return categories;
     }
     
+    //=========================================================================
+    // BlockTypeTable Implementation
+    //=========================================================================
+    
+    u16 BlockTypeTable::Add(const BlockDefinition* definition)
+    {
+        if (!definition) return Add(std::string_view());
+        
+        TypeIndex index = definition->Index;
+        if (index != InvalidTypeIndex && index < m_LocalByType.size() && m_LocalByType[index] != 0)
+        {
+            return static_cast<u16>(m_LocalByType[index] - 1);
+        }
+        
+        return Add(std::string_view(definition->TypeId));
+    }
+    
+    u16 BlockTypeTable::Add(std::string_view typeId)
+    {
+        auto it = std::find(m_Names.begin(), m_Names.end(), typeId);
+        if (it != m_Names.end())
+        {
+            return static_cast<u16>(it - m_Names.begin());
+        }
+        
+        u16 local = static_cast<u16>(m_Names.size());
+        TypeIndex index = BlockRegistry::Get().GetTypeIndex(typeId);
+        
+        m_Names.emplace_back(typeId);
+        m_Resolved.push_back(index);
+        
+        if (index != InvalidTypeIndex)
+        {
+            if (index >= m_LocalByType.size()) m_LocalByType.resize(index + 1, 0);
+            m_LocalByType[index] = static_cast<u16>(local + 1);
+        }
+        
+        return local;
+    }
+    
+    void BlockTypeTable::SetNames(std::vector<std::string> names)
+    {
+        m_Names = std::move(names);
+        m_Resolved.clear();
+        m_LocalByType.clear();
+        
+        auto& registry = BlockRegistry::Get();
+        m_Resolved.reserve(m_Names.size());
+        for (const auto& name : m_Names)
+        {
+            m_Resolved.push_back(registry.GetTypeIndex(name));
+        }
+    }
+    
+    TypeIndex BlockTypeTable::Resolve(u16 localIndex) const
+    {
+        return localIndex < m_Resolved.size() ? m_Resolved[localIndex] : InvalidTypeIndex;
+    }
+    
     //=========================================================================
     // Block Registration
     //=========================================================================
@@ -2,11 +2,16 @@
 
 #include "Block.h"
 #include "BlockTypes.h"
+#include "StaticBlockTable.h"
 #include <unordered_map>
 #include <vector>
+#include <deque>
+#include <span>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <memory>
+#include <mutex>
 
 namespace RiftSpire
 {
@@ -66,12 +71,30 @@ namespace RiftSpire
         BlockBuilder DefineBlock(const std::string& typeId);
         void RegisterDefinition(BlockDefinition definition);
         
+        /// Adopt a constexpr table. Entries are referenced in place (the table
+        /// must have static storage); no per-block allocation happens until a
+        /// type is first looked up by definition. A table entry replaces an
+        /// earlier registration with the same TypeId.
+        void RegisterTable(std::span<const StaticBlockDefinition> table);
+        
+        /// Build the perfect-hash lookup table. Called once all built-in blocks
+        /// are registered; registering afterwards rebuilds it.
+        void Freeze();
+        bool IsFrozen() const { return m_Frozen; }
+        
         // Lookup
-        const BlockDefinition* GetDefinition(const std::string& typeId) const;
-        bool HasDefinition(const std::string& typeId) const;
+        const BlockDefinition* GetDefinition(std::string_view typeId) const;
+        const BlockDefinition* GetDefinition(TypeIndex index) const;
+        bool HasDefinition(std::string_view typeId) const;
+        TypeIndex GetTypeIndex(std::string_view typeId) const;
         
         // Creation
-        BlockPtr CreateBlock(const std::string& typeId) const;
+        BlockPtr CreateBlock(std::string_view typeId) const;
+        BlockPtr CreateBlock(TypeIndex index) const;
+        BlockPtr CreateBlock(TypeIndex index, const UUID& id) const;  // Keeps a saved id
+        
+        /// Bulk instantiation, one block per entry (nullptr for unknown types)
+        std::vector<BlockPtr> CreateBlocks(const std::vector<TypeIndex>& types) const;
         
         // Enumeration
         std::vector<std::string> GetAllTypeIds() const;
@@ -79,7 +102,10 @@ namespace RiftSpire
         std::vector<BlockCategory> GetAllCategories() const;
         
         // Statistics
-        size_t GetBlockCount() const { return m_Definitions.size(); }
+        size_t GetBlockCount() const { return m_Entries.size(); }
+        
+        /// Number of definitions built so far (static entries build lazily)
+        size_t GetMaterializedCount() const;
         
     private:
         BlockRegistry() = default;
@@ -87,7 +113,67 @@ namespace RiftSpire
         BlockRegistry(const BlockRegistry&) = delete;
         BlockRegistry& operator=(const BlockRegistry&) = delete;
         
-        std::unordered_map<std::string, BlockDefinition> m_Definitions;
+        struct Entry
+        {
+            std::string_view TypeId;                    // Static table or owned definition
+            const StaticBlockDefinition* Static = nullptr;
+            mutable BlockDefinition* Definition = nullptr;  // Built on first use for static entries
+        };
+        
+        struct NameHash
+        {
+            using is_transparent = void;
+            size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+        };
+        
+        void Refreeze();
+        TypeIndex FindFrozen(std::string_view typeId) const;
+        TypeIndex FindStatic(std::string_view typeId) const;
+        const BlockDefinition* Materialize(TypeIndex index) const;
+        BlockCategory GetEntryCategory(const Entry& entry) const;
+        
+        // Entries indexed by TypeIndex
+        std::vector<Entry> m_Entries;
+        
+        // Owned definitions (deque keeps pointers stable)
+        mutable std::deque<BlockDefinition> m_Definitions;
+        mutable std::mutex m_MaterializeMutex;
+        
+        // Builder-registered names; static entries are found by Freeze/FindStatic
+        std::unordered_map<std::string, TypeIndex, NameHash, std::equal_to<>> m_IndexByName;
+        
+        // Perfect-hash table (CHD), valid while m_Frozen
+        bool m_Frozen = false;
+        std::vector<u32> m_BucketSeeds;
+        std::vector<TypeIndex> m_Slots;
+        std::vector<std::string_view> m_SlotNames;  // Views into m_Entries names
+    };
+    
+    //=========================================================================
+    // BlockTypeTable - Per-file name table for numeric type ids
+    //=========================================================================
+    
+    /// Serialized formats store a small local index per block plus one table
+    /// of type names, so files stay valid when registration order changes.
+    class BlockTypeTable
+    {
+    public:
+        /// Add a type (if new) and return its local index
+        u16 Add(const BlockDefinition* definition);
+        u16 Add(std::string_view typeId);
+        
+        /// Replace the table with names read from a file
+        void SetNames(std::vector<std::string> names);
+        const std::vector<std::string>& GetNames() const { return m_Names; }
+        size_t GetCount() const { return m_Names.size(); }
+        
+        /// Registry TypeIndex for a local index (InvalidTypeIndex if unknown)
+        TypeIndex Resolve(u16 localIndex) const;
+        
+    private:
+        std::vector<std::string> m_Names;
+        std::vector<TypeIndex> m_Resolved;          // Local index -> TypeIndex
+        std::vector<u16> m_LocalByType;             // TypeIndex -> local index + 1
     };
     
     //=========================================================================
@@ -24,28 +24,22 @@ namespace RiftSpire
         if (!block) return;
         
         // Check if already added
-        if (m_BlockMap.find(block->GetId()) != m_BlockMap.end())
+        if (m_BlockMap.find(block->GetRuntimeId()) != m_BlockMap.end())
         {
             return;
         }
         
         m_Blocks.push_back(block);
-        m_BlockMap[block->GetId()] = block;
+        m_BlockMap[block->GetRuntimeId()] = block;
         IncrementVersion();
     }
     
     void BlockScript::RemoveBlock(BlockPtr block)
     {
         if (!block) return;
-        RemoveBlock(block->GetId());
-    }
-    
-    void BlockScript::RemoveBlock(const UUID& blockId)
-    {
-        auto it = m_BlockMap.find(blockId);
-        if (it == m_BlockMap.end()) return;
         
-        BlockPtr block = it->second;
+        auto it = m_BlockMap.find(block->GetRuntimeId());
+        if (it == m_BlockMap.end()) return;
         
         // Disconnect from chain
         if (auto prev = block->GetPreviousBlock())
@@ -63,7 +57,17 @@ namespace RiftSpire
         IncrementVersion();
     }
     
+    void BlockScript::RemoveBlock(const UUID& blockId)
+    {
+        RemoveBlock(GetBlock(blockId));
+    }
+    
     BlockPtr BlockScript::GetBlock(const UUID& blockId) const
+    {
+        return GetBlock(RuntimeIdTable::Get().Find(blockId));
+    }
+    
+    BlockPtr BlockScript::GetBlock(RuntimeId blockId) const
     {
         auto it = m_BlockMap.find(blockId);
         if (it != m_BlockMap.end())
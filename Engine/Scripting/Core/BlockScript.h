@@ -4,6 +4,7 @@
 #include "Core/BlockTypes.h"
 #include "Core/Value.h"
 #include <Core/UUID.h> // For unordered_set hash support
+#include <Core/RuntimeId.h>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -27,6 +28,7 @@ namespace RiftSpire
         //---------------------------------------------------------------------
         
         UUID GetId() const { return m_Id; }
+        void SetId(const UUID& id) { m_Id = id; }  // For loaders restoring a saved script
         
         const std::string& GetName() const { return m_Name; }
         void SetName(const std::string& name) { m_Name = name; }
@@ -47,6 +49,7 @@ namespace RiftSpire
         
         /// Get block by ID
         BlockPtr GetBlock(const UUID& blockId) const;
+        BlockPtr GetBlock(RuntimeId blockId) const;
         
         /// Get all blocks
         const std::vector<BlockPtr>& GetBlocks() const { return m_Blocks; }
@@ -93,6 +96,7 @@ namespace RiftSpire
         
         u32 GetVersion() const { return m_Version; }
         void IncrementVersion() { m_Version++; }
+        void SetVersion(u32 version) { m_Version = version; }
         
         //---------------------------------------------------------------------
         // Undo/Redo support
@@ -126,7 +130,7 @@ namespace RiftSpire
         std::string m_Description;
         
         std::vector<BlockPtr> m_Blocks;
-        std::unordered_map<UUID, BlockPtr> m_BlockMap;  // Fast lookup by ID
+        std::unordered_map<RuntimeId, BlockPtr> m_BlockMap;  // Fast lookup by runtime ID
         
         u32 m_Version = 1;
         
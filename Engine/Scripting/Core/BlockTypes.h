@@ -4,10 +4,19 @@
 #include <string>
 
 using u8 = std::uint8_t;
+using u16 = std::uint16_t;
 using u32 = std::uint32_t;
 
 namespace RiftSpire
 {
+    //=========================================================================
+    // Block Type Index
+    //=========================================================================
+    
+    /// Numeric block type id, assigned by BlockRegistry in registration order
+    using TypeIndex = u16;
+    constexpr TypeIndex InvalidTypeIndex = 0xFFFF;
+    
     //=========================================================================
     // Block Type Enumerations
     //=========================================================================
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Block.h"
+#include "BlockTypes.h"
+#include "Value.h"
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // StaticValue - Compile-time default value for a static slot
+    //=========================================================================
+
+    struct StaticValue
+    {
+        ValueType Type = ValueType::Void;
+        i64 Int = 0;                            // Bool and Int
+        f64 Components[4] = { 0.0, 0.0, 0.0, 0.0 };  // Float, vectors and colors
+        std::string_view Text;                  // String
+
+        static constexpr StaticValue Bool(bool v) { StaticValue s; s.Type = ValueType::Bool; s.Int = v ? 1 : 0; return s; }
+        static constexpr StaticValue Integer(i64 v) { StaticValue s; s.Type = ValueType::Int; s.Int = v; return s; }
+        static constexpr StaticValue Float(f64 v) { StaticValue s; s.Type = ValueType::Float; s.Components[0] = v; return s; }
+        static constexpr StaticValue String(std::string_view v) { StaticValue s; s.Type = ValueType::String; s.Text = v; return s; }
+
+        static constexpr StaticValue Vector3(f64 x, f64 y, f64 z)
+        {
+            StaticValue s;
+            s.Type = ValueType::Vector3;
+            s.Components[0] = x; s.Components[1] = y; s.Components[2] = z;
+            return s;
+        }
+
+        /// Runtime value (allocates only for strings)
+        Value ToValue() const
+        {
+            switch (Type)
+            {
+                case ValueType::Bool:    return Value(Int != 0);
+                case ValueType::Int:     return Value(Int);
+                case ValueType::Float:   return Value(Components[0]);
+                case ValueType::String:  return Value(std::string(Text));
+                case ValueType::Vector2: return Value(glm::vec2(Components[0], Components[1]));
+                case ValueType::Vector3: return Value(glm::vec3(Components[0], Components[1], Components[2]));
+                case ValueType::Color:   return Value(glm::vec4(Components[0], Components[1], Components[2], Components[3]));
+                default:                 return Value();
+            }
+        }
+    };
+
+    //=========================================================================
+    // StaticBlockDefinition - Block type declared in a constexpr table
+    //=========================================================================
+
+    constexpr size_t MaxStaticInputs = 4;
+    constexpr size_t MaxStaticNested = 2;
+
+    struct StaticSlotDefinition
+    {
+        std::string_view Name;                  // Empty marks an unused entry
+        ValueType Type = ValueType::Any;
+        StaticValue Default;
+
+        /// Tables list just a name and type when the slot has no default, so
+        /// the trailing fields come from a constructor, not brace elision
+        constexpr StaticSlotDefinition() = default;
+        constexpr StaticSlotDefinition(std::string_view name, ValueType type = ValueType::Any, StaticValue defaultValue = {})
+            : Name(name), Type(type), Default(defaultValue)
+        {
+        }
+    };
+
+    /// Mirrors BlockDefinition with views and a plain function pointer so a
+    /// whole module can live in read-only data. BlockRegistry::RegisterTable
+    /// adopts the table as-is; the BlockDefinition is built the first time a
+    /// type is actually used.
+    struct StaticBlockDefinition
+    {
+        std::string_view TypeId;
+        std::string_view DisplayName;           // Defaults to TypeId when empty
+        std::string_view Description;
+        std::string_view Icon;
+
+        BlockShape Shape = BlockShape::Flat;
+        BlockCategory Category = BlockCategory::DebugLogging;
+        NetworkAuthority Authority = NetworkAuthority::Local;
+
+        bool ChangesState = false;
+        bool IsValueBlock = false;
+        ValueType ReturnType = ValueType::Void;
+
+        std::array<StaticSlotDefinition, MaxStaticInputs> Inputs{};
+        std::array<std::string_view, MaxStaticNested> NestedBodies{};
+
+        BlockExecuteFn Execute = nullptr;
+
+        constexpr size_t GetInputCount() const
+        {
+            size_t count = 0;
+            while (count < Inputs.size() && !Inputs[count].Name.empty()) ++count;
+            return count;
+        }
+
+        constexpr size_t GetNestedCount() const
+        {
+            size_t count = 0;
+            while (count < NestedBodies.size() && !NestedBodies[count].empty()) ++count;
+            return count;
+        }
+    };
+}
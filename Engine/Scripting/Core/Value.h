@@ -3,6 +3,7 @@
 #include "BlockTypes.h"
 #include <glm/glm.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <variant>
 #include <memory>
@@ -151,6 +152,13 @@ namespace RiftSpire
             return "";
         }
         
+        /// The stored string without copying (empty unless IsString())
+        std::string_view AsStringView() const
+        {
+            if (IsString()) return std::get<std::string>(m_Data);
+            return {};
+        }
+        
         glm::vec2 AsVector2() const
         {
             if (IsVector2()) return std::get<glm::vec2>(m_Data);
@@ -0,0 +1,351 @@
+#include "CompiledScript.h"
+#include "../Serialization/BinaryScript.h"
+#include <algorithm>
+#include <unordered_map>
+#include <new>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // Helpers
+    //=========================================================================
+
+    static size_t AlignUp(size_t value, size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static size_t VariablesOffset()
+    {
+        return AlignUp(sizeof(ScriptInstance), alignof(Value));
+    }
+
+    static size_t TimersOffset(size_t variableCount)
+    {
+        return AlignUp(VariablesOffset() + variableCount * sizeof(Value), alignof(ScriptTimer));
+    }
+
+    /// Literal name of a "name" slot, empty if it is driven by another block
+    static std::string GetLiteralName(const Block* block)
+    {
+        const BlockSlot* slot = block->GetInputSlot("name");
+        if (!slot || slot->GetConnectedBlock()) return {};
+        return slot->GetDefaultValue().AsString();
+    }
+
+    static void AddUnique(std::vector<std::string>& names, const std::string& name)
+    {
+        if (name.empty()) return;
+        if (std::find(names.begin(), names.end(), name) == names.end())
+        {
+            names.push_back(name);
+        }
+    }
+
+    /// Collect every block reachable from the script (chains, nested bodies, value inputs)
+    static void CollectBlocks(const BlockPtr& block, std::unordered_map<const Block*, BlockPtr>& visited,
+                              std::vector<const Block*>& order)
+    {
+        if (!block || visited.count(block.get())) return;
+
+        visited[block.get()] = nullptr;
+        order.push_back(block.get());
+
+        for (size_t i = 0; i < block->GetInputSlotCount(); ++i)
+        {
+            CollectBlocks(block->GetInputSlot(i)->GetConnectedBlock(), visited, order);
+        }
+
+        for (size_t i = 0; i < block->GetNestedSlotCount(); ++i)
+        {
+            for (const auto& nested : block->GetNestedSlot(i)->GetNestedBlocks())
+            {
+                CollectBlocks(nested, visited, order);
+            }
+        }
+
+        CollectBlocks(block->GetNextBlock(), visited, order);
+    }
+
+    //=========================================================================
+    // CompiledScript
+    //=========================================================================
+
+    CompiledScriptPtr CompiledScript::Compile(const BlockScript& script)
+    {
+        std::shared_ptr<CompiledScript> program(new CompiledScript());
+        program->m_SourceId = script.GetId();
+        program->m_SourceVersion = script.GetVersion();
+        program->m_Name = script.GetName();
+
+        // Pass 1: gather the reachable graph in a stable order
+        std::unordered_map<const Block*, BlockPtr> remap;
+        std::vector<const Block*> order;
+        for (const auto& block : script.GetBlocks())
+        {
+            CollectBlocks(block, remap, order);
+        }
+
+        // Pass 2: create runtime copies (no editor state). They keep the
+        // source ids, so editor breakpoints match, as with .rbsbin programs.
+        program->m_Blocks.reserve(order.size());
+        for (const Block* source : order)
+        {
+            auto copy = std::make_shared<Block>(source->GetDefinition(), source->GetId());
+            for (size_t i = 0; i < source->GetInputSlotCount(); ++i)
+            {
+                copy->GetInputSlot(i)->SetDefaultValue(source->GetInputSlot(i)->GetDefaultValue());
+            }
+            copy->SetDisabled(source->IsDisabled());
+
+            remap[source] = copy;
+            program->m_Blocks.push_back(copy);
+        }
+
+        // Pass 3: wire connections and collect the instance layout
+        for (const Block* source : order)
+        {
+            const BlockPtr& copy = remap[source];
+
+            for (size_t i = 0; i < source->GetInputSlotCount(); ++i)
+            {
+                if (auto connected = source->GetInputSlot(i)->GetConnectedBlock())
+                {
+                    copy->GetInputSlot(i)->Connect(remap[connected.get()]);
+                }
+            }
+
+            for (size_t i = 0; i < source->GetNestedSlotCount(); ++i)
+            {
+                for (const auto& nested : source->GetNestedSlot(i)->GetNestedBlocks())
+                {
+                    copy->GetNestedSlot(i)->AddNestedBlock(remap[nested.get()]);
+                }
+            }
+
+            if (auto next = source->GetNextBlock())
+            {
+                copy->SetNextBlock(remap[next.get()]);
+            }
+
+            program->AddToLayout(copy);
+        }
+
+        program->FinalizeLayout();
+        return program;
+    }
+
+    CompiledScriptPtr CompiledScript::Compile(const BinaryScriptView& view)
+    {
+        if (!view.IsValid()) return nullptr;
+
+        std::shared_ptr<CompiledScript> program(new CompiledScript());
+        program->m_SourceId = view.GetId();
+        program->m_SourceVersion = view.GetScriptVersion();
+        program->m_Name = std::string(view.GetName());
+
+        // The file is already a flat, validated graph: one pass creates the
+        // runtime blocks, no intermediate script or remap table
+        view.Instantiate(program->m_Blocks, false);
+
+        program->m_Blocks.erase(std::remove(program->m_Blocks.begin(), program->m_Blocks.end(), nullptr),
+                                program->m_Blocks.end());
+
+        for (const auto& block : program->m_Blocks)
+        {
+            program->AddToLayout(block);
+        }
+
+        program->FinalizeLayout();
+        return program;
+    }
+
+    CompiledScriptPtr CompiledScript::Assemble(const UUID& sourceId, u32 sourceVersion, std::string name,
+                                               std::vector<BlockPtr> blocks)
+    {
+        std::shared_ptr<CompiledScript> program(new CompiledScript());
+        program->m_SourceId = sourceId;
+        program->m_SourceVersion = sourceVersion;
+        program->m_Name = std::move(name);
+        program->m_Blocks = std::move(blocks);
+
+        for (const auto& block : program->m_Blocks)
+        {
+            program->AddToLayout(block);
+        }
+
+        program->FinalizeLayout();
+        return program;
+    }
+
+    void CompiledScript::AddToLayout(const BlockPtr& block)
+    {
+        const std::string& typeId = block->GetTypeId();
+        if (block->GetShape() == BlockShape::EventNested)
+        {
+            m_EntryPoints.push_back({ typeId, block });
+        }
+        else if (typeId == "data.set" || typeId == "data.get" || typeId == "data.change")
+        {
+            AddUnique(m_Variables, GetLiteralName(block.get()));
+        }
+        else if (typeId == "time.set_timer" || typeId == "time.clear_timer")
+        {
+            AddUnique(m_Timers, GetLiteralName(block.get()));
+        }
+    }
+
+    void CompiledScript::FinalizeLayout()
+    {
+        std::sort(m_Variables.begin(), m_Variables.end());
+        std::sort(m_Timers.begin(), m_Timers.end());
+    }
+
+    i32 CompiledScript::FindVariable(const std::string& name) const
+    {
+        auto it = std::lower_bound(m_Variables.begin(), m_Variables.end(), name);
+        if (it != m_Variables.end() && *it == name)
+        {
+            return static_cast<i32>(it - m_Variables.begin());
+        }
+        return -1;
+    }
+
+    i32 CompiledScript::FindTimer(const std::string& name) const
+    {
+        auto it = std::lower_bound(m_Timers.begin(), m_Timers.end(), name);
+        if (it != m_Timers.end() && *it == name)
+        {
+            return static_cast<i32>(it - m_Timers.begin());
+        }
+        return -1;
+    }
+
+    size_t CompiledScript::GetInstanceSize() const
+    {
+        return TimersOffset(m_Variables.size()) + m_Timers.size() * sizeof(ScriptTimer);
+    }
+
+    size_t CompiledScript::GetMemoryUsage() const
+    {
+        // make_shared puts the control block (two counts, vtable) next to the block
+        constexpr size_t SharedBlockOverhead = 2 * sizeof(void*);
+
+        size_t bytes = sizeof(CompiledScript);
+        bytes += m_Blocks.capacity() * sizeof(BlockPtr);
+        bytes += m_EntryPoints.capacity() * sizeof(EntryPoint);
+
+        for (const auto& block : m_Blocks)
+        {
+            bytes += sizeof(Block) + SharedBlockOverhead;
+            bytes += (block->GetInputSlotCount() + block->GetNestedSlotCount()) * sizeof(BlockSlot);
+
+            for (size_t i = 0; i < block->GetNestedSlotCount(); ++i)
+            {
+                bytes += block->GetNestedSlot(i)->GetNestedBlocks().capacity() * sizeof(BlockPtr);
+            }
+        }
+
+        for (const auto& name : m_Variables) bytes += sizeof(std::string) + name.capacity();
+        for (const auto& name : m_Timers) bytes += sizeof(std::string) + name.capacity();
+        return bytes;
+    }
+
+    //=========================================================================
+    // ScriptInstance
+    //=========================================================================
+
+    ScriptInstancePtr ScriptInstance::Create(CompiledScriptPtr program)
+    {
+        if (!program) return nullptr;
+
+        const size_t variableCount = program->GetVariableCount();
+        const size_t timerCount = program->GetTimerCount();
+
+        u8* memory = static_cast<u8*>(::operator new(program->GetInstanceSize()));
+        auto* instance = new (memory) ScriptInstance(std::move(program));
+
+        instance->m_VariableCount = static_cast<u32>(variableCount);
+        instance->m_TimerCount = static_cast<u32>(timerCount);
+        instance->m_Variables = reinterpret_cast<Value*>(memory + VariablesOffset());
+        instance->m_Timers = reinterpret_cast<ScriptTimer*>(memory + TimersOffset(variableCount));
+
+        for (size_t i = 0; i < variableCount; ++i)
+        {
+            new (&instance->m_Variables[i]) Value();
+        }
+        for (size_t i = 0; i < timerCount; ++i)
+        {
+            new (&instance->m_Timers[i]) ScriptTimer();
+        }
+
+        return ScriptInstancePtr(instance);
+    }
+
+    void ScriptInstance::Deleter::operator()(ScriptInstance* instance) const
+    {
+        if (!instance) return;
+
+        for (u32 i = 0; i < instance->m_VariableCount; ++i)
+        {
+            instance->m_Variables[i].~Value();
+        }
+
+        instance->~ScriptInstance();
+        ::operator delete(static_cast<void*>(instance));
+    }
+
+    ScriptInstance::ScriptInstance(CompiledScriptPtr program)
+        : m_Program(std::move(program))
+    {
+    }
+
+    ScriptInstance::~ScriptInstance() = default;
+
+    Value* ScriptInstance::FindVariable(const std::string& name)
+    {
+        i32 index = m_Program->FindVariable(name);
+        return index >= 0 ? &m_Variables[index] : nullptr;
+    }
+
+    const Value* ScriptInstance::FindVariable(const std::string& name) const
+    {
+        i32 index = m_Program->FindVariable(name);
+        return index >= 0 ? &m_Variables[index] : nullptr;
+    }
+
+    ScriptTimer* ScriptInstance::FindTimer(const std::string& name)
+    {
+        i32 index = m_Program->FindTimer(name);
+        return index >= 0 ? &m_Timers[index] : nullptr;
+    }
+
+    u32 ScriptInstance::UpdateTimers(f32 deltaTime, std::vector<Block*>& expired)
+    {
+        u32 fired = 0;
+
+        for (u32 i = 0; i < m_TimerCount; ++i)
+        {
+            ScriptTimer& timer = m_Timers[i];
+            if (!timer.Active) continue;
+
+            timer.Remaining -= deltaTime;
+            if (timer.Remaining <= 0.0f)
+            {
+                fired++;
+                if (timer.Handler) expired.push_back(timer.Handler);
+
+                if (timer.Interval > 0.0f)
+                {
+                    timer.Remaining += timer.Interval;
+                }
+                else
+                {
+                    timer.Active = false;
+                }
+            }
+        }
+
+        return fired;
+    }
+}
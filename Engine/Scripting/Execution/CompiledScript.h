@@ -0,0 +1,198 @@
+#pragma once
+
+#include "../Core/Block.h"
+#include "../Core/BlockScript.h"
+#include "../Core/Value.h"
+#include <Core/UUID.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+using i32 = std::int32_t;
+using u32 = std::uint32_t;
+using f32 = float;
+
+namespace RiftSpire
+{
+    // Forward declarations
+    class CompiledScript;
+    class ScriptInstance;
+    class BinaryScriptView;
+
+    using CompiledScriptPtr = std::shared_ptr<const CompiledScript>;
+
+    //=========================================================================
+    // CompiledScript - Immutable program shared by every instance of a script
+    //=========================================================================
+
+    class CompiledScript
+    {
+    public:
+        /// Entry point of an event handler chain
+        struct EntryPoint
+        {
+            std::string EventType;      // Type id of the event block (e.g. "events.on_start")
+            BlockPtr Block;             // Event block, chain starts here
+        };
+
+        /// Compile a script. The block graph is deep-copied without editor
+        /// state, so later edits to the source never reach running instances.
+        /// Copies keep their source block ids.
+        static CompiledScriptPtr Compile(const BlockScript& script);
+
+        /// Compile straight from a validated .rbsbin view, without building
+        /// the editor BlockScript first
+        static CompiledScriptPtr Compile(const BinaryScriptView& view);
+
+        /// Wrap runtime blocks that are already wired (e.g. built from a
+        /// blueprint AST). The blocks may be shared with other programs, so
+        /// they must not be modified afterwards.
+        static CompiledScriptPtr Assemble(const UUID& sourceId, u32 sourceVersion, std::string name,
+                                          std::vector<BlockPtr> blocks);
+
+        //---------------------------------------------------------------------
+        // Identity
+        //---------------------------------------------------------------------
+
+        UUID GetSourceId() const { return m_SourceId; }
+        u32 GetSourceVersion() const { return m_SourceVersion; }
+        const std::string& GetName() const { return m_Name; }
+
+        //---------------------------------------------------------------------
+        // Program
+        //---------------------------------------------------------------------
+
+        const std::vector<EntryPoint>& GetEntryPoints() const { return m_EntryPoints; }
+        size_t GetBlockCount() const { return m_Blocks.size(); }
+
+        //---------------------------------------------------------------------
+        // Per-instance state layout
+        //---------------------------------------------------------------------
+
+        /// Index of a script variable, or -1 if it is not part of the layout
+        i32 FindVariable(const std::string& name) const;
+        size_t GetVariableCount() const { return m_Variables.size(); }
+        const std::string& GetVariableName(size_t index) const { return m_Variables[index]; }
+
+        /// Index of a named timer, or -1 if it is not part of the layout
+        i32 FindTimer(const std::string& name) const;
+        size_t GetTimerCount() const { return m_Timers.size(); }
+        const std::string& GetTimerName(size_t index) const { return m_Timers[index]; }
+
+        /// Bytes allocated for one ScriptInstance of this program
+        size_t GetInstanceSize() const;
+
+        /// Approximate heap bytes held by the program (blocks, slots, layout).
+        /// Blocks shared with another program are counted in both.
+        size_t GetMemoryUsage() const;
+
+    private:
+        CompiledScript() = default;
+
+        /// Record entry points, variables and timers used by a runtime block
+        void AddToLayout(const BlockPtr& block);
+        void FinalizeLayout();
+
+        UUID m_SourceId;
+        u32 m_SourceVersion = 0;
+        std::string m_Name;
+
+        std::vector<BlockPtr> m_Blocks;         // Owns the copied graph
+        std::vector<EntryPoint> m_EntryPoints;
+        std::vector<std::string> m_Variables;   // Sorted, index = instance slot
+        std::vector<std::string> m_Timers;      // Sorted, index = instance slot
+    };
+
+    //=========================================================================
+    // ScriptTimer - Repeating timer state owned by a ScriptInstance
+    //=========================================================================
+
+    struct ScriptTimer
+    {
+        f32 Remaining = 0.0f;
+        f32 Interval = 0.0f;
+        bool Active = false;
+        Block* Handler = nullptr;               // time.set_timer block whose body runs on expiry
+    };
+
+    //=========================================================================
+    // ScriptInstance - Per-entity state for a CompiledScript
+    //=========================================================================
+
+    class ScriptInstance
+    {
+    public:
+        struct Deleter
+        {
+            void operator()(ScriptInstance* instance) const;
+        };
+
+        /// Create an instance. Variables and timers live in the same
+        /// allocation as the instance itself (one allocation per spawn).
+        static std::unique_ptr<ScriptInstance, Deleter> Create(CompiledScriptPtr program);
+
+        ScriptInstance(const ScriptInstance&) = delete;
+        ScriptInstance& operator=(const ScriptInstance&) = delete;
+
+        //---------------------------------------------------------------------
+        // Program
+        //---------------------------------------------------------------------
+
+        const CompiledScript& GetProgram() const { return *m_Program; }
+        const CompiledScriptPtr& GetProgramPtr() const { return m_Program; }
+
+        //---------------------------------------------------------------------
+        // Variables
+        //---------------------------------------------------------------------
+
+        size_t GetVariableCount() const { return m_VariableCount; }
+        Value& GetVariable(size_t index) { return m_Variables[index]; }
+        const Value& GetVariable(size_t index) const { return m_Variables[index]; }
+
+        /// Returns nullptr if the name is not part of the program's layout
+        Value* FindVariable(const std::string& name);
+        const Value* FindVariable(const std::string& name) const;
+
+        //---------------------------------------------------------------------
+        // Timers
+        //---------------------------------------------------------------------
+
+        size_t GetTimerCount() const { return m_TimerCount; }
+        ScriptTimer& GetTimer(size_t index) { return m_Timers[index]; }
+        const ScriptTimer& GetTimer(size_t index) const { return m_Timers[index]; }
+        ScriptTimer* FindTimer(const std::string& name);
+
+        /// Advance active timers and append the handler of each one that
+        /// fired to `expired`; returns the number that fired this update
+        u32 UpdateTimers(f32 deltaTime, std::vector<Block*>& expired);
+
+        //---------------------------------------------------------------------
+        // Instruction pointer
+        //---------------------------------------------------------------------
+
+        Block* GetInstructionPointer() const { return m_InstructionPointer; }
+        void SetInstructionPointer(Block* block) { m_InstructionPointer = block; }
+
+        //---------------------------------------------------------------------
+        // Memory
+        //---------------------------------------------------------------------
+
+        size_t GetAllocationSize() const { return m_Program->GetInstanceSize(); }
+
+    private:
+        explicit ScriptInstance(CompiledScriptPtr program);
+        ~ScriptInstance();
+
+        CompiledScriptPtr m_Program;
+        Block* m_InstructionPointer = nullptr;
+
+        // Trailing storage (same allocation as this object)
+        Value* m_Variables = nullptr;
+        ScriptTimer* m_Timers = nullptr;
+        u32 m_VariableCount = 0;
+        u32 m_TimerCount = 0;
+    };
+
+    using ScriptInstancePtr = std::unique_ptr<ScriptInstance, ScriptInstance::Deleter>;
+}
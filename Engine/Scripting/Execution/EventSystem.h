@@ -36,6 +36,7 @@ namespace RiftSpire
         DamageTaken,            // Hasar alindi
         HealDealt,              // Iyilestirme verildi
         HealReceived,           // Iyilestirme alindi
+        HealthChanged,          // Can bir esigi gecti
         
         // Yasam olaylari
         Kill,                   // Oldurme
@@ -69,6 +70,13 @@ namespace RiftSpire
         GameEnd,                // Oyun bitti
         ObjectiveCapture,       // Hedef ele gecirildi
         
+        // Fizik olaylari (Source ve Target: carpisan iki varlik)
+        CollisionBegin,         // Temas basladi
+        CollisionStay,          // Temas suruyor
+        CollisionEnd,           // Temas bitti
+        AreaEnter,              // Bolgeye girildi (Source: bolge)
+        AreaLeave,              // Bolgeden cikildi
+        
         // Ozel
         Custom                  // Ozel event
     };
@@ -95,11 +103,16 @@ namespace RiftSpire
         EventType Type;
         UUID SourceEntityId;        // Olaya neden olan varlik
         UUID TargetEntityId;        // Hedef varlik (varsa)
+        u64 SourceEntity = 0;       // Sahne olaylarinda entt::to_integral handle
+        u64 TargetEntity = 0;
+        u32 InstanceId = 0;         // Olayi ureten nesne (mermi kimligi vb.)
         glm::vec3 Position;         // Olay konumu
+        float Amount = 0.0f;        // Olaya ozgu miktar (can degisimi vb.)
         float Timestamp;            // Olay zamani
         
         EventData(EventType type = EventType::Custom)
             : Type(type)
+            , Position(0.0f)
             , Timestamp(0.0f)
         {}
         
@@ -1,4 +1,5 @@
 #include "ExecutionContext.h"
+#include "CompiledScript.h"
 
 namespace RiftSpire
 {
@@ -88,6 +89,15 @@ namespace RiftSpire
             return GetLocalVariable(name);
         }
         
+        // Then the instance's script variables
+        if (m_Instance)
+        {
+            if (const Value* value = m_Instance->FindVariable(name))
+            {
+                return *value;
+            }
+        }
+        
         // Then synced
         return GetSyncedVariable(name);
     }
@@ -98,11 +108,20 @@ namespace RiftSpire
         if (HasSyncedVariable(name))
         {
             SetSyncedVariable(name, value);
+            return;
         }
-        else
+
+        // Script variables live in the instance so they persist between events
+        if (m_Instance && !HasLocalVariable(name))
         {
-            SetLocalVariable(name, value);
+            if (Value* slot = m_Instance->FindVariable(name))
+            {
+                *slot = value;
+                return;
+            }
         }
+
+        SetLocalVariable(name, value);
     }
     
     //=========================================================================
@@ -20,6 +20,9 @@ namespace RiftSpire
     class Entity;
     class Scene;
     class BlockScript;
+    class ScriptInstance;
+    class MoveOrderQueue;
+    class HealthOrderQueue;
     
     //=========================================================================
     // ExecutionContext - Runtime context for script execution
@@ -51,6 +54,20 @@ namespace RiftSpire
         Scene* GetScene() const { return m_Scene; }
         void SetScene(Scene* scene) { m_Scene = scene; }
         
+        /// Where order blocks queue their orders; set by the scene that runs
+        /// the script (Scene::BindScriptContext). Orders are dropped without one.
+        MoveOrderQueue* GetMoveOrders() const { return m_MoveOrders; }
+        void SetMoveOrders(MoveOrderQueue* orders) { m_MoveOrders = orders; }
+        HealthOrderQueue* GetHealthOrders() const { return m_HealthOrders; }
+        void SetHealthOrders(HealthOrderQueue* orders) { m_HealthOrders = orders; }
+        
+        //---------------------------------------------------------------------
+        // Script instance (per-entity state of a CompiledScript)
+        //---------------------------------------------------------------------
+        
+        ScriptInstance* GetInstance() const { return m_Instance; }
+        void SetInstance(ScriptInstance* instance) { m_Instance = instance; }
+        
         //---------------------------------------------------------------------
         // Variable management
         //---------------------------------------------------------------------
@@ -146,6 +163,11 @@ namespace RiftSpire
         
         // Scene
         Scene* m_Scene = nullptr;
+        MoveOrderQueue* m_MoveOrders = nullptr;
+        HealthOrderQueue* m_HealthOrders = nullptr;
+        
+        // Per-entity script state (variables, timers)
+        ScriptInstance* m_Instance = nullptr;
         
         // Variables
         struct Scope
@@ -35,7 +35,7 @@ namespace RiftSpire
         auto stack = std::make_shared<ExecutionStack>();
         stack->SetState(ExecutionState::Idle);
         
-        m_StackMap[stack->GetId()] = stack;
+        m_StackMap[stack->GetRuntimeId()] = stack;
         m_ActiveStacks.push_back(stack);
         
         m_Statistics.TotalStacksCreated++;
@@ -68,7 +68,7 @@ namespace RiftSpire
             return;
         }
         
-        m_StackMap[stack->GetId()] = stack;
+        m_StackMap[stack->GetRuntimeId()] = stack;
         m_ActiveStacks.push_back(stack);
         
         m_Statistics.TotalStacksCreated++;
@@ -80,6 +80,11 @@ namespace RiftSpire
     }
     
     void ExecutionEngine::RemoveStack(const UUID& stackId)
+    {
+        RemoveStack(RuntimeIdTable::Get().Find(stackId));
+    }
+    
+    void ExecutionEngine::RemoveStack(RuntimeId stackId)
     {
         auto it = m_StackMap.find(stackId);
         if (it != m_StackMap.end())
@@ -89,7 +94,7 @@ namespace RiftSpire
             // Vector'dan kaldir
             m_ActiveStacks.erase(
                 std::remove_if(m_ActiveStacks.begin(), m_ActiveStacks.end(),
-                    [&stackId](const ExecutionStackPtr& s) { return s->GetId() == stackId; }),
+                    [stackId](const ExecutionStackPtr& s) { return s->GetRuntimeId() == stackId; }),
                 m_ActiveStacks.end()
             );
             
@@ -99,6 +104,11 @@ namespace RiftSpire
     }
     
     ExecutionStackPtr ExecutionEngine::GetStack(const UUID& stackId)
+    {
+        return GetStack(RuntimeIdTable::Get().Find(stackId));
+    }
+    
+    ExecutionStackPtr ExecutionEngine::GetStack(RuntimeId stackId)
     {
         auto it = m_StackMap.find(stackId);
         if (it != m_StackMap.end())
@@ -354,7 +364,7 @@ namespace RiftSpire
     void ExecutionEngine::CleanupCompletedStacks()
     {
         // Tamamlanan veya iptal edilen yiginlari kaldir
-        std::vector<UUID> toRemove;
+        std::vector<RuntimeId> toRemove;
         
         for (const auto& stack : m_ActiveStacks)
         {
@@ -363,11 +373,11 @@ namespace RiftSpire
                 state == ExecutionState::Cancelled ||
                 state == ExecutionState::Error)
             {
-                toRemove.push_back(stack->GetId());
+                toRemove.push_back(stack->GetRuntimeId());
             }
         }
         
-        for (const UUID& id : toRemove)
+        for (RuntimeId id : toRemove)
         {
             RemoveStack(id);
         }
@@ -73,9 +73,11 @@ namespace RiftSpire
         
         // Yigin kaldir
         void RemoveStack(const UUID& stackId);
+        void RemoveStack(RuntimeId stackId);
         
         // Yigin ara
         ExecutionStackPtr GetStack(const UUID& stackId);
+        ExecutionStackPtr GetStack(RuntimeId stackId);
         
         // Varlik icin yiginlari iptal et
         void CancelStacksForEntity(const UUID& entityId, CancelReason reason);
@@ -148,7 +150,7 @@ namespace RiftSpire
         std::vector<ExecutionStackPtr> m_ActiveStacks;
         
         // ID -> Stack haritasi (hizli lookup)
-        std::unordered_map<UUID, ExecutionStackPtr> m_StackMap;
+        std::unordered_map<RuntimeId, ExecutionStackPtr> m_StackMap;
         
         // Debug durumu
         bool m_IsPaused = false;
@@ -9,11 +9,13 @@ namespace RiftSpire
     
     ExecutionStack::ExecutionStack()
         : m_StackId(UUID::Generate())
+        , m_RuntimeId(m_StackId)
     {
     }
     
     ExecutionStack::ExecutionStack(const UUID& id)
         : m_StackId(id)
+        , m_RuntimeId(m_StackId)
     {
     }
     
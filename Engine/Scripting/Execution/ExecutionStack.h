@@ -2,7 +2,9 @@
 
 #include "../Core/Block.h"
 #include "../Core/Value.h"
+#include "CompiledScript.h"
 #include <Core/UUID.h>
+#include <Core/RuntimeId.h>
 #include <glm/glm.hpp>
 #include <string>
 #include <vector>
@@ -178,6 +180,7 @@ namespace RiftSpire
         //---------------------------------------------------------------------
         
         const UUID& GetId() const { return m_StackId; }
+        RuntimeId GetRuntimeId() const { return m_RuntimeId.Get(); }
         ExecutionState GetState() const { return m_State; }
         void SetState(ExecutionState state) { m_State = state; }
         
@@ -250,8 +253,15 @@ namespace RiftSpire
         void SetScript(BlockScript* script) { m_Script = script; }
         BlockScript* GetScript() const { return m_Script; }
         
+        /// Program the instruction pointer runs in. Holding it keeps those
+        /// blocks alive, so a stack started before a hot reload finishes on
+        /// the version it started with.
+        void SetProgram(CompiledScriptPtr program) { m_Program = std::move(program); }
+        const CompiledScriptPtr& GetProgram() const { return m_Program; }
+        
     private:
         UUID m_StackId;
+        ScopedRuntimeId m_RuntimeId;    // Motor haritalari icin kompakt kimlik
         ExecutionState m_State = ExecutionState::Idle;
         
         // Ability context
@@ -274,6 +284,7 @@ namespace RiftSpire
         
         // Script reference
         BlockScript* m_Script = nullptr;
+        CompiledScriptPtr m_Program;
         
         // Statistics
         int m_InstructionCount = 0;
@@ -1,5 +1,6 @@
 #include "ScriptVM.h"
 #include "../Core/BlockScript.h"
+#include <algorithm>
 // #include <Core/Logger.h>  // TODO: Integrate logger
 
 namespace RiftSpire
@@ -60,6 +61,68 @@ namespace RiftSpire
         return result;
     }
     
+    Value ScriptVM::ExecuteEvent(ScriptInstance& instance, const std::string& eventName, ExecutionContext& context)
+    {
+        m_ExecutionStart = std::chrono::steady_clock::now();
+        m_CurrentIterations = 0;
+        m_CurrentRecursionDepth = 0;
+        
+        ScriptInstance* previous = context.GetInstance();
+        context.SetInstance(&instance);
+        
+        Value result;
+        for (const auto& entry : instance.GetProgram().GetEntryPoints())
+        {
+            if (entry.EventType.find(eventName) == std::string::npos)
+            {
+                continue;
+            }
+            
+            instance.SetInstructionPointer(entry.Block.get());
+            result = ExecuteChain(entry.Block, context);
+            
+            if (context.IsStopRequested())
+            {
+                break;
+            }
+        }
+        
+        instance.SetInstructionPointer(nullptr);
+        context.SetInstance(previous);
+        
+        return result;
+    }
+    
+    u32 ScriptVM::UpdateTimers(ScriptInstance& instance, f32 deltaTime, ExecutionContext& context)
+    {
+        m_ExpiredTimers.clear();
+        const u32 fired = instance.UpdateTimers(deltaTime, m_ExpiredTimers);
+        if (m_ExpiredTimers.empty()) return fired;
+        
+        m_ExecutionStart = std::chrono::steady_clock::now();
+        m_CurrentIterations = 0;
+        m_CurrentRecursionDepth = 0;
+        
+        ScriptInstance* previous = context.GetInstance();
+        context.SetInstance(&instance);
+        
+        for (Block* handler : m_ExpiredTimers)
+        {
+            instance.SetInstructionPointer(handler);
+            ExecuteNestedBlocks(handler->GetNestedSlot("body"), context);
+            
+            if (context.IsStopRequested())
+            {
+                break;
+            }
+        }
+        
+        instance.SetInstructionPointer(nullptr);
+        context.SetInstance(previous);
+        
+        return fired;
+    }
+    
     Value ScriptVM::ExecuteChain(BlockPtr startBlock, ExecutionContext& context)
     {
         if (!startBlock) return Value();
@@ -106,7 +169,7 @@ namespace RiftSpire
         }
         
         // Check for breakpoint
-        if (m_DebugMode && HasBreakpoint(block->GetId()))
+        if (m_DebugMode && HasBreakpoint(block->GetRuntimeId()))
         {
             m_Paused = true;
             if (m_OnBreakpoint)
@@ -219,22 +282,42 @@ namespace RiftSpire
     
     void ScriptVM::SetBreakpoint(const UUID& blockId)
     {
-        m_Breakpoints.insert(blockId);
+        if (!blockId.IsValid() || HasBreakpoint(blockId)) return;
+        
+        RuntimeId id = RuntimeIdTable::Get().Acquire(blockId);
+        m_Breakpoints.push_back(id);
+        
+        if (id / 64 >= m_BreakpointBits.size())
+        {
+            m_BreakpointBits.resize(id / 64 + 1, 0);
+        }
+        m_BreakpointBits[id / 64] |= 1ULL << (id % 64);
     }
     
     void ScriptVM::RemoveBreakpoint(const UUID& blockId)
     {
-        m_Breakpoints.erase(blockId);
+        RuntimeId id = RuntimeIdTable::Get().Find(blockId);
+        auto it = std::find(m_Breakpoints.begin(), m_Breakpoints.end(), id);
+        if (id == InvalidRuntimeId || it == m_Breakpoints.end()) return;
+        
+        m_BreakpointBits[id / 64] &= ~(1ULL << (id % 64));
+        m_Breakpoints.erase(it);
+        RuntimeIdTable::Get().Release(id);
     }
     
     void ScriptVM::ClearBreakpoints()
     {
+        for (RuntimeId id : m_Breakpoints)
+        {
+            RuntimeIdTable::Get().Release(id);
+        }
         m_Breakpoints.clear();
+        m_BreakpointBits.clear();
     }
     
     bool ScriptVM::HasBreakpoint(const UUID& blockId) const
     {
-        return m_Breakpoints.find(blockId) != m_Breakpoints.end();
+        return HasBreakpoint(RuntimeIdTable::Get().Find(blockId));
     }
     
     //=========================================================================
@@ -326,7 +409,13 @@ namespace RiftSpire
             return false;
         }
         
-        // Check time limit
+        // Check time limit. Block VMs that only run nested bodies never start
+        // a run of their own; the VM that did enforces the limit.
+        if (m_ExecutionStart == std::chrono::steady_clock::time_point{})
+        {
+            return true;
+        }
+        
         auto now = std::chrono::steady_clock::now();
         auto elapsed = std::chrono::duration<f64, std::milli>(now - m_ExecutionStart).count();
         m_Stats.TotalExecutionTimeMs = elapsed;
@@ -3,7 +3,9 @@
 #include "ExecutionContext.h"
 #include "../Core/Block.h"
 #include "../Core/BlockScript.h"
+#include "CompiledScript.h"
 #include <Core/UUID.h>
+#include <Core/RuntimeId.h>
 #include <functional>
 #include <queue>
 #include <chrono>
@@ -19,7 +21,10 @@ namespace RiftSpire
     {
     public:
         ScriptVM() = default;
-        ~ScriptVM() = default;
+        ~ScriptVM() { ClearBreakpoints(); }
+        
+        ScriptVM(const ScriptVM&) = delete;
+        ScriptVM& operator=(const ScriptVM&) = delete;
         
         //---------------------------------------------------------------------
         // Execution
@@ -31,6 +36,13 @@ namespace RiftSpire
         /// Execute a single event handler
         Value ExecuteEvent(BlockScript* script, const std::string& eventName, ExecutionContext& context);
         
+        /// Execute an event handler of a compiled script against one instance's state
+        Value ExecuteEvent(ScriptInstance& instance, const std::string& eventName, ExecutionContext& context);
+        
+        /// Advance one instance's timers by a tick and run the body of every
+        /// set_timer block whose timer expired; returns how many fired
+        u32 UpdateTimers(ScriptInstance& instance, f32 deltaTime, ExecutionContext& context);
+        
         /// Execute a chain of blocks starting from the given block
         Value ExecuteChain(BlockPtr startBlock, ExecutionContext& context);
         
@@ -65,6 +77,11 @@ namespace RiftSpire
         void RemoveBreakpoint(const UUID& blockId);
         void ClearBreakpoints();
         bool HasBreakpoint(const UUID& blockId) const;
+        bool HasBreakpoint(RuntimeId blockId) const
+        {
+            return blockId < m_BreakpointBits.size() * 64 &&
+                   (m_BreakpointBits[blockId / 64] >> (blockId % 64)) & 1;
+        }
         
         /// Step to next block (debug mode)
         void StepOver(ExecutionContext& context);
@@ -129,7 +146,10 @@ namespace RiftSpire
         bool m_DebugMode = false;
         bool m_Paused = false;
         
-        std::unordered_set<UUID> m_Breakpoints;
+        // Each breakpoint holds a RuntimeId reference so the id stays bound
+        // to its UUID; the bitset is what ExecuteBlock checks
+        std::vector<RuntimeId> m_Breakpoints;
+        std::vector<u64> m_BreakpointBits;
         
         BlockCallback m_OnBeforeExecute;
         BlockCallback m_OnAfterExecute;
@@ -151,6 +171,7 @@ namespace RiftSpire
         > m_DelayedQueue;
         
         ExecutionStats m_Stats;
+        std::vector<Block*> m_ExpiredTimers;    // Reused by UpdateTimers
         
         // Limits
         u64 m_MaxIterations = 1000000;
@@ -35,6 +35,9 @@ namespace RiftSpire
         RegisterNetworkBlocks();
         RegisterSyncBlocks();
         
+        // All built-in blocks are known, switch lookups to the perfect-hash table
+        BlockRegistry::Get().Freeze();
+        
         // RS_INFO("Registered {} block types", BlockRegistry::Get().GetBlockCount());
     }
     
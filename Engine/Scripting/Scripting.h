@@ -11,6 +11,7 @@
 
 #include "Execution/ExecutionContext.h"
 #include "Execution/ScriptVM.h"
+#include "Execution/CompiledScript.h"
 
 #include "Serialization/ScriptSerializer.h"
 
@@ -1,351 +1,708 @@
 #include "AbilityBlueprint.h"
 #include "../Core/BlockScript.h"
 #include "../Core/Block.h"
+#include "../Core/BlockRegistry.h"
+#include "AbilityProgramCache.h"
+#include "BinaryCodec.h"
+#include "BlueprintPack.h"
+#include "FileWatcher.h"
+#include "MappedFile.h"
 #include <Core/Logger.h>
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <sstream>
+#include <thread>
 
 namespace RiftSpire
 {
     //=========================================================================
-    // Binary Serialization Helpers
+    // Binary Layout
     //=========================================================================
     
-    void BlueprintSerializer::WriteUUID(std::vector<uint8_t>& buffer, const UUID& id)
+    // Smallest possible encoding of each repeated record, used to reject
+    // counts that cannot fit in the remaining bytes before allocating
+    static constexpr size_t MinNodeSize = 16 + 1 + 16 + 16 + 1 + 1;        // Id, TypeId, Next, Parent, counts
+    static constexpr size_t MinPropertySize = 1 + 1;                        // Key length, value tag
+    static constexpr size_t MinConnectionSize = 16 + 16 + 1 + 1;
+    
+    static size_t StringSize(const std::string& str)
     {
-        uint64_t value = id.IsValid() ? std::stoull(id.ToString()) : 0;
-        for (int i = 0; i < 8; ++i)
-        {
-            buffer.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
-        }
+        return BinaryCodec::VarUIntSize(str.size()) + str.size();
     }
     
-    void BlueprintSerializer::WriteString(std::vector<uint8_t>& buffer, const std::string& str)
+    static size_t FloatArraySize(const std::vector<float>& values)
     {
-        WriteUInt32(buffer, static_cast<uint32_t>(str.size()));
-        for (char c : str)
-        {
-            buffer.push_back(static_cast<uint8_t>(c));
-        }
+        return BinaryCodec::VarUIntSize(values.size()) + values.size() * sizeof(float);
     }
     
-    void BlueprintSerializer::WriteFloat(std::vector<uint8_t>& buffer, float value)
+    /// Nodes in id order (128-bit order == string order) for a deterministic layout
+    static std::vector<const ASTNode*> SortedNodes(const BlockAST& ast)
     {
-        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
-        for (int i = 0; i < 4; ++i)
+        std::vector<const ASTNode*> nodes;
+        nodes.reserve(ast.Nodes.size());
+        for (const auto& [id, node] : ast.Nodes)
         {
-            buffer.push_back(bytes[i]);
+            nodes.push_back(&node);
         }
+        std::sort(nodes.begin(), nodes.end(),
+            [](const ASTNode* a, const ASTNode* b) { return a->Id < b->Id; });
+        return nodes;
     }
     
-    void BlueprintSerializer::WriteInt32(std::vector<uint8_t>& buffer, int32_t value)
+    size_t BlueprintSerializer::GetEncodedSize(const AbilityBlueprint& blueprint)
     {
-        for (int i = 0; i < 4; ++i)
+        size_t size = 4 + 4 + 4;                                    // Magic, format version, blueprint version
+        size += 16 + StringSize(blueprint.Name) + StringSize(blueprint.Description) + StringSize(blueprint.IconPath);
+        size += 4 * sizeof(float);
+        size += BinaryCodec::VarUIntSize(BinaryCodec::ZigZagEncode(blueprint.MaxLevel));
+        size += FloatArraySize(blueprint.CooldownPerLevel);
+        size += FloatArraySize(blueprint.ManaCostPerLevel);
+        size += FloatArraySize(blueprint.DamagePerLevel);
+        
+        const BlockAST& ast = blueprint.ScriptAST;
+        size += 16 + BinaryCodec::VarUIntSize(ast.Nodes.size());
+        for (const auto& [id, node] : ast.Nodes)
         {
-            buffer.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+            size += 16 + StringSize(node.TypeId) + 16 + 16;
+            
+            size += BinaryCodec::VarUIntSize(node.Properties.size());
+            for (const auto& [key, value] : node.Properties)
+            {
+                size += StringSize(key) + BinaryCodec::EncodedSize(value);
+            }
+            
+            size += BinaryCodec::VarUIntSize(node.Children.size()) + node.Children.size() * 16;
         }
-    }
-    
-    void BlueprintSerializer::WriteUInt32(std::vector<uint8_t>& buffer, uint32_t value)
-    {
-        for (int i = 0; i < 4; ++i)
+        
+        size += BinaryCodec::VarUIntSize(ast.Connections.size());
+        for (const auto& conn : ast.Connections)
         {
-            buffer.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+            size += 16 + 16 + StringSize(conn.SourcePortName) + StringSize(conn.TargetPortName);
         }
+        
+        return size;
     }
     
-    void BlueprintSerializer::WriteValue(std::vector<uint8_t>& buffer, const Value& value)
+    //=========================================================================
+    // Serialize to Bytes
+    //=========================================================================
+    
+    std::vector<uint8_t> BlueprintSerializer::SerializeToBytes(const AbilityBlueprint& blueprint)
     {
-        // Type
-        buffer.push_back(static_cast<uint8_t>(value.GetType()));
-        
-        // Data based on type
-        switch (value.GetType())
-        {
-            case ValueType::Bool:
-                buffer.push_back(value.AsBool() ? 1 : 0);
-                break;
-            case ValueType::Int:
-                WriteInt32(buffer, value.AsInt());
-                break;
-            case ValueType::Float:
-                WriteFloat(buffer, value.AsFloat());
-                break;
-            case ValueType::String:
-                WriteString(buffer, value.AsString());
-                break;
-            default:
-                // Complex types - serialize as string
-                WriteString(buffer, value.AsString());
-                break;
-        }
+        BinaryWriter writer(GetEncodedSize(blueprint));
+        SerializeTo(blueprint, writer);
+        return writer.TakeBytes();
     }
     
-    UUID BlueprintSerializer::ReadUUID(const uint8_t*& ptr)
+    void BlueprintSerializer::SerializeTo(const AbilityBlueprint& blueprint, BinaryWriter& writer)
     {
-        uint64_t value = 0;
-        for (int i = 0; i < 8; ++i)
+        WriteHeader(blueprint, writer);
+        
+        for (const ASTNode* node : SortedNodes(blueprint.ScriptAST))
         {
-            value |= static_cast<uint64_t>(*ptr++) << (i * 8);
+            WriteNode(*node, writer);
         }
-        return value == 0 ? UUID() : UUID::Generate(); // Simplified
+        
+        WriteConnections(blueprint.ScriptAST, writer);
     }
     
-    std::string BlueprintSerializer::ReadString(const uint8_t*& ptr)
+    void BlueprintSerializer::WriteHeader(const AbilityBlueprint& blueprint, BinaryWriter& writer)
     {
-        uint32_t length = ReadUInt32(ptr);
-        std::string result(reinterpret_cast<const char*>(ptr), length);
-        ptr += length;
-        return result;
+        writer.WriteU32(BINARY_MAGIC);
+        writer.WriteU32(BINARY_VERSION);
+        writer.WriteU32(blueprint.Version);
+        
+        // Basic info
+        writer.WriteUUID(blueprint.Id);
+        writer.WriteString(blueprint.Name);
+        writer.WriteString(blueprint.Description);
+        writer.WriteString(blueprint.IconPath);
+        
+        // Properties
+        writer.WriteF32(blueprint.BaseCooldown);
+        writer.WriteF32(blueprint.ManaCost);
+        writer.WriteF32(blueprint.CastTime);
+        writer.WriteF32(blueprint.Range);
+        writer.WriteVarInt(blueprint.MaxLevel);
+        
+        // Per-level arrays
+        writer.WriteF32Array(blueprint.CooldownPerLevel);
+        writer.WriteF32Array(blueprint.ManaCostPerLevel);
+        writer.WriteF32Array(blueprint.DamagePerLevel);
+        
+        // AST - Nodes follow
+        writer.WriteUUID(blueprint.ScriptAST.RootId);
+        writer.WriteVarUInt(blueprint.ScriptAST.Nodes.size());
     }
     
-    float BlueprintSerializer::ReadFloat(const uint8_t*& ptr)
+    void BlueprintSerializer::WriteNode(const ASTNode& node, BinaryWriter& writer)
     {
-        float value;
-        std::memcpy(&value, ptr, 4);
-        ptr += 4;
-        return value;
+        writer.WriteUUID(node.Id);
+        writer.WriteString(node.TypeId);
+        writer.WriteUUID(node.NextBlockId);
+        writer.WriteUUID(node.ParentId);
+        
+        // Properties (std::map, already in key order)
+        writer.WriteVarUInt(node.Properties.size());
+        for (const auto& [key, value] : node.Properties)
+        {
+            writer.WriteString(key);
+            writer.WriteValue(value);
+        }
+        
+        // Children
+        writer.WriteVarUInt(node.Children.size());
+        for (const UUID& childId : node.Children)
+        {
+            writer.WriteUUID(childId);
+        }
     }
     
-    int32_t BlueprintSerializer::ReadInt32(const uint8_t*& ptr)
+    void BlueprintSerializer::WriteConnections(const BlockAST& ast, BinaryWriter& writer)
     {
-        int32_t value = 0;
-        for (int i = 0; i < 4; ++i)
+        writer.WriteVarUInt(ast.Connections.size());
+        for (const auto& conn : ast.Connections)
         {
-            value |= static_cast<int32_t>(*ptr++) << (i * 8);
+            writer.WriteUUID(conn.SourceBlockId);
+            writer.WriteUUID(conn.TargetBlockId);
+            writer.WriteString(conn.SourcePortName);
+            writer.WriteString(conn.TargetPortName);
         }
-        return value;
     }
     
-    uint32_t BlueprintSerializer::ReadUInt32(const uint8_t*& ptr)
+    //=========================================================================
+    // Deserialize from Bytes
+    //=========================================================================
+    
+    AbilityBlueprint BlueprintSerializer::DeserializeFromBytes(const std::vector<uint8_t>& data)
     {
-        uint32_t value = 0;
-        for (int i = 0; i < 4; ++i)
+        AbilityBlueprint blueprint;
+        std::string error;
+        if (!DeserializeFromBytes(data, blueprint, &error))
         {
-            value |= static_cast<uint32_t>(*ptr++) << (i * 8);
+            RS_ERROR("BlueprintSerializer: {}", error);
+            return AbilityBlueprint{};
         }
-        return value;
+        return blueprint;
     }
     
-    Value BlueprintSerializer::ReadValue(const uint8_t*& ptr)
+    bool BlueprintSerializer::ReadNode(BinaryReader& reader, ASTNode& node)
     {
-        ValueType type = static_cast<ValueType>(*ptr++);
+        if (!reader.ReadUUID(node.Id) ||
+            !reader.ReadString(node.TypeId) ||
+            !reader.ReadUUID(node.NextBlockId) ||
+            !reader.ReadUUID(node.ParentId))
+        {
+            return false;
+        }
+        
+        // Properties
+        uint32_t count;
+        if (!reader.ReadCount(count, MinPropertySize)) return false;
         
-        switch (type)
+        std::string key;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Value value;
+            if (!reader.ReadString(key) || !reader.ReadValue(value)) return false;
+            
+            // Keys are written in map order; anything else is not our encoding
+            if (!node.Properties.empty() && !(node.Properties.rbegin()->first < key))
+            {
+                return reader.Fail("Property keys not sorted");
+            }
+            node.Properties.emplace_hint(node.Properties.end(), key, std::move(value));
+        }
+        
+        // Children
+        if (!reader.ReadCount(count, 16)) return false;
+        node.Children.resize(count);
+        for (UUID& childId : node.Children)
         {
-            case ValueType::Bool:
-                return Value(*ptr++ != 0);
-            case ValueType::Int:
-                return Value(ReadInt32(ptr));
-            case ValueType::Float:
-                return Value(ReadFloat(ptr));
-            case ValueType::String:
-                return Value(ReadString(ptr));
-            default:
-                return Value(ReadString(ptr));
+            if (!reader.ReadUUID(childId)) return false;
         }
+        
+        return true;
     }
     
-    //=========================================================================
-    // Serialize to Bytes
-    //=========================================================================
-    
-    std::vector<uint8_t> BlueprintSerializer::SerializeToBytes(const AbilityBlueprint& blueprint)
+    bool BlueprintSerializer::DeserializeFromBytes(std::span<const uint8_t> data, AbilityBlueprint& outBlueprint,
+                                                   std::string* error)
     {
-        std::vector<uint8_t> buffer;
+        auto fail = [error](const char* message)
+        {
+            if (error) *error = message;
+            return false;
+        };
         
-        // Magic number
-        buffer.push_back('R');
-        buffer.push_back('S');
-        buffer.push_back('A');
-        buffer.push_back('B');
+        BinaryReader reader(data);
+        AbilityBlueprint blueprint;
+        
+        uint32_t magic = 0, version = 0;
+        reader.ReadU32(magic);
+        reader.ReadU32(version);
+        if (reader.HasError() || magic != BINARY_MAGIC) return fail("Invalid file format");
+        if (version != BINARY_VERSION) return fail("Unsupported format version");
         
-        // Version
-        WriteUInt32(buffer, blueprint.Version);
+        reader.ReadU32(blueprint.Version);
         
         // Basic info
-        WriteUUID(buffer, blueprint.Id);
-        WriteString(buffer, blueprint.Name);
-        WriteString(buffer, blueprint.Description);
-        WriteString(buffer, blueprint.IconPath);
+        reader.ReadUUID(blueprint.Id);
+        reader.ReadString(blueprint.Name);
+        reader.ReadString(blueprint.Description);
+        reader.ReadString(blueprint.IconPath);
         
         // Properties
-        WriteFloat(buffer, blueprint.BaseCooldown);
-        WriteFloat(buffer, blueprint.ManaCost);
-        WriteFloat(buffer, blueprint.CastTime);
-        WriteFloat(buffer, blueprint.Range);
-        WriteInt32(buffer, blueprint.MaxLevel);
-        
-        // Per-level arrays
-        WriteUInt32(buffer, static_cast<uint32_t>(blueprint.CooldownPerLevel.size()));
-        for (float v : blueprint.CooldownPerLevel) WriteFloat(buffer, v);
+        reader.ReadF32(blueprint.BaseCooldown);
+        reader.ReadF32(blueprint.ManaCost);
+        reader.ReadF32(blueprint.CastTime);
+        reader.ReadF32(blueprint.Range);
         
-        WriteUInt32(buffer, static_cast<uint32_t>(blueprint.ManaCostPerLevel.size()));
-        for (float v : blueprint.ManaCostPerLevel) WriteFloat(buffer, v);
+        int64_t maxLevel = 0;
+        reader.ReadVarInt(maxLevel);
+        if (maxLevel < INT32_MIN || maxLevel > INT32_MAX) reader.Fail("MaxLevel out of range");
+        blueprint.MaxLevel = static_cast<int>(maxLevel);
         
-        WriteUInt32(buffer, static_cast<uint32_t>(blueprint.DamagePerLevel.size()));
-        for (float v : blueprint.DamagePerLevel) WriteFloat(buffer, v);
+        // Per-level arrays
+        reader.ReadF32Array(blueprint.CooldownPerLevel);
+        reader.ReadF32Array(blueprint.ManaCostPerLevel);
+        reader.ReadF32Array(blueprint.DamagePerLevel);
         
         // AST - Nodes
-        WriteUUID(buffer, blueprint.ScriptAST.RootId);
-        WriteUInt32(buffer, static_cast<uint32_t>(blueprint.ScriptAST.Nodes.size()));
+        BlockAST& ast = blueprint.ScriptAST;
+        reader.ReadUUID(ast.RootId);
         
-        // Sort nodes by ID for deterministic order
-        std::vector<UUID> sortedIds;
-        for (const auto& [id, _] : blueprint.ScriptAST.Nodes)
+        uint32_t count = 0;
+        if (reader.ReadCount(count, MinNodeSize))
         {
-            sortedIds.push_back(id);
+            ast.Nodes.reserve(count);
         }
-        std::sort(sortedIds.begin(), sortedIds.end(), [](const UUID& a, const UUID& b) {
-            return a.ToString() < b.ToString();
-        });
         
-        for (const UUID& id : sortedIds)
+        for (uint32_t i = 0; i < count && !reader.HasError(); ++i)
         {
-            const auto& node = blueprint.ScriptAST.Nodes.at(id);
-            WriteUUID(buffer, node.Id);
-            WriteString(buffer, node.TypeId);
-            WriteUUID(buffer, node.NextBlockId);
-            WriteUUID(buffer, node.ParentId);
-            
-            // Properties
-            WriteUInt32(buffer, static_cast<uint32_t>(node.Properties.size()));
-            for (const auto& [key, value] : node.Properties)
-            {
-                WriteString(buffer, key);
-                WriteValue(buffer, value);
-            }
+            ASTNode node;
+            if (!ReadNode(reader, node)) break;
             
-            // Children
-            WriteUInt32(buffer, static_cast<uint32_t>(node.Children.size()));
-            for (const UUID& childId : node.Children)
+            const UUID id = node.Id;
+            if (!ast.Nodes.emplace(id, std::move(node)).second)
             {
-                WriteUUID(buffer, childId);
+                reader.Fail("Duplicate node id");
             }
         }
         
         // AST - Connections
-        WriteUInt32(buffer, static_cast<uint32_t>(blueprint.ScriptAST.Connections.size()));
-        for (const auto& conn : blueprint.ScriptAST.Connections)
+        count = 0;
+        reader.ReadCount(count, MinConnectionSize);
+        ast.Connections.resize(count);
+        for (auto& conn : ast.Connections)
         {
-            WriteUUID(buffer, conn.SourceBlockId);
-            WriteUUID(buffer, conn.TargetBlockId);
-            WriteString(buffer, conn.SourcePortName);
-            WriteString(buffer, conn.TargetPortName);
+            if (!reader.ReadUUID(conn.SourceBlockId) ||
+                !reader.ReadUUID(conn.TargetBlockId) ||
+                !reader.ReadString(conn.SourcePortName) ||
+                !reader.ReadString(conn.TargetPortName))
+            {
+                break;
+            }
         }
         
-        return buffer;
+        if (reader.HasError()) return fail(reader.GetError());
+        if (!reader.IsAtEnd()) return fail("Trailing data");
+        
+        outBlueprint = std::move(blueprint);
+        return true;
     }
     
     //=========================================================================
-    // Deserialize from Bytes
+    // Checksum
     //=========================================================================
     
-    AbilityBlueprint BlueprintSerializer::DeserializeFromBytes(const std::vector<uint8_t>& data)
+    // Scratch buffer for canonical encodings that are only hashed
+    static BinaryWriter& GetHashWriter()
     {
-        AbilityBlueprint blueprint;
-        const uint8_t* ptr = data.data();
-        
-        // Check magic
-        if (data.size() < 4 || ptr[0] != 'R' || ptr[1] != 'S' || ptr[2] != 'A' || ptr[3] != 'B')
-        {
-            RS_ERROR("BlueprintSerializer: Invalid file format");
-            return blueprint;
-        }
-        ptr += 4;
-        
-        // Version
-        blueprint.Version = ReadUInt32(ptr);
-        
-        // Basic info
-        blueprint.Id = ReadUUID(ptr);
-        blueprint.Name = ReadString(ptr);
-        blueprint.Description = ReadString(ptr);
-        blueprint.IconPath = ReadString(ptr);
+        thread_local BinaryWriter writer(4096);
+        writer.Clear();
+        return writer;
+    }
+    
+    Hash128 BlueprintSerializer::ComputeNodeHash(const ASTNode& node)
+    {
+        BinaryWriter& writer = GetHashWriter();
+        WriteNode(node, writer);
+        return ContentHash::Compute(writer.GetBytes());
+    }
+    
+    Hash128 BlueprintSerializer::ComputeContentHash(const AbilityBlueprint& blueprint)
+    {
+        return ComputeContentHash(blueprint, blueprint.ScriptAST.GetNodesHash());
+    }
+    
+    Hash128 BlueprintSerializer::ComputeContentHashUncached(const AbilityBlueprint& blueprint)
+    {
+        return ComputeContentHash(blueprint, blueprint.ScriptAST.ComputeNodesHash());
+    }
+    
+    Hash128 BlueprintSerializer::ComputeContentHash(const AbilityBlueprint& blueprint, const Hash128& nodes)
+    {
+        // Same layout as SerializeTo() with the node records replaced by their Merkle root
+        BinaryWriter& writer = GetHashWriter();
+        WriteHeader(blueprint, writer);
+        writer.WriteU64(nodes.Low);
+        writer.WriteU64(nodes.High);
+        WriteConnections(blueprint.ScriptAST, writer);
         
-        // Properties
-        blueprint.BaseCooldown = ReadFloat(ptr);
-        blueprint.ManaCost = ReadFloat(ptr);
-        blueprint.CastTime = ReadFloat(ptr);
-        blueprint.Range = ReadFloat(ptr);
-        blueprint.MaxLevel = ReadInt32(ptr);
+        return ContentHash::Compute(writer.GetBytes());
+    }
+    
+    uint64_t BlueprintSerializer::ComputeChecksum(const AbilityBlueprint& blueprint)
+    {
+        return ComputeContentHash(blueprint).Low;
+    }
+    
+    uint64_t BlueprintSerializer::ComputeChecksumUncached(const AbilityBlueprint& blueprint)
+    {
+        return ComputeContentHashUncached(blueprint).Low;
+    }
+    
+    //=========================================================================
+    // BlockAST - Node hash cache
+    //=========================================================================
+    
+    ASTNode* BlockAST::EditNode(const UUID& id)
+    {
+        auto it = Nodes.find(id);
+        if (it == Nodes.end()) return nullptr;
         
-        // Per-level arrays
-        uint32_t count = ReadUInt32(ptr);
-        blueprint.CooldownPerLevel.resize(count);
-        for (uint32_t i = 0; i < count; ++i) blueprint.CooldownPerLevel[i] = ReadFloat(ptr);
+        MarkNodeDirty(id);
+        return &it->second;
+    }
+    
+    void BlockAST::MarkNodeDirty(const UUID& id)
+    {
+        ASTHashCache& cache = HashCache;
+        std::lock_guard<std::mutex> lock(cache.Mutex);
+        if (!cache.Valid) return;
         
-        count = ReadUInt32(ptr);
-        blueprint.ManaCostPerLevel.resize(count);
-        for (uint32_t i = 0; i < count; ++i) blueprint.ManaCostPerLevel[i] = ReadFloat(ptr);
+        auto it = std::lower_bound(cache.Order.begin(), cache.Order.end(), id);
+        if (it == cache.Order.end() || *it != id)
+        {
+            // Not hashed yet: a new node, rebuild the order
+            cache.Reorder = true;
+            return;
+        }
         
-        count = ReadUInt32(ptr);
-        blueprint.DamagePerLevel.resize(count);
-        for (uint32_t i = 0; i < count; ++i) blueprint.DamagePerLevel[i] = ReadFloat(ptr);
+        cache.DirtyLeaves.push_back(static_cast<uint32_t>(it - cache.Order.begin()));
+    }
+    
+    static std::vector<UUID> SortedNodeIds(const BlockAST& ast)
+    {
+        std::vector<UUID> order;
+        order.reserve(ast.Nodes.size());
+        for (const auto& [id, node] : ast.Nodes)
+        {
+            order.push_back(id);
+        }
+        std::sort(order.begin(), order.end());
+        return order;
+    }
+    
+    /// Fill the inner nodes of an implicit tree whose leaves are set
+    static void CombineLevels(std::vector<Hash128>& tree, size_t width)
+    {
+        for (size_t i = width - 1; i >= 1; --i)
+        {
+            tree[i] = ContentHash::Combine(tree[2 * i], tree[2 * i + 1]);
+        }
+    }
+    
+    /// Bring the cache up to date; the caller holds cache.Mutex
+    static Hash128 UpdateNodesHash(const BlockAST& ast, ASTHashCache& cache)
+    {
+        bool rebuild = !cache.Valid || cache.Reorder || cache.Order.size() != ast.Nodes.size();
         
-        // AST - Nodes
-        blueprint.ScriptAST.RootId = ReadUUID(ptr);
-        count = ReadUInt32(ptr);
+        // Same count, but nodes may have been removed and others added
+        // without marking; looking ids up is far cheaper than hashing
+        for (size_t i = 0; i < cache.Order.size() && !rebuild; ++i)
+        {
+            rebuild = !ast.Nodes.contains(cache.Order[i]);
+        }
         
-        for (uint32_t i = 0; i < count; ++i)
+        if (rebuild)
         {
-            ASTNode node;
-            node.Id = ReadUUID(ptr);
-            node.TypeId = ReadString(ptr);
-            node.NextBlockId = ReadUUID(ptr);
-            node.ParentId = ReadUUID(ptr);
+            std::vector<UUID> order = SortedNodeIds(ast);
+            const size_t width = std::bit_ceil(std::max<size_t>(order.size(), 1));
+            std::vector<Hash128> tree(width * 2);
             
-            // Properties
-            uint32_t propCount = ReadUInt32(ptr);
-            for (uint32_t j = 0; j < propCount; ++j)
+            // Nodes added or removed: leaves of clean nodes move to their new
+            // position, only new and dirty nodes are hashed
+            std::vector<uint8_t> reuse;
+            if (cache.Valid)
             {
-                std::string key = ReadString(ptr);
-                Value value = ReadValue(ptr);
-                node.Properties[key] = value;
+                reuse.assign(cache.Order.size(), 1);
+                for (uint32_t leaf : cache.DirtyLeaves)
+                {
+                    reuse[leaf] = 0;
+                }
             }
             
-            // Children
-            uint32_t childCount = ReadUInt32(ptr);
-            node.Children.resize(childCount);
-            for (uint32_t j = 0; j < childCount; ++j)
+            size_t previous = 0;
+            for (size_t i = 0; i < order.size(); ++i)
             {
-                node.Children[j] = ReadUUID(ptr);
+                if (!reuse.empty())
+                {
+                    while (previous < cache.Order.size() && cache.Order[previous] < order[i]) ++previous;
+                    if (previous < cache.Order.size() && cache.Order[previous] == order[i] && reuse[previous])
+                    {
+                        tree[width + i] = cache.Tree[cache.Width + previous];
+                        continue;
+                    }
+                }
+                tree[width + i] = BlueprintSerializer::ComputeNodeHash(ast.Nodes.at(order[i]));
             }
+            CombineLevels(tree, width);
             
-            blueprint.ScriptAST.Nodes[node.Id] = node;
+            cache.Order = std::move(order);
+            cache.Tree = std::move(tree);
+            cache.Width = width;
+            cache.DirtyLeaves.clear();
+            cache.Valid = true;
+            cache.Reorder = false;
         }
-        
-        // AST - Connections
-        count = ReadUInt32(ptr);
-        blueprint.ScriptAST.Connections.resize(count);
-        for (uint32_t i = 0; i < count; ++i)
+        else if (!cache.DirtyLeaves.empty())
         {
-            blueprint.ScriptAST.Connections[i].SourceBlockId = ReadUUID(ptr);
-            blueprint.ScriptAST.Connections[i].TargetBlockId = ReadUUID(ptr);
-            blueprint.ScriptAST.Connections[i].SourcePortName = ReadString(ptr);
-            blueprint.ScriptAST.Connections[i].TargetPortName = ReadString(ptr);
+            std::sort(cache.DirtyLeaves.begin(), cache.DirtyLeaves.end());
+            cache.DirtyLeaves.erase(std::unique(cache.DirtyLeaves.begin(), cache.DirtyLeaves.end()),
+                                    cache.DirtyLeaves.end());
+            
+            // Rehash the leaves, then each level's touched parents once
+            std::vector<uint32_t>& level = cache.DirtyLeaves;
+            for (uint32_t& leaf : level)
+            {
+                cache.Tree[cache.Width + leaf] = BlueprintSerializer::ComputeNodeHash(ast.Nodes.at(cache.Order[leaf]));
+                leaf += static_cast<uint32_t>(cache.Width);
+            }
+            
+            while (level.front() > 1)
+            {
+                size_t count = 0;
+                for (uint32_t node : level)
+                {
+                    const uint32_t parent = node / 2;
+                    if (count == 0 || level[count - 1] != parent)
+                    {
+                        level[count++] = parent;
+                        cache.Tree[parent] = ContentHash::Combine(cache.Tree[2 * parent], cache.Tree[2 * parent + 1]);
+                    }
+                }
+                level.resize(count);
+            }
+            
+            level.clear();
         }
         
-        return blueprint;
+        return cache.Tree[1];
+    }
+    
+    Hash128 BlockAST::GetNodesHash() const
+    {
+        std::lock_guard<std::mutex> lock(HashCache.Mutex);
+        return UpdateNodesHash(*this, HashCache);
+    }
+    
+    Hash128 BlockAST::ComputeNodesHash() const
+    {
+        const std::vector<UUID> order = SortedNodeIds(*this);
+        const size_t width = std::bit_ceil(std::max<size_t>(order.size(), 1));
+        
+        std::vector<Hash128> tree(width * 2);
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            tree[width + i] = BlueprintSerializer::ComputeNodeHash(Nodes.at(order[i]));
+        }
+        CombineLevels(tree, width);
+        return tree[1];
     }
     
     //=========================================================================
-    // Checksum
+    // BlueprintCompiler
     //=========================================================================
     
-    uint64_t BlueprintSerializer::ComputeChecksum(const AbilityBlueprint& blueprint)
+    namespace
     {
-        auto bytes = SerializeToBytes(blueprint);
+        /// Downstream hashes: a node's hash covers its own encoding and
+        /// everything its block links to, so equal hashes mean the previous
+        /// version's block (with all its links) can be reused as is
+        struct ReachHasher
+        {
+            enum : uint8_t { Unvisited, Visiting, Done };
+            
+            const BlockAST& AST;
+            const ASTHashCache& Cache;                                       // Order is the node index
+            std::unordered_multimap<UUID, const ASTConnection*> Inputs;     // Target node -> connection
+            std::vector<Hash128> Hashes;
+            std::vector<uint8_t> States;
+            bool Cyclic = false;
+            
+            explicit ReachHasher(const BlockAST& ast)
+                : AST(ast)
+                , Cache(ast.HashCache)
+                , Hashes(Cache.Order.size())
+                , States(Cache.Order.size(), Unvisited)
+            {
+                for (const ASTConnection& connection : ast.Connections)
+                {
+                    Inputs.emplace(connection.TargetBlockId, &connection);
+                }
+            }
+            
+            Hash128 Reach(const UUID& id)
+            {
+                auto it = std::lower_bound(Cache.Order.begin(), Cache.Order.end(), id);
+                if (it == Cache.Order.end() || *it != id) return Hash128{};
+                return Reach(static_cast<size_t>(it - Cache.Order.begin()));
+            }
+            
+            Hash128 Reach(size_t index)
+            {
+                if (States[index] == Done) return Hashes[index];
+                if (States[index] == Visiting)
+                {
+                    Cyclic = true;
+                    return Hash128{};
+                }
+                States[index] = Visiting;
+                
+                const UUID& id = Cache.Order[index];
+                const ASTNode& node = AST.Nodes.at(id);
+                const auto [first, last] = Inputs.equal_range(id);
+                
+                Hash128 hash = ContentHash::Combine(Cache.Tree[Cache.Width + index],
+                    Hash128{ node.Children.size(), static_cast<u64>(std::distance(first, last)) });
+                for (const UUID& child : node.Children)
+                {
+                    hash = ContentHash::Combine(hash, Reach(child));
+                }
+                for (auto it = first; it != last; ++it)
+                {
+                    const ASTConnection& connection = *it->second;
+                    const Hash128 ports = ContentHash::Combine(
+                        ContentHash::Compute(connection.SourcePortName.data(), connection.SourcePortName.size()),
+                        ContentHash::Compute(connection.TargetPortName.data(), connection.TargetPortName.size()));
+                    hash = ContentHash::Combine(hash, ContentHash::Combine(ports, Reach(connection.SourceBlockId)));
+                }
+                if (node.NextBlockId.IsValid())
+                {
+                    hash = ContentHash::Combine(hash, Reach(node.NextBlockId));
+                }
+                
+                States[index] = Done;
+                Hashes[index] = hash;
+                return hash;
+            }
+        };
+    }
+    
+    BlueprintProgramPtr BlueprintCompiler::Compile(const AbilityBlueprint& blueprint, const BlueprintProgram* previous)
+    {
+        const BlockAST& ast = blueprint.ScriptAST;
+        auto program = std::make_shared<BlueprintProgram>();
+        
+        // Also brings the AST's node hashes up to date
+        program->ContentHash = BlueprintSerializer::ComputeContentHash(blueprint);
         
-        // Simple FNV-1a hash
-        uint64_t hash = 14695981039346656037ULL;
-        for (uint8_t byte : bytes)
+        ReachHasher hasher(ast);
+        const std::vector<UUID>& order = ast.HashCache.Order;
+        for (size_t i = 0; i < order.size(); ++i)
         {
-            hash ^= byte;
-            hash *= 1099511628211ULL;
+            hasher.Reach(i);
         }
-        return hash;
+        const std::vector<Hash128>& hashes = hasher.Hashes;
+        
+        // A cycle makes downstream hashes meaningless; build everything fresh
+        if (hasher.Cyclic) previous = nullptr;
+        
+        const BlockRegistry& registry = BlockRegistry::Get();
+        std::vector<BlockPtr> blocks;
+        std::vector<const ASTNode*> rebuilt;
+        blocks.reserve(order.size());
+        program->Nodes.reserve(order.size());
+        
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            const UUID& id = order[i];
+            
+            if (previous)
+            {
+                auto it = previous->Nodes.find(id);
+                if (it != previous->Nodes.end() && it->second.Hash == hashes[i])
+                {
+                    program->Nodes.emplace(id, it->second);
+                    blocks.push_back(it->second.Block);
+                    continue;
+                }
+            }
+            
+            const ASTNode& node = ast.Nodes.at(id);
+            BlockPtr block = registry.CreateBlock(registry.GetTypeIndex(node.TypeId), id);
+            if (!block)
+            {
+                RS_ERROR("BlueprintCompiler: '{}' uses unknown block type '{}'", blueprint.Name, node.TypeId);
+                continue;
+            }
+            
+            for (const auto& [name, value] : node.Properties)
+            {
+                if (BlockSlot* slot = block->GetInputSlot(name)) slot->SetDefaultValue(value);
+            }
+            
+            program->Nodes.emplace(id, BlueprintProgram::CompiledNode{ hashes[i], block });
+            blocks.push_back(std::move(block));
+            rebuilt.push_back(&node);
+        }
+        
+        auto find = [&](const UUID& id) -> BlockPtr
+        {
+            auto it = program->Nodes.find(id);
+            return it != program->Nodes.end() ? it->second.Block : nullptr;
+        };
+        
+        // Only new blocks are wired; reused ones already link to blocks that
+        // were reused with them
+        for (const ASTNode* node : rebuilt)
+        {
+            Block* block = find(node->Id).get();
+            
+            if (block->GetNestedSlotCount() > 0)
+            {
+                BlockSlot* body = block->GetNestedSlot(size_t{ 0 });
+                for (const UUID& child : node->Children)
+                {
+                    if (BlockPtr nested = find(child)) body->AddNestedBlock(std::move(nested));
+                }
+            }
+            
+            const auto [first, last] = hasher.Inputs.equal_range(node->Id);
+            for (auto it = first; it != last; ++it)
+            {
+                BlockSlot* slot = block->GetInputSlot(it->second->TargetPortName);
+                BlockPtr source = find(it->second->SourceBlockId);
+                if (slot && source) slot->Connect(std::move(source));
+            }
+            
+            // Sets the next block's editor-only back link, which is harmless
+            // when that block is shared with the previous version
+            if (node->NextBlockId.IsValid())
+            {
+                if (BlockPtr next = find(node->NextBlockId)) block->SetNextBlock(std::move(next));
+            }
+        }
+        
+        program->RecompiledNodes = static_cast<uint32_t>(rebuilt.size());
+        program->Script = CompiledScript::Assemble(blueprint.Id, blueprint.Version, blueprint.Name, std::move(blocks));
+        return program;
     }
     
     //=========================================================================
@@ -378,21 +735,66 @@ namespace RiftSpire
     // AbilityBlueprintLibrary
     //=========================================================================
     
+    AbilityBlueprintLibrary::AbilityBlueprintLibrary()
+        : m_CastPrograms(std::make_unique<AbilityProgramCache>())
+    {
+    }
+    
+    AbilityBlueprintLibrary::~AbilityBlueprintLibrary() = default;
+    
     AbilityBlueprintLibrary& AbilityBlueprintLibrary::Get()
     {
         static AbilityBlueprintLibrary s_Instance;
         return s_Instance;
     }
     
+    void AbilityBlueprintLibrary::ShadowPacked(const UUID& id)
+    {
+        for (MountedPack& mounted : m_Packs)
+        {
+            const size_t index = mounted.Pack->Find(id);
+            if (index != BlueprintPack::InvalidEntry) mounted.States[index] = PackEntryState::Shadowed;
+        }
+    }
+    
+    void AbilityBlueprintLibrary::Insert(AbilityBlueprint&& blueprint)
+    {
+        const UUID id = blueprint.Id;
+        
+        // Packed copies must never be decoded over this one
+        ShadowPacked(id);
+        
+        auto it = m_Blueprints.find(id);
+        if (it != m_Blueprints.end() && it->second.Name != blueprint.Name)
+        {
+            m_NameToId.erase(it->second.Name);
+        }
+        
+        m_NameToId[blueprint.Name] = id;
+        m_Blueprints[id] = std::move(blueprint);
+        m_Checksums.erase(id);
+    }
+    
     void AbilityBlueprintLibrary::RegisterBlueprint(const AbilityBlueprint& blueprint)
     {
-        m_Blueprints[blueprint.Id] = blueprint;
-        m_NameToId[blueprint.Name] = blueprint.Id;
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        AbilityBlueprint copy = blueprint;
+        Insert(std::move(copy));
+        
+        // A compiled program is now stale; the next ReloadDirty() rebuilds it
+        if (m_Programs.count(blueprint.Id)) m_DirtyBlueprints.push_back(blueprint.Id);
         RS_INFO("AbilityBlueprintLibrary: Registered '{}'", blueprint.Name);
     }
     
     void AbilityBlueprintLibrary::UnregisterBlueprint(const UUID& id)
     {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        ShadowPacked(id);
+        m_Programs.erase(id);
+        m_Checksums.erase(id);
+        
         auto it = m_Blueprints.find(id);
         if (it != m_Blueprints.end())
         {
@@ -401,25 +803,152 @@ namespace RiftSpire
         }
     }
     
-    const AbilityBlueprint* AbilityBlueprintLibrary::GetBlueprint(const UUID& id) const
+    const AbilityBlueprint* AbilityBlueprintLibrary::DecodePacked(MountedPack& mounted, size_t index) const
+    {
+        AbilityBlueprint blueprint;
+        std::string error;
+        if (!mounted.Pack->Decode(index, blueprint, &error))
+        {
+            mounted.States[index] = PackEntryState::Shadowed;
+            RS_ERROR("AbilityBlueprintLibrary: Packed blueprint {} is invalid: {}", mounted.Pack->GetId(index).ToString(), error);
+            return nullptr;
+        }
+        mounted.States[index] = PackEntryState::Decoded;
+        
+        const UUID id = blueprint.Id;
+        auto it = m_Blueprints.find(id);
+        if (it != m_Blueprints.end() && it->second.Name != blueprint.Name)
+        {
+            m_NameToId.erase(it->second.Name);
+        }
+        m_NameToId.try_emplace(blueprint.Name, id);
+        m_Checksums.erase(id);
+        
+        // Assign in place so pointers handed out for this id stay valid
+        return &m_Blueprints.insert_or_assign(id, std::move(blueprint)).first->second;
+    }
+    
+    const AbilityBlueprint* AbilityBlueprintLibrary::FindOrDecode(const UUID& id) const
     {
         auto it = m_Blueprints.find(id);
-        return it != m_Blueprints.end() ? &it->second : nullptr;
+        if (it != m_Blueprints.end()) return &it->second;
+        
+        // Newest pack first
+        for (auto mounted = m_Packs.rbegin(); mounted != m_Packs.rend(); ++mounted)
+        {
+            const size_t index = mounted->Pack->Find(id);
+            if (index != BlueprintPack::InvalidEntry && mounted->States[index] == PackEntryState::Pending)
+            {
+                return DecodePacked(*mounted, index);
+            }
+        }
+        return nullptr;
+    }
+    
+    void AbilityBlueprintLibrary::DecodeAllPacked() const
+    {
+        for (auto mounted = m_Packs.rbegin(); mounted != m_Packs.rend(); ++mounted)
+        {
+            for (size_t i = 0; i < mounted->States.size(); ++i)
+            {
+                if (mounted->States[i] != PackEntryState::Pending) continue;
+                
+                // An id already present came from a newer pack or a registration
+                if (m_Blueprints.count(mounted->Pack->GetId(i)))
+                {
+                    mounted->States[i] = PackEntryState::Shadowed;
+                    continue;
+                }
+                DecodePacked(*mounted, i);
+            }
+        }
+    }
+    
+    const AbilityBlueprint* AbilityBlueprintLibrary::GetBlueprint(const UUID& id) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return FindOrDecode(id);
     }
     
     const AbilityBlueprint* AbilityBlueprintLibrary::GetBlueprintByName(const std::string& name) const
     {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
         auto it = m_NameToId.find(name);
         if (it != m_NameToId.end())
         {
-            return GetBlueprint(it->second);
+            return FindOrDecode(it->second);
+        }
+        
+        // Packs only store name hashes; decode the candidates to compare
+        for (auto mounted = m_Packs.rbegin(); mounted != m_Packs.rend(); ++mounted)
+        {
+            const AbilityBlueprint* found = nullptr;
+            mounted->Pack->ForEachNameMatch(name, [&](size_t index)
+            {
+                if (found || mounted->States[index] != PackEntryState::Pending) return;
+                if (m_Blueprints.count(mounted->Pack->GetId(index))) return;
+                
+                const AbilityBlueprint* blueprint = DecodePacked(*mounted, index);
+                if (blueprint && blueprint->Name == name) found = blueprint;
+            });
+            if (found) return found;
         }
         return nullptr;
     }
     
+    BlueprintProgramPtr AbilityBlueprintLibrary::GetProgram(const UUID& id) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        auto it = m_Programs.find(id);
+        if (it != m_Programs.end()) return it->second;
+        
+        const AbilityBlueprint* blueprint = FindOrDecode(id);
+        if (!blueprint) return nullptr;
+        
+        BlueprintProgramPtr program = BlueprintCompiler::Compile(*blueprint);
+        m_Programs.emplace(id, program);
+        return program;
+    }
+    
+    CastProgramPtr AbilityBlueprintLibrary::GetCastProgram(const UUID& id, int level) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        const AbilityBlueprint* blueprint = FindOrDecode(id);
+        if (!blueprint) return nullptr;
+        
+        auto checksum = m_Checksums.find(id);
+        if (checksum == m_Checksums.end())
+        {
+            checksum = m_Checksums.emplace(id, BlueprintSerializer::ComputeChecksumUncached(*blueprint)).first;
+        }
+        
+        auto published = m_Programs.find(id);
+        return m_CastPrograms->Get(*blueprint, checksum->second, level,
+                                   published != m_Programs.end() ? published->second : nullptr);
+    }
+    
+    void AbilityBlueprintLibrary::SetProgramCacheBudget(size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_CastPrograms->SetBudget(bytes);
+    }
+    
+    size_t AbilityBlueprintLibrary::GetProgramCacheMemoryUsage() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return m_CastPrograms->GetMemoryUsage();
+    }
+    
     std::vector<const AbilityBlueprint*> AbilityBlueprintLibrary::GetAllBlueprints() const
     {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        DecodeAllPacked();
+        
         std::vector<const AbilityBlueprint*> result;
+        result.reserve(m_Blueprints.size());
         for (const auto& [id, bp] : m_Blueprints)
         {
             result.push_back(&bp);
@@ -427,14 +956,401 @@ namespace RiftSpire
         return result;
     }
     
+    //=========================================================================
+    // AbilityBlueprintLibrary - Files
+    //=========================================================================
+    
+    static bool ReadBlueprintFile(const std::string& path, AbilityBlueprint& outBlueprint, std::string& error)
+    {
+        auto file = MappedFile::Open(path);
+        if (!file)
+        {
+            error = "Cannot open file";
+            return false;
+        }
+        return BlueprintSerializer::DeserializeFromBytes(file->GetBytes(), outBlueprint, &error);
+    }
+    
+    /// Key for m_PathToId: the watcher reports paths as directory + name
+    static std::string NormalizePath(const std::string& path)
+    {
+        std::error_code ec;
+        std::filesystem::path absolute = std::filesystem::absolute(path, ec);
+        return (ec ? std::filesystem::path(path) : absolute).lexically_normal().string();
+    }
+    
+    /// Runs fn(i) for i in [0, count) on up to hardware_concurrency threads
+    template<typename Fn>
+    static void ParallelFor(size_t count, size_t minPerThread, Fn&& fn)
+    {
+        const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        const size_t threadCount = std::min(hardware, (count + minPerThread - 1) / minPerThread);
+        
+        if (threadCount <= 1)
+        {
+            for (size_t i = 0; i < count; ++i) fn(i);
+            return;
+        }
+        
+        std::atomic<size_t> next{ 0 };
+        auto worker = [&]()
+        {
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+                 i = next.fetch_add(1, std::memory_order_relaxed))
+            {
+                fn(i);
+            }
+        };
+        
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (size_t t = 1; t < threadCount; ++t)
+        {
+            threads.emplace_back(worker);
+        }
+        worker();
+        
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+    
+    bool AbilityBlueprintLibrary::LoadFromFile(const std::string& path)
+    {
+        AbilityBlueprint blueprint;
+        std::string error;
+        if (!ReadBlueprintFile(path, blueprint, error))
+        {
+            RS_ERROR("AbilityBlueprintLibrary: Failed to load '{}': {}", path, error);
+            return false;
+        }
+        
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Programs.count(blueprint.Id)) m_DirtyBlueprints.push_back(blueprint.Id);
+        TrackPath(NormalizePath(path), blueprint.Id);
+        Insert(std::move(blueprint));
+        return true;
+    }
+    
+    bool AbilityBlueprintLibrary::SaveToFile(const std::string& path, const UUID& blueprintId)
+    {
+        std::vector<uint8_t> bytes;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            const AbilityBlueprint* blueprint = FindOrDecode(blueprintId);
+            if (!blueprint) return false;
+            bytes = BlueprintSerializer::SerializeToBytes(*blueprint);
+        }
+        
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            RS_ERROR("AbilityBlueprintLibrary: Cannot write '{}'", path);
+            return false;
+        }
+        
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        file.close();
+        return static_cast<bool>(file);
+    }
+    
+    bool AbilityBlueprintLibrary::LoadAllFromDirectory(const std::string& directory)
+    {
+        std::error_code ec;
+        std::vector<std::string> paths;
+        for (const auto& entry : std::filesystem::directory_iterator(directory, ec))
+        {
+            if (entry.is_regular_file(ec) && entry.path().extension() == FileExtension)
+            {
+                paths.push_back(entry.path().string());
+            }
+        }
+        if (ec)
+        {
+            RS_ERROR("AbilityBlueprintLibrary: Cannot read directory '{}'", directory);
+            return false;
+        }
+        
+        // Directory order is filesystem dependent; registration order must not be
+        std::sort(paths.begin(), paths.end());
+        
+        std::vector<AbilityBlueprint> blueprints(paths.size());
+        std::vector<std::string> errors(paths.size());
+        std::vector<uint8_t> loaded(paths.size(), 0);
+        
+        ParallelFor(paths.size(), 8, [&](size_t i)
+        {
+            loaded[i] = ReadBlueprintFile(paths[i], blueprints[i], errors[i]) ? 1 : 0;
+        });
+        
+        size_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (size_t i = 0; i < paths.size(); ++i)
+            {
+                if (!loaded[i]) continue;
+                if (m_Programs.count(blueprints[i].Id)) m_DirtyBlueprints.push_back(blueprints[i].Id);
+                TrackPath(NormalizePath(paths[i]), blueprints[i].Id);
+                Insert(std::move(blueprints[i]));
+                count++;
+            }
+        }
+        
+        for (size_t i = 0; i < paths.size(); ++i)
+        {
+            if (!loaded[i]) RS_ERROR("AbilityBlueprintLibrary: Failed to load '{}': {}", paths[i], errors[i]);
+        }
+        
+        RS_INFO("AbilityBlueprintLibrary: Loaded {} of {} blueprints from '{}'", count, paths.size(), directory);
+        return count == paths.size();
+    }
+    
+    bool AbilityBlueprintLibrary::LoadPack(const std::string& path)
+    {
+        std::string error;
+        auto pack = BlueprintPack::Open(path, &error);
+        if (!pack)
+        {
+            RS_ERROR("AbilityBlueprintLibrary: Failed to open pack '{}': {}", path, error);
+            return false;
+        }
+        
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        MountedPack mounted;
+        mounted.States.assign(pack->GetEntryCount(), PackEntryState::Pending);
+        mounted.Pack = std::move(pack);
+        
+        // A newer pack overrides older ones; copies already decoded from an
+        // older pack are replaced now, the rest simply never get decoded
+        for (size_t i = 0; i < mounted.States.size(); ++i)
+        {
+            const UUID id = mounted.Pack->GetId(i);
+            bool replace = false;
+            for (MountedPack& older : m_Packs)
+            {
+                const size_t index = older.Pack->Find(id);
+                if (index == BlueprintPack::InvalidEntry) continue;
+                
+                replace |= older.States[index] == PackEntryState::Decoded;
+                older.States[index] = PackEntryState::Shadowed;
+            }
+            
+            if (replace) DecodePacked(mounted, i);
+        }
+        
+        RS_INFO("AbilityBlueprintLibrary: Mounted '{}' ({} blueprints)", path, mounted.Pack->GetEntryCount());
+        m_Packs.push_back(std::move(mounted));
+        return true;
+    }
+    
+    bool AbilityBlueprintLibrary::SavePack(const std::string& path) const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        DecodeAllPacked();
+        
+        std::vector<const AbilityBlueprint*> blueprints;
+        blueprints.reserve(m_Blueprints.size());
+        for (const auto& [id, bp] : m_Blueprints)
+        {
+            blueprints.push_back(&bp);
+        }
+        
+        std::string error;
+        if (!BlueprintPack::Write(path, blueprints, &error))
+        {
+            RS_ERROR("AbilityBlueprintLibrary: Failed to write pack '{}': {}", path, error);
+            return false;
+        }
+        return true;
+    }
+    
+    //=========================================================================
+    // AbilityBlueprintLibrary - Hot reload
+    //=========================================================================
+    
+    void AbilityBlueprintLibrary::TrackPath(const std::string& path, const UUID& id)
+    {
+        auto previous = m_PathToId.find(path);
+        if (previous != m_PathToId.end() && previous->second != id)
+        {
+            m_IdToPath.erase(previous->second);
+        }
+        
+        auto it = m_IdToPath.find(id);
+        if (it != m_IdToPath.end() && it->second != path)
+        {
+            m_PathToId.erase(it->second);
+        }
+        
+        m_PathToId[path] = id;
+        m_IdToPath[id] = path;
+    }
+    
+    bool AbilityBlueprintLibrary::WatchDirectory(const std::string& directory)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        
+        if (!m_Watcher) m_Watcher = std::make_unique<FileWatcher>();
+        if (!m_Watcher->AddDirectory(NormalizePath(directory)))
+        {
+            RS_ERROR("AbilityBlueprintLibrary: Cannot watch '{}'", directory);
+            return false;
+        }
+        return true;
+    }
+    
+    void AbilityBlueprintLibrary::PollFileChanges()
+    {
+        std::vector<std::string> added;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            if (!m_Watcher) return;
+            
+            for (const std::string& path : m_Watcher->Poll())
+            {
+                if (std::filesystem::path(path).extension() != FileExtension) continue;
+                
+                auto it = m_PathToId.find(path);
+                if (it == m_PathToId.end())
+                {
+                    added.push_back(path);
+                    continue;
+                }
+                
+                m_DirtyBlueprints.push_back(it->second);
+                m_ChangeSeen.try_emplace(it->second, m_Watcher->GetFirstEventTime(path));
+            }
+        }
+        
+        for (const std::string& path : added)
+        {
+            LoadFromFile(path);
+        }
+    }
+    
     void AbilityBlueprintLibrary::MarkDirty(const UUID& id)
     {
+        std::lock_guard<std::mutex> lock(m_Mutex);
         m_DirtyBlueprints.push_back(id);
     }
     
     void AbilityBlueprintLibrary::ReloadDirty()
     {
-        // TODO: Implement hot reload
-        m_DirtyBlueprints.clear();
+        using Clock = std::chrono::steady_clock;
+        
+        struct Reload
+        {
+            UUID Id;
+            std::string Path;                   // Empty: recompile the registered copy
+            AbilityBlueprint Blueprint;
+            BlueprintProgramPtr Previous;
+            BlueprintProgramPtr Program;
+            Clock::time_point ChangeSeen;
+            bool Loaded = false;
+            bool Changed = false;
+        };
+        
+        std::vector<Reload> reloads;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            
+            std::sort(m_DirtyBlueprints.begin(), m_DirtyBlueprints.end());
+            m_DirtyBlueprints.erase(std::unique(m_DirtyBlueprints.begin(), m_DirtyBlueprints.end()),
+                                    m_DirtyBlueprints.end());
+            
+            reloads.resize(m_DirtyBlueprints.size());
+            for (size_t i = 0; i < reloads.size(); ++i)
+            {
+                Reload& reload = reloads[i];
+                reload.Id = m_DirtyBlueprints[i];
+                
+                auto path = m_IdToPath.find(reload.Id);
+                if (path != m_IdToPath.end())
+                {
+                    reload.Path = path->second;
+                }
+                else if (const AbilityBlueprint* blueprint = FindOrDecode(reload.Id))
+                {
+                    reload.Blueprint = *blueprint;
+                    reload.Loaded = true;
+                }
+                
+                auto program = m_Programs.find(reload.Id);
+                if (program != m_Programs.end()) reload.Previous = program->second;
+                
+                auto seen = m_ChangeSeen.find(reload.Id);
+                if (seen != m_ChangeSeen.end()) reload.ChangeSeen = seen->second;
+            }
+            
+            m_DirtyBlueprints.clear();
+            m_ChangeSeen.clear();
+        }
+        
+        // Decode, diff and compile without the lock, so lookups are not held up
+        for (Reload& reload : reloads)
+        {
+            if (!reload.Path.empty())
+            {
+                std::string error;
+                reload.Loaded = ReadBlueprintFile(reload.Path, reload.Blueprint, error);
+                if (!reload.Loaded)
+                {
+                    RS_ERROR("AbilityBlueprintLibrary: Failed to reload '{}': {}", reload.Path, error);
+                    continue;
+                }
+                if (reload.Blueprint.Id != reload.Id) reload.Previous = nullptr;
+            }
+            if (!reload.Loaded) continue;
+            
+            // Saved without changes, or already reloaded
+            const Hash128 hash = BlueprintSerializer::ComputeContentHash(reload.Blueprint);
+            reload.Changed = !reload.Previous || reload.Previous->ContentHash != hash;
+            
+            // Never-requested programs stay lazy; GetProgram() compiles them
+            if (reload.Changed && reload.Previous)
+            {
+                reload.Program = BlueprintCompiler::Compile(reload.Blueprint, reload.Previous.get());
+            }
+        }
+        
+        // Publish: each swap is one pointer store under the lock
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        for (Reload& reload : reloads)
+        {
+            if (!reload.Loaded || !reload.Changed) continue;
+            
+            const UUID id = reload.Blueprint.Id;
+            const std::string name = reload.Blueprint.Name;
+            const size_t nodeCount = reload.Blueprint.ScriptAST.Nodes.size();
+            
+            if (!reload.Path.empty())
+            {
+                TrackPath(reload.Path, id);
+                Insert(std::move(reload.Blueprint));
+            }
+            
+            if (reload.Program)
+            {
+                m_Programs[id] = reload.Program;
+            }
+            else
+            {
+                m_Programs.erase(id);
+            }
+            
+            if (reload.Program && reload.ChangeSeen != Clock::time_point{})
+            {
+                const double latency = std::chrono::duration<double, std::milli>(Clock::now() - reload.ChangeSeen).count();
+                RS_INFO("AbilityBlueprintLibrary: Reloaded '{}' ({} of {} nodes recompiled, live {:.2f} ms after the change was seen)",
+                        name, reload.Program->RecompiledNodes, nodeCount, latency);
+            }
+            else if (reload.Program)
+            {
+                RS_INFO("AbilityBlueprintLibrary: Reloaded '{}' ({} of {} nodes recompiled)",
+                        name, reload.Program->RecompiledNodes, nodeCount);
+            }
+        }
     }
 }
@@ -2,10 +2,17 @@
 
 #include "../Core/Block.h"
 #include "../Core/Value.h"
+#include "../Execution/CompiledScript.h"
+#include "ContentHash.h"
 #include <Core/UUID.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <utility>
 #include <memory>
 #include <cstdint>
 
@@ -33,11 +40,73 @@ namespace RiftSpire
         std::string TargetPortName;
     };
     
+    /// Merkle tree over node hashes, leaves in node id order. Stored as an
+    /// implicit binary tree: root at 1, leaf i at Width + i, unused leaves zero.
+    struct ASTHashCache
+    {
+        std::vector<UUID> Order;       // Sorted node ids
+        std::vector<Hash128> Tree;
+        std::vector<uint32_t> DirtyLeaves;
+        size_t Width = 0;
+        bool Valid = false;
+        bool Reorder = false;          // Nodes added or removed; clean leaves are kept
+        std::mutex Mutex;              // Taken by GetNodesHash; copies get their own
+        
+        ASTHashCache() = default;
+        ASTHashCache(const ASTHashCache& other) { *this = other; }
+        ASTHashCache(ASTHashCache&& other) noexcept { *this = std::move(other); }
+        
+        ASTHashCache& operator=(const ASTHashCache& other)
+        {
+            if (this == &other) return *this;
+            Order = other.Order;
+            Tree = other.Tree;
+            DirtyLeaves = other.DirtyLeaves;
+            Width = other.Width;
+            Valid = other.Valid;
+            Reorder = other.Reorder;
+            return *this;
+        }
+        
+        ASTHashCache& operator=(ASTHashCache&& other) noexcept
+        {
+            Order = std::move(other.Order);
+            Tree = std::move(other.Tree);
+            DirtyLeaves = std::move(other.DirtyLeaves);
+            Width = other.Width;
+            Valid = std::exchange(other.Valid, false);
+            Reorder = other.Reorder;
+            return *this;
+        }
+    };
+    
     struct BlockAST
     {
         UUID RootId;                   // Kok blok (Event)
         std::unordered_map<UUID, ASTNode> Nodes;
         std::vector<ASTConnection> Connections;
+        
+        /// Node to modify in place; its cached hash is marked stale
+        ASTNode* EditNode(const UUID& id);
+        
+        /// A node was changed in place without EditNode(), or was added or
+        /// removed. Only those nodes are rehashed; nodes added or removed
+        /// without marking are detected, edits in place are not.
+        void MarkNodeDirty(const UUID& id);
+        
+        /// Nodes were replaced wholesale; the next hash rebuilds the tree.
+        void InvalidateHashes() { HashCache.Valid = false; }
+        
+        /// Merkle root of all nodes. Only dirty nodes and their paths to the
+        /// root are rehashed. Safe to call from several threads at once, but
+        /// not while the AST is being edited.
+        Hash128 GetNodesHash() const;
+        
+        /// Same root hashed from scratch, without reading or updating the
+        /// cache. Use it to verify data that may have been edited directly.
+        Hash128 ComputeNodesHash() const;
+        
+        mutable ASTHashCache HashCache;
     };
     
     //=========================================================================
@@ -75,13 +144,30 @@ namespace RiftSpire
     // BlueprintSerializer - Deterministik serializasyon
     //=========================================================================
     
+    class BinaryWriter;
+    class BinaryReader;
+    
     class BlueprintSerializer
     {
     public:
+        static constexpr uint32_t BINARY_MAGIC = 0x42415352;    // "RSAB"
+        static constexpr uint32_t BINARY_VERSION = 2;           // 2: varint lengths, full Value encoding
+        
         // Binary serializasyon (network ve dosya)
         static std::vector<uint8_t> SerializeToBytes(const AbilityBlueprint& blueprint);
         static AbilityBlueprint DeserializeFromBytes(const std::vector<uint8_t>& data);
         
+        /// Append to a (reusable) writer
+        static void SerializeTo(const AbilityBlueprint& blueprint, BinaryWriter& writer);
+        
+        /// Exact size SerializeToBytes() produces, used to pre-size the buffer
+        static size_t GetEncodedSize(const AbilityBlueprint& blueprint);
+        
+        /// Validating decode for untrusted input (network, files). Every read
+        /// is bounds-checked; truncated or malformed data returns false.
+        static bool DeserializeFromBytes(std::span<const uint8_t> data, AbilityBlueprint& outBlueprint,
+                                         std::string* error = nullptr);
+        
         // JSON serializasyon (debug ve editor)
         static std::string SerializeToJson(const AbilityBlueprint& blueprint);
         static AbilityBlueprint DeserializeFromJson(const std::string& json);
@@ -93,55 +179,184 @@ namespace RiftSpire
         // Checksum (deterministik dogrulama)
         static uint64_t ComputeChecksum(const AbilityBlueprint& blueprint);
         
+        /// Blueprint fields and connections hashed together with the AST's
+        /// Merkle root; ComputeChecksum() is its low half
+        static Hash128 ComputeContentHash(const AbilityBlueprint& blueprint);
+        
+        /// Same values without the AST's hash cache (see ComputeNodesHash),
+        /// for checksums that guard decoding, packing and patching
+        static Hash128 ComputeContentHashUncached(const AbilityBlueprint& blueprint);
+        static uint64_t ComputeChecksumUncached(const AbilityBlueprint& blueprint);
+        
+        /// Hash of one node's canonical encoding (a Merkle leaf)
+        static Hash128 ComputeNodeHash(const ASTNode& node);
+        
+        /// One node record, also used by BlueprintDelta for added nodes
+        static void WriteNode(const ASTNode& node, BinaryWriter& writer);
+        static bool ReadNode(BinaryReader& reader, ASTNode& node);
+        
     private:
-        // Binary helpers
-        static void WriteUUID(std::vector<uint8_t>& buffer, const UUID& id);
-        static void WriteString(std::vector<uint8_t>& buffer, const std::string& str);
-        static void WriteFloat(std::vector<uint8_t>& buffer, float value);
-        static void WriteInt32(std::vector<uint8_t>& buffer, int32_t value);
-        static void WriteUInt32(std::vector<uint8_t>& buffer, uint32_t value);
-        static void WriteValue(std::vector<uint8_t>& buffer, const Value& value);
-        
-        static UUID ReadUUID(const uint8_t*& ptr);
-        static std::string ReadString(const uint8_t*& ptr);
-        static float ReadFloat(const uint8_t*& ptr);
-        static int32_t ReadInt32(const uint8_t*& ptr);
-        static uint32_t ReadUInt32(const uint8_t*& ptr);
-        static Value ReadValue(const uint8_t*& ptr);
+        static void WriteHeader(const AbilityBlueprint& blueprint, BinaryWriter& writer);
+        static Hash128 ComputeContentHash(const AbilityBlueprint& blueprint, const Hash128& nodes);
+        static void WriteConnections(const BlockAST& ast, BinaryWriter& writer);
+    };
+    
+    //=========================================================================
+    // BlueprintProgram - Derlenmis blueprint scripti
+    //=========================================================================
+    
+    struct BlueprintProgram
+    {
+        struct CompiledNode
+        {
+            Hash128 Hash;                  // Node plus everything it reaches (children, next, inputs)
+            BlockPtr Block;
+        };
+        
+        CompiledScriptPtr Script;
+        std::unordered_map<UUID, CompiledNode> Nodes;
+        Hash128 ContentHash;               // BlueprintSerializer::ComputeContentHash of the source
+        uint32_t RecompiledNodes = 0;      // Nodes not reused from the previous version
+    };
+    
+    using BlueprintProgramPtr = std::shared_ptr<const BlueprintProgram>;
+    
+    class BlueprintCompiler
+    {
+    public:
+        /// Build runtime blocks for the blueprint's AST. With a previous
+        /// version, a node whose own hash and everything downstream of it is
+        /// unchanged reuses that version's block, so an edit rebuilds only
+        /// the edited nodes and the chain leading to them. Node children go
+        /// into the first nested slot; unknown block types are skipped.
+        static BlueprintProgramPtr Compile(const AbilityBlueprint& blueprint,
+                                           const BlueprintProgram* previous = nullptr);
     };
     
     //=========================================================================
     // AbilityBlueprintLibrary - Blueprint kutuphanesi
     //=========================================================================
     
+    class BlueprintPack;
+    class FileWatcher;
+    class AbilityProgramCache;
+    struct CastProgram;
+    
+    using CastProgramPtr = std::shared_ptr<const CastProgram>;
+    
     class AbilityBlueprintLibrary
     {
     public:
+        /// Single blueprint file (BlueprintSerializer bytes)
+        static constexpr const char* FileExtension = ".rsab";
+        
+        /// Packed archive (BlueprintPack)
+        static constexpr const char* PackExtension = ".rsabpack";
+        
         static AbilityBlueprintLibrary& Get();
         
         // Blueprint yonetimi
         void RegisterBlueprint(const AbilityBlueprint& blueprint);
         void UnregisterBlueprint(const UUID& id);
         
+        /// Blueprints from mounted packs are decoded on first lookup.
+        /// Returned pointers stay valid until the blueprint is unregistered.
         const AbilityBlueprint* GetBlueprint(const UUID& id) const;
         const AbilityBlueprint* GetBlueprintByName(const std::string& name) const;
         
+        /// Decodes any pack entries not loaded yet
         std::vector<const AbilityBlueprint*> GetAllBlueprints() const;
         
         // Dosya islemleri
         bool LoadFromFile(const std::string& path);
         bool SaveToFile(const std::string& path, const UUID& blueprintId);
+        
+        /// Decodes every FileExtension file in the directory on a worker pool,
+        /// then registers them in path order (a later file wins a duplicate id)
         bool LoadAllFromDirectory(const std::string& directory);
         
+        /// Mount a pack; only its index is read now. Registered blueprints
+        /// take precedence, and later packs over earlier ones.
+        bool LoadPack(const std::string& path);
+        
+        /// Write every blueprint, registered and packed, into one pack
+        bool SavePack(const std::string& path) const;
+        
+        /// Compiled script of a blueprint, built on first request. The
+        /// pointer is a snapshot: a reload publishes a new program and
+        /// leaves this one alive for whoever still holds it.
+        BlueprintProgramPtr GetProgram(const UUID& id) const;
+        
+        // Casting
+        
+        /// Program and level constants for one cast, from a cache keyed by
+        /// blueprint checksum and level. A hit allocates nothing. A miss
+        /// shares the program GetProgram() published when it is current,
+        /// otherwise compiles against it incrementally.
+        CastProgramPtr GetCastProgram(const UUID& id, int level) const;
+        
+        /// Least recently cast blueprint versions are evicted above this many bytes
+        void SetProgramCacheBudget(size_t bytes);
+        size_t GetProgramCacheMemoryUsage() const;
+        
         // Hot reload
+        
+        /// Watch a directory for FileExtension files written or moved in
+        bool WatchDirectory(const std::string& directory);
+        
+        /// Drain the watcher: changed files of loaded blueprints are marked
+        /// dirty, new files are loaded. Call between ticks, before ReloadDirty().
+        void PollFileChanges();
+        
         void MarkDirty(const UUID& id);
+        
+        /// Re-read dirty blueprints that came from a file (others are
+        /// recompiled from the registered copy), recompile changed nodes and
+        /// publish the new programs. Call between ticks; stacks and instances
+        /// already running keep the program they started with.
         void ReloadDirty();
         
     private:
-        AbilityBlueprintLibrary() = default;
+        AbilityBlueprintLibrary();
+        ~AbilityBlueprintLibrary();
+        
+        enum class PackEntryState : uint8_t
+        {
+            Pending,                                // Not decoded yet
+            Decoded,                                // The library's copy came from this entry
+            Shadowed                                // Registered over, unregistered or failed
+        };
+        
+        struct MountedPack
+        {
+            std::unique_ptr<BlueprintPack> Pack;
+            std::vector<PackEntryState> States;
+        };
+        
+        // Callers hold m_Mutex
+        void Insert(AbilityBlueprint&& blueprint);
+        void ShadowPacked(const UUID& id);
+        const AbilityBlueprint* FindOrDecode(const UUID& id) const;
+        const AbilityBlueprint* DecodePacked(MountedPack& mounted, size_t index) const;
+        void DecodeAllPacked() const;
+        void TrackPath(const std::string& path, const UUID& id);
+        
+        // Lookups decode pack entries lazily, hence mutable and locked
+        mutable std::mutex m_Mutex;
+        mutable std::unordered_map<UUID, AbilityBlueprint> m_Blueprints;
+        mutable std::unordered_map<std::string, UUID> m_NameToId;
+        mutable std::vector<MountedPack> m_Packs;
+        mutable std::unordered_map<UUID, BlueprintProgramPtr> m_Programs;
+        
+        // Cast programs; checksums are computed once per blueprint version
+        mutable std::unordered_map<UUID, uint64_t> m_Checksums;
+        std::unique_ptr<AbilityProgramCache> m_CastPrograms;
         
-        std::unordered_map<UUID, AbilityBlueprint> m_Blueprints;
-        std::unordered_map<std::string, UUID> m_NameToId;
+        // Hot reload; m_IdToPath only holds blueprints loaded from a file
+        std::unordered_map<UUID, std::string> m_IdToPath;
+        std::unordered_map<std::string, UUID> m_PathToId;
+        std::unique_ptr<FileWatcher> m_Watcher;
         std::vector<UUID> m_DirtyBlueprints;
+        std::unordered_map<UUID, std::chrono::steady_clock::time_point> m_ChangeSeen;  // For latency logs
     };
 }
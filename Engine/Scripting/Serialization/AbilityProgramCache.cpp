@@ -0,0 +1,136 @@
+#include "AbilityProgramCache.h"
+#include <algorithm>
+
+namespace RiftSpire
+{
+    AbilityProgramCache::AbilityProgramCache(size_t budgetBytes)
+        : m_Budget(budgetBytes)
+    {
+    }
+
+    CastProgramPtr AbilityProgramCache::Find(uint64_t checksum, int level)
+    {
+        auto it = m_Versions.find(checksum);
+        if (it == m_Versions.end()) return nullptr;
+
+        const Version& version = *it->second;
+        const size_t index = static_cast<size_t>(level - 1);
+        if (index >= version.Levels.size() || !version.Levels[index]) return nullptr;
+
+        m_Lru.splice(m_Lru.begin(), m_Lru, it->second);
+        return version.Levels[index];
+    }
+
+    CastProgramPtr AbilityProgramCache::Get(const AbilityBlueprint& blueprint, uint64_t checksum, int level,
+                                            const BlueprintProgramPtr& published)
+    {
+        level = ClampLevel(blueprint, level);
+
+        if (CastProgramPtr hit = Find(checksum, level))
+        {
+            m_Stats.Hits++;
+            return hit;
+        }
+        m_Stats.Misses++;
+
+        // Another level of this version already paid for the compile
+        auto it = m_Versions.find(checksum);
+        if (it != m_Versions.end())
+        {
+            m_Lru.splice(m_Lru.begin(), m_Lru, it->second);
+            CastProgramPtr program = BakeLevel(*it->second, blueprint, level);
+            Evict();
+            return program;
+        }
+
+        Version& version = m_Lru.emplace_front();
+        version.Checksum = checksum;
+        if (published && published->ContentHash.Low == checksum)
+        {
+            version.Program = published;
+        }
+        else
+        {
+            version.Program = BlueprintCompiler::Compile(blueprint, published.get());
+            m_Stats.Compiles++;
+        }
+        version.Levels.resize(static_cast<size_t>(ClampLevel(blueprint, blueprint.MaxLevel)));
+        version.Bytes = EstimateSize(*version.Program) + sizeof(Version) + version.Levels.size() * sizeof(CastProgramPtr);
+
+        m_Versions.emplace(checksum, m_Lru.begin());
+        m_MemoryUsage += version.Bytes;
+
+        CastProgramPtr program = BakeLevel(version, blueprint, level);
+        Evict();
+        return program;
+    }
+
+    CastProgramPtr AbilityProgramCache::BakeLevel(Version& version, const AbilityBlueprint& blueprint, int level)
+    {
+        auto program = std::make_shared<CastProgram>();
+        program->Program = version.Program;
+        program->Checksum = version.Checksum;
+        program->Level = level;
+        program->Constants[static_cast<size_t>(AbilityConstant::Cooldown)] =
+            GetLevelValue(blueprint.CooldownPerLevel, blueprint.BaseCooldown, level);
+        program->Constants[static_cast<size_t>(AbilityConstant::ManaCost)] =
+            GetLevelValue(blueprint.ManaCostPerLevel, blueprint.ManaCost, level);
+        program->Constants[static_cast<size_t>(AbilityConstant::Damage)] =
+            GetLevelValue(blueprint.DamagePerLevel, 0.0f, level);
+        program->Constants[static_cast<size_t>(AbilityConstant::CastTime)] = blueprint.CastTime;
+        program->Constants[static_cast<size_t>(AbilityConstant::Range)] = blueprint.Range;
+
+        version.Levels[static_cast<size_t>(level - 1)] = program;
+        version.Bytes += LevelBytes;
+        m_MemoryUsage += LevelBytes;
+        return program;
+    }
+
+    void AbilityProgramCache::SetBudget(size_t budgetBytes)
+    {
+        m_Budget = budgetBytes;
+        Evict();
+    }
+
+    void AbilityProgramCache::Clear()
+    {
+        m_Lru.clear();
+        m_Versions.clear();
+        m_MemoryUsage = 0;
+    }
+
+    void AbilityProgramCache::Evict()
+    {
+        // The version just used always stays, even if it alone is over budget
+        while (m_MemoryUsage > m_Budget && m_Lru.size() > 1)
+        {
+            const Version& oldest = m_Lru.back();
+            m_MemoryUsage -= oldest.Bytes;
+            m_Versions.erase(oldest.Checksum);
+            m_Lru.pop_back();
+            m_Stats.Evictions++;
+        }
+    }
+
+    int AbilityProgramCache::ClampLevel(const AbilityBlueprint& blueprint, int level)
+    {
+        return std::clamp(level, 1, std::max(blueprint.MaxLevel, 1));
+    }
+
+    float AbilityProgramCache::GetLevelValue(const std::vector<float>& perLevel, float base, int level)
+    {
+        if (perLevel.empty()) return base;
+        return perLevel[std::min(static_cast<size_t>(level - 1), perLevel.size() - 1)];
+    }
+
+    size_t AbilityProgramCache::EstimateSize(const BlueprintProgram& program)
+    {
+        using NodeMap = decltype(program.Nodes);
+
+        size_t bytes = sizeof(BlueprintProgram) + 2 * sizeof(void*);
+        bytes += program.Nodes.size() * (sizeof(NodeMap::value_type) + 2 * sizeof(void*));
+        bytes += program.Nodes.bucket_count() * sizeof(void*);
+        if (program.Script) bytes += program.Script->GetMemoryUsage();
+        return bytes;
+    }
+}
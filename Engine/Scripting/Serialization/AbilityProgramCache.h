@@ -0,0 +1,121 @@
+#pragma once
+
+#include "AbilityBlueprint.h"
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // CastProgram - Executable form of one blueprint version at one level
+    //=========================================================================
+
+    /// Index into CastProgram::Constants
+    enum class AbilityConstant : uint8_t
+    {
+        Cooldown,
+        ManaCost,
+        Damage,
+        CastTime,
+        Range,
+
+        Count
+    };
+
+    /// Immutable. The compiled script is shared by every level of the same
+    /// blueprint version; only the constant pool differs per level.
+    struct CastProgram
+    {
+        BlueprintProgramPtr Program;
+        uint64_t Checksum = 0;             // BlueprintSerializer checksum of the source
+        int Level = 1;                     // Clamped to [1, MaxLevel]
+        std::array<float, static_cast<size_t>(AbilityConstant::Count)> Constants{};
+
+        float Get(AbilityConstant constant) const { return Constants[static_cast<size_t>(constant)]; }
+        const CompiledScriptPtr& GetScript() const { return Program->Script; }
+    };
+
+    //=========================================================================
+    // AbilityProgramCache - Cast programs keyed by checksum and level
+    //=========================================================================
+
+    /// A hit is a hash lookup and a list splice: no compile, no allocation.
+    /// A miss compiles the blueprint once per version; each level's constants
+    /// are baked the first time that level is cast. Eviction is least
+    /// recently used by version (its script and all its levels) once the
+    /// accounted bytes exceed the budget. Evicted programs stay alive for
+    /// whoever still holds them.
+    /// Not synchronized: callers lock around it (the library does).
+    class AbilityProgramCache
+    {
+    public:
+        struct Stats
+        {
+            uint64_t Hits = 0;
+            uint64_t Misses = 0;
+            uint64_t Compiles = 0;
+            uint64_t Evictions = 0;            // Versions evicted
+        };
+
+        static constexpr size_t DefaultBudget = 64ull * 1024 * 1024;
+
+        explicit AbilityProgramCache(size_t budgetBytes = DefaultBudget);
+
+        /// Program for `blueprint` at `level`. `checksum` must be the
+        /// blueprint's ComputeChecksumUncached(), or ComputeChecksum() when
+        /// every edit was marked (callers keep it, hashing per cast would
+        /// cost more than the lookup). `published` is reused when it
+        /// was compiled from the same version, and otherwise serves as the
+        /// previous version for an incremental compile.
+        CastProgramPtr Get(const AbilityBlueprint& blueprint, uint64_t checksum, int level,
+                           const BlueprintProgramPtr& published = nullptr);
+
+        /// Lookup only; nullptr on a miss. `level` must already be clamped.
+        CastProgramPtr Find(uint64_t checksum, int level);
+
+        void SetBudget(size_t budgetBytes);
+        size_t GetBudget() const { return m_Budget; }
+        size_t GetMemoryUsage() const { return m_MemoryUsage; }
+        size_t GetVersionCount() const { return m_Versions.size(); }
+        const Stats& GetStats() const { return m_Stats; }
+
+        void Clear();
+
+        /// Level clamped to the blueprint's [1, MaxLevel]
+        static int ClampLevel(const AbilityBlueprint& blueprint, int level);
+
+        /// Per-level tables indexed by level - 1. A shorter table repeats its
+        /// last entry; an empty one falls back to the base value.
+        static float GetLevelValue(const std::vector<float>& perLevel, float base, int level);
+
+        /// Approximate bytes a compiled program holds
+        static size_t EstimateSize(const BlueprintProgram& program);
+
+    private:
+        struct Version
+        {
+            uint64_t Checksum = 0;
+            BlueprintProgramPtr Program;
+            std::vector<CastProgramPtr> Levels;    // Index level - 1, filled on first cast
+            size_t Bytes = 0;
+        };
+
+        using VersionList = std::list<Version>;
+
+        // Cast program with its control block
+        static constexpr size_t LevelBytes = sizeof(CastProgram) + sizeof(CastProgramPtr) + 2 * sizeof(void*);
+
+        CastProgramPtr BakeLevel(Version& version, const AbilityBlueprint& blueprint, int level);
+        void Evict();
+
+        size_t m_Budget;
+        size_t m_MemoryUsage = 0;
+        Stats m_Stats;
+
+        VersionList m_Lru;                                                   // Most recent first
+        std::unordered_map<uint64_t, VersionList::iterator> m_Versions;      // By checksum
+    };
+}
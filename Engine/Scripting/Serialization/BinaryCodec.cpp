@@ -0,0 +1,408 @@
+#include "BinaryCodec.h"
+#include <limits>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // Value encoding
+    //=========================================================================
+
+    size_t BinaryCodec::EncodedSize(const Value& value)
+    {
+        size_t size = 1;  // Type tag
+
+        switch (value.GetType())
+        {
+            case ValueType::Bool:    return size + 1;
+            case ValueType::Int:     return size + VarUIntSize(ZigZagEncode(value.AsInt()));
+            case ValueType::Float:   return size + sizeof(f64);
+            case ValueType::Vector2: return size + 2 * sizeof(f32);
+            case ValueType::Vector3: return size + 3 * sizeof(f32);
+            case ValueType::Color:   return size + 4 * sizeof(f32);
+            case ValueType::Entity:  return size + VarUIntSize(value.AsEntityHandle());
+            case ValueType::String:
+            {
+                const size_t length = value.AsStringView().size();
+                return size + VarUIntSize(length) + length;
+            }
+            case ValueType::List:
+            {
+                const auto& items = value.AsList();
+                size += VarUIntSize(items.size());
+                for (const Value& item : items)
+                {
+                    size += EncodedSize(item);
+                }
+                return size;
+            }
+            default:
+                return size;
+        }
+    }
+
+    //=========================================================================
+    // BinaryWriter
+    //=========================================================================
+
+    void BinaryWriter::Reserve(size_t capacity)
+    {
+        if (capacity > m_Buffer.size())
+        {
+            m_Buffer.resize(capacity);
+        }
+    }
+
+    void BinaryWriter::GrowSlow(size_t count)
+    {
+        const size_t required = m_Size + count;
+        size_t capacity = m_Buffer.size() < 64 ? 64 : m_Buffer.size() * 2;
+        if (capacity < required) capacity = required;
+        m_Buffer.resize(capacity);
+    }
+
+    void BinaryWriter::WriteVarUInt(u64 value)
+    {
+        u8 bytes[BinaryCodec::MaxVarIntSize];
+        size_t count = 0;
+        while (value >= 0x80)
+        {
+            bytes[count++] = static_cast<u8>(value | 0x80);
+            value >>= 7;
+        }
+        bytes[count++] = static_cast<u8>(value);
+        WriteBytes(bytes, count);
+    }
+
+    void BinaryWriter::WriteBytes(const void* data, size_t size)
+    {
+        if (size == 0) return;
+        std::memcpy(Grow(size), data, size);
+    }
+
+    void BinaryWriter::WriteString(std::string_view text)
+    {
+        WriteVarUInt(text.size());
+        WriteBytes(text.data(), text.size());
+    }
+
+    void BinaryWriter::WriteUUID(const UUID& id)
+    {
+        WriteU64(id.GetHigh());
+        WriteU64(id.GetLow());
+    }
+
+    void BinaryWriter::WriteF32Array(std::span<const f32> values)
+    {
+        WriteVarUInt(values.size());
+
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            WriteBytes(values.data(), values.size_bytes());
+        }
+        else
+        {
+            for (f32 value : values) WriteF32(value);
+        }
+    }
+
+    void BinaryWriter::WriteValue(const Value& value)
+    {
+        const ValueType type = value.GetType();
+
+        switch (type)
+        {
+            case ValueType::Bool:
+                WriteU8(static_cast<u8>(type));
+                WriteU8(value.AsBool() ? 1 : 0);
+                break;
+            case ValueType::Int:
+                WriteU8(static_cast<u8>(type));
+                WriteVarInt(value.AsInt());
+                break;
+            case ValueType::Float:
+                WriteU8(static_cast<u8>(type));
+                WriteF64(value.AsFloat());
+                break;
+            case ValueType::String:
+                WriteU8(static_cast<u8>(type));
+                WriteString(value.AsStringView());
+                break;
+            case ValueType::Vector2:
+            {
+                const glm::vec2 v = value.AsVector2();
+                WriteU8(static_cast<u8>(type));
+                WriteF32(v.x);
+                WriteF32(v.y);
+                break;
+            }
+            case ValueType::Vector3:
+            {
+                const glm::vec3 v = value.AsVector3();
+                WriteU8(static_cast<u8>(type));
+                WriteF32(v.x);
+                WriteF32(v.y);
+                WriteF32(v.z);
+                break;
+            }
+            case ValueType::Color:
+            {
+                const glm::vec4 c = value.AsColor();
+                WriteU8(static_cast<u8>(type));
+                WriteF32(c.r);
+                WriteF32(c.g);
+                WriteF32(c.b);
+                WriteF32(c.a);
+                break;
+            }
+            case ValueType::Entity:
+                WriteU8(static_cast<u8>(type));
+                WriteVarUInt(value.AsEntityHandle());
+                break;
+            case ValueType::List:
+            {
+                const auto& items = value.AsList();
+                WriteU8(static_cast<u8>(type));
+                WriteVarUInt(items.size());
+                for (const Value& item : items)
+                {
+                    WriteValue(item);
+                }
+                break;
+            }
+            default:
+                // Void (Any never holds data)
+                WriteU8(static_cast<u8>(ValueType::Void));
+                break;
+        }
+    }
+
+    std::vector<u8> BinaryWriter::TakeBytes()
+    {
+        m_Buffer.resize(m_Size);
+        m_Size = 0;
+        return std::move(m_Buffer);
+    }
+
+    //=========================================================================
+    // BinaryReader
+    //=========================================================================
+
+    bool BinaryReader::Fail(const char* message)
+    {
+        if (!m_Error) m_Error = message;
+        m_Pos = m_End;
+        return false;
+    }
+
+    bool BinaryReader::ReadF32(f32& value)
+    {
+        u32 bits;
+        if (!ReadU32(bits)) return false;
+        value = std::bit_cast<f32>(bits);
+        return true;
+    }
+
+    bool BinaryReader::ReadF64(f64& value)
+    {
+        u64 bits;
+        if (!ReadU64(bits)) return false;
+        value = std::bit_cast<f64>(bits);
+        return true;
+    }
+
+    bool BinaryReader::ReadVarUInt(u64& value)
+    {
+        value = 0;
+        for (u32 shift = 0; shift < 64; shift += 7)
+        {
+            if (m_Pos >= m_End) return Fail("Unexpected end of data");
+
+            const u8 byte = *m_Pos++;
+
+            // The tenth byte may only carry the top bit
+            if (shift == 63 && byte > 1) return Fail("Varint overflow");
+
+            value |= static_cast<u64>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return true;
+        }
+        return Fail("Varint overflow");
+    }
+
+    bool BinaryReader::ReadVarInt(i64& value)
+    {
+        u64 encoded;
+        if (!ReadVarUInt(encoded)) return false;
+        value = BinaryCodec::ZigZagDecode(encoded);
+        return true;
+    }
+
+    bool BinaryReader::ReadCount(u32& count, size_t minElementSize)
+    {
+        u64 value;
+        if (!ReadVarUInt(value)) return false;
+
+        if (value > std::numeric_limits<u32>::max()) return Fail("Count out of range");
+        if (minElementSize > 0 && value > GetRemaining() / minElementSize) return Fail("Count exceeds data");
+
+        count = static_cast<u32>(value);
+        return true;
+    }
+
+    bool BinaryReader::ReadBytes(void* out, size_t size)
+    {
+        if (m_Error) return false;
+        if (GetRemaining() < size) return Fail("Unexpected end of data");
+
+        if (size > 0)
+        {
+            std::memcpy(out, m_Pos, size);
+            m_Pos += size;
+        }
+        return true;
+    }
+
+    bool BinaryReader::Skip(size_t size)
+    {
+        if (m_Error) return false;
+        if (GetRemaining() < size) return Fail("Unexpected end of data");
+
+        m_Pos += size;
+        return true;
+    }
+
+    bool BinaryReader::ReadStringView(std::string_view& value)
+    {
+        u32 length;
+        if (!ReadCount(length, 1)) return false;
+
+        value = std::string_view(reinterpret_cast<const char*>(m_Pos), length);
+        m_Pos += length;
+        return true;
+    }
+
+    bool BinaryReader::ReadString(std::string& value)
+    {
+        std::string_view view;
+        if (!ReadStringView(view)) return false;
+
+        value.assign(view.data(), view.size());
+        return true;
+    }
+
+    bool BinaryReader::ReadUUID(UUID& id)
+    {
+        u64 high, low;
+        if (!ReadU64(high) || !ReadU64(low)) return false;
+
+        id = UUID(high, low);
+        return true;
+    }
+
+    bool BinaryReader::ReadF32Array(std::vector<f32>& values)
+    {
+        u32 count;
+        if (!ReadCount(count, sizeof(f32))) return false;
+
+        values.resize(count);
+        if constexpr (std::endian::native == std::endian::little)
+        {
+            return ReadBytes(values.data(), count * sizeof(f32));
+        }
+        else
+        {
+            for (f32& value : values)
+            {
+                if (!ReadF32(value)) return false;
+            }
+            return true;
+        }
+    }
+
+    bool BinaryReader::ReadValue(Value& value, u32 depth)
+    {
+        u8 tag;
+        if (!ReadU8(tag)) return false;
+
+        switch (static_cast<ValueType>(tag))
+        {
+            case ValueType::Void:
+                value = Value();
+                return true;
+            case ValueType::Bool:
+            {
+                u8 flag;
+                if (!ReadU8(flag)) return false;
+                if (flag > 1) return Fail("Invalid bool value");
+                value = Value(flag != 0);
+                return true;
+            }
+            case ValueType::Int:
+            {
+                i64 number;
+                if (!ReadVarInt(number)) return false;
+                value = Value(number);
+                return true;
+            }
+            case ValueType::Float:
+            {
+                f64 number;
+                if (!ReadF64(number)) return false;
+                value = Value(number);
+                return true;
+            }
+            case ValueType::String:
+            {
+                std::string_view text;
+                if (!ReadStringView(text)) return false;
+                value = Value(std::string(text));
+                return true;
+            }
+            case ValueType::Vector2:
+            {
+                glm::vec2 v;
+                if (!ReadF32(v.x) || !ReadF32(v.y)) return false;
+                value = Value(v);
+                return true;
+            }
+            case ValueType::Vector3:
+            {
+                glm::vec3 v;
+                if (!ReadF32(v.x) || !ReadF32(v.y) || !ReadF32(v.z)) return false;
+                value = Value(v);
+                return true;
+            }
+            case ValueType::Color:
+            {
+                glm::vec4 c;
+                if (!ReadF32(c.r) || !ReadF32(c.g) || !ReadF32(c.b) || !ReadF32(c.a)) return false;
+                value = Value(c);
+                return true;
+            }
+            case ValueType::Entity:
+            {
+                u64 handle;
+                if (!ReadVarUInt(handle)) return false;
+                value = Value::FromEntityHandle(handle);
+                return true;
+            }
+            case ValueType::List:
+            {
+                if (depth >= BinaryCodec::MaxValueDepth) return Fail("List nesting too deep");
+
+                u32 count;
+                if (!ReadCount(count, 1)) return false;
+
+                value = Value::CreateList();
+                auto& items = value.AsList();
+                items.resize(count);
+                for (Value& item : items)
+                {
+                    if (!ReadValue(item, depth + 1)) return false;
+                }
+                return true;
+            }
+            default:
+                return Fail("Unknown value type");
+        }
+    }
+}
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include "../Core/Value.h"
+#include <Core/UUID.h>
+#include <bit>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // Binary codec - Primitives shared by the binary payload formats
+    //=========================================================================
+
+    /// Encoding rules:
+    ///  - Fixed-width integers and floats: little-endian, copied with memcpy
+    ///  - Lengths, counts and entity handles: LEB128 varint
+    ///  - Signed integers: zig-zag varint
+    ///  - Strings: varint length + bytes
+    ///  - UUID: high then low 64-bit half
+    ///  - Value: u8 ValueType + payload (see BinaryWriter::WriteValue)
+    namespace BinaryCodec
+    {
+        /// Nesting limit for list values on both sides
+        static constexpr u32 MaxValueDepth = 32;
+
+        static constexpr size_t MaxVarIntSize = 10;
+
+        template<typename T>
+        inline T ToLittleEndian(T value)
+        {
+            if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1)
+            {
+                T swapped = 0;
+                for (size_t i = 0; i < sizeof(T); ++i)
+                {
+                    swapped = static_cast<T>((swapped << 8) | ((value >> (i * 8)) & 0xFF));
+                }
+                return swapped;
+            }
+            return value;
+        }
+
+        inline size_t VarUIntSize(u64 value)
+        {
+            size_t size = 1;
+            while (value >= 0x80)
+            {
+                value >>= 7;
+                ++size;
+            }
+            return size;
+        }
+
+        inline u64 ZigZagEncode(i64 value)
+        {
+            return (static_cast<u64>(value) << 1) ^ static_cast<u64>(value >> 63);
+        }
+
+        inline i64 ZigZagDecode(u64 value)
+        {
+            return static_cast<i64>(value >> 1) ^ -static_cast<i64>(value & 1);
+        }
+
+        /// Exact number of bytes WriteValue() produces for a value
+        size_t EncodedSize(const Value& value);
+    }
+
+    //=========================================================================
+    // BinaryWriter - Growable little-endian output buffer
+    //=========================================================================
+
+    /// Writes go through one bounds check and a memcpy into a buffer that is
+    /// kept sized to its capacity, so a writer that was Reserve()d with the
+    /// exact (or an upper-bound) size never reallocates.
+    class BinaryWriter
+    {
+    public:
+        BinaryWriter() = default;
+        explicit BinaryWriter(size_t capacity) { Reserve(capacity); }
+
+        void Reserve(size_t capacity);
+
+        /// Start over, keeping the capacity
+        void Clear() { m_Size = 0; }
+
+        //---------------------------------------------------------------------
+        // Primitives
+        //---------------------------------------------------------------------
+
+        void WriteU8(u8 value) { *Grow(1) = value; }
+        void WriteU32(u32 value) { Put(BinaryCodec::ToLittleEndian(value)); }
+        void WriteU64(u64 value) { Put(BinaryCodec::ToLittleEndian(value)); }
+        void WriteF32(f32 value) { WriteU32(std::bit_cast<u32>(value)); }
+        void WriteF64(f64 value) { WriteU64(std::bit_cast<u64>(value)); }
+
+        void WriteVarUInt(u64 value);
+        void WriteVarInt(i64 value) { WriteVarUInt(BinaryCodec::ZigZagEncode(value)); }
+
+        void WriteBytes(const void* data, size_t size);
+        void WriteString(std::string_view text);
+        void WriteUUID(const UUID& id);
+
+        /// Varint count followed by the raw floats
+        void WriteF32Array(std::span<const f32> values);
+
+        void WriteValue(const Value& value);
+
+        //---------------------------------------------------------------------
+        // Output
+        //---------------------------------------------------------------------
+
+        const u8* GetData() const { return m_Buffer.data(); }
+        size_t GetSize() const { return m_Size; }
+        std::span<const u8> GetBytes() const { return { m_Buffer.data(), m_Size }; }
+
+        /// Move the written bytes out; the writer is left empty
+        std::vector<u8> TakeBytes();
+
+    private:
+        template<typename T>
+        void Put(T value)
+        {
+            std::memcpy(Grow(sizeof(T)), &value, sizeof(T));
+        }
+
+        u8* Grow(size_t count)
+        {
+            if (m_Buffer.size() - m_Size < count) GrowSlow(count);
+            u8* out = m_Buffer.data() + m_Size;
+            m_Size += count;
+            return out;
+        }
+
+        void GrowSlow(size_t count);
+
+        std::vector<u8> m_Buffer;       // Sized to capacity; [0, m_Size) is written
+        size_t m_Size = 0;
+    };
+
+    //=========================================================================
+    // BinaryReader - Bounds-checked cursor over a byte span
+    //=========================================================================
+
+    /// Every read checks the remaining size first and returns false instead
+    /// of reading past the end. Like JsonReader, the first failure sticks:
+    /// later reads fail too and GetError() names the first problem, so a
+    /// decoder can check once at the end of a section.
+    class BinaryReader
+    {
+    public:
+        explicit BinaryReader(std::span<const u8> data)
+            : m_Begin(data.data())
+            , m_Pos(data.data())
+            , m_End(data.data() + data.size())
+        {
+        }
+
+        //---------------------------------------------------------------------
+        // Primitives
+        //---------------------------------------------------------------------
+
+        bool ReadU8(u8& value) { return Get(value); }
+        bool ReadU32(u32& value) { return Get(value) && (value = BinaryCodec::ToLittleEndian(value), true); }
+        bool ReadU64(u64& value) { return Get(value) && (value = BinaryCodec::ToLittleEndian(value), true); }
+        bool ReadF32(f32& value);
+        bool ReadF64(f64& value);
+
+        bool ReadVarUInt(u64& value);
+        bool ReadVarInt(i64& value);
+
+        /// Varint element count. Fails if count * minElementSize is more than
+        /// what is left, so a corrupt count cannot trigger a huge allocation.
+        bool ReadCount(u32& count, size_t minElementSize);
+
+        bool ReadBytes(void* out, size_t size);
+        bool ReadString(std::string& value);
+        bool ReadStringView(std::string_view& value);       // Points into the input
+        bool ReadUUID(UUID& id);
+        bool ReadF32Array(std::vector<f32>& values);
+
+        /// Rejects unknown type tags and non-canonical bools
+        bool ReadValue(Value& value) { return ReadValue(value, 0); }
+
+        bool Skip(size_t size);
+
+        //---------------------------------------------------------------------
+        // State
+        //---------------------------------------------------------------------
+
+        bool Fail(const char* message);
+
+        bool HasError() const { return m_Error != nullptr; }
+        const char* GetError() const { return m_Error; }
+        size_t GetOffset() const { return static_cast<size_t>(m_Pos - m_Begin); }
+        size_t GetRemaining() const { return static_cast<size_t>(m_End - m_Pos); }
+        bool IsAtEnd() const { return !m_Error && m_Pos == m_End; }
+
+    private:
+        template<typename T>
+        bool Get(T& value)
+        {
+            if (GetRemaining() < sizeof(T)) return Fail("Unexpected end of data");
+            std::memcpy(&value, m_Pos, sizeof(T));
+            m_Pos += sizeof(T);
+            return true;
+        }
+
+        bool ReadValue(Value& value, u32 depth);
+
+        const u8* m_Begin;
+        const u8* m_Pos;
+        const u8* m_End;
+        const char* m_Error = nullptr;
+    };
+}
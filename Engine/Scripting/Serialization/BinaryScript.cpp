@@ -0,0 +1,697 @@
+#include "BinaryScript.h"
+#include "BinaryCodec.h"
+#include "../Core/BlockRegistry.h"
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+namespace RiftSpire
+{
+    using namespace BinaryScriptFormat;
+
+    //=========================================================================
+    // BinaryScriptView - Validation
+    //=========================================================================
+
+    bool BinaryScriptView::Fail(std::string* error, const char* message)
+    {
+        *this = BinaryScriptView();
+        if (error) *error = message;
+        return false;
+    }
+
+    /// Section lies inside the file, is aligned and does not overflow
+    static bool IsSectionValid(const Section& section, size_t recordSize, u32 fileSize)
+    {
+        if (section.Offset % SectionAlignment != 0) return false;
+        const u64 end = static_cast<u64>(section.Offset) + static_cast<u64>(section.Count) * recordSize;
+        return end <= fileSize;
+    }
+
+    static bool IsIndex(u32 index, u32 count) { return index < count; }
+    static bool IsOptionalIndex(u32 index, u32 count) { return index == None || index < count; }
+
+    template<typename Fn>
+    void BinaryScriptView::ForEachEdge(u32 block, Fn&& fn) const
+    {
+        const BlockRecord& record = m_Blocks[block];
+        if (record.Next != None) fn(record.Next);
+
+        for (u32 i = 0; i < record.InputCount; ++i)
+        {
+            const SlotRecord& slot = m_Slots[record.FirstSlot + i];
+            if (slot.Target != None) fn(slot.Target);
+        }
+
+        for (u32 i = 0; i < record.NestedCount; ++i)
+        {
+            const SlotRecord& slot = m_Slots[record.FirstSlot + record.InputCount + i];
+            for (u32 c = 0; c < slot.Count; ++c)
+            {
+                fn(m_Children[slot.First + c]);
+            }
+        }
+    }
+
+    bool BinaryScriptView::Open(std::span<const u8> bytes, std::string* error)
+    {
+        *this = BinaryScriptView();
+
+        if (bytes.size() < sizeof(Header)) return Fail(error, "File too small");
+        if (reinterpret_cast<uintptr_t>(bytes.data()) % alignof(Header) != 0) return Fail(error, "Misaligned buffer");
+
+        const auto* header = reinterpret_cast<const Header*>(bytes.data());
+        if (header->Magic != BinaryScriptFormat::Magic) return Fail(error, "Invalid magic number");
+        if (header->Version != BinaryScriptFormat::Version) return Fail(error, "Unsupported version");
+        if (header->HeaderSize != sizeof(Header)) return Fail(error, "Invalid header size");
+        if (header->FileSize > bytes.size()) return Fail(error, "Truncated file");
+
+        const u32 fileSize = header->FileSize;
+        if (!IsSectionValid(header->Types, sizeof(u32), fileSize) ||
+            !IsSectionValid(header->Blocks, sizeof(BlockRecord), fileSize) ||
+            !IsSectionValid(header->Slots, sizeof(SlotRecord), fileSize) ||
+            !IsSectionValid(header->Children, sizeof(u32), fileSize) ||
+            !IsSectionValid(header->Values, sizeof(ValueRecord), fileSize) ||
+            !IsSectionValid(header->Strings, sizeof(StringRecord), fileSize) ||
+            !IsSectionValid(header->StringData, 1, fileSize))
+        {
+            return Fail(error, "Section out of bounds");
+        }
+
+        m_Data = bytes.data();
+        m_Header = header;
+        m_Types = SectionData<u32>(header->Types);
+        m_Blocks = SectionData<BlockRecord>(header->Blocks);
+        m_Slots = SectionData<SlotRecord>(header->Slots);
+        m_Children = SectionData<u32>(header->Children);
+        m_Values = SectionData<ValueRecord>(header->Values);
+        m_Strings = SectionData<StringRecord>(header->Strings);
+        m_StringData = reinterpret_cast<const char*>(m_Data + header->StringData.Offset);
+
+        const u32 typeCount = header->Types.Count;
+        const u32 blockCount = header->Blocks.Count;
+        const u32 slotCount = header->Slots.Count;
+        const u32 childCount = header->Children.Count;
+        const u32 valueCount = header->Values.Count;
+        const u32 stringCount = header->Strings.Count;
+
+        // Strings
+        for (u32 i = 0; i < stringCount; ++i)
+        {
+            const u64 end = static_cast<u64>(m_Strings[i].Offset) + m_Strings[i].Length;
+            if (end > header->StringData.Count) return Fail(error, "String out of bounds");
+        }
+
+        if (!IsOptionalIndex(header->Name, stringCount) || !IsOptionalIndex(header->Description, stringCount))
+        {
+            return Fail(error, "Invalid script string");
+        }
+
+        for (u32 i = 0; i < typeCount; ++i)
+        {
+            if (!IsIndex(m_Types[i], stringCount)) return Fail(error, "Invalid type name");
+        }
+
+        // Values (list elements always follow their list, so lists cannot nest
+        // into themselves). A value belongs to at most one list, otherwise a
+        // few records could share elements and decode to an exponential tree.
+        std::vector<u8> listDepth(valueCount, 0);   // Owned flag, then list nesting
+        for (u32 i = 0; i < valueCount; ++i)
+        {
+            const ValueRecord& value = m_Values[i];
+            if (value.Type > static_cast<u8>(ValueType::List)) return Fail(error, "Invalid value type");
+
+            if (value.Type == static_cast<u8>(ValueType::String) && !IsIndex(value.String, stringCount))
+            {
+                return Fail(error, "Invalid string value");
+            }
+
+            if (value.Type == static_cast<u8>(ValueType::List))
+            {
+                const u32 first = value.Data.List[0];
+                const u64 end = static_cast<u64>(first) + value.Data.List[1];
+                if (first <= i || end > valueCount) return Fail(error, "Invalid list value");
+
+                for (u32 e = first; e < end; ++e)
+                {
+                    if (listDepth[e] != 0) return Fail(error, "Overlapping list values");
+                    listDepth[e] = 1;
+                }
+            }
+        }
+
+        // Elements come after their list, so walking backwards sees them first
+        for (u32 i = valueCount; i-- > 0;)
+        {
+            const ValueRecord& value = m_Values[i];
+            if (value.Type != static_cast<u8>(ValueType::List)) { listDepth[i] = 0; continue; }
+
+            u8 depth = 0;
+            for (u32 e = value.Data.List[0]; e < value.Data.List[0] + value.Data.List[1]; ++e)
+            {
+                depth = std::max(depth, listDepth[e]);
+            }
+            if (depth >= BinaryCodec::MaxValueDepth) return Fail(error, "List nesting too deep");
+            listDepth[i] = depth + 1;
+        }
+
+        // Blocks and their slots
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            const BlockRecord& block = m_Blocks[i];
+            if (!IsIndex(block.Type, typeCount)) return Fail(error, "Invalid block type");
+            if (!IsOptionalIndex(block.Next, blockCount)) return Fail(error, "Invalid next block");
+            if (!IsOptionalIndex(block.Comment, stringCount)) return Fail(error, "Invalid comment");
+
+            const u64 slotEnd = static_cast<u64>(block.FirstSlot) + block.InputCount + block.NestedCount;
+            if (slotEnd > slotCount) return Fail(error, "Slot range out of bounds");
+
+            for (u32 s = 0; s < block.InputCount; ++s)
+            {
+                const SlotRecord& slot = m_Slots[block.FirstSlot + s];
+                if (!IsIndex(slot.Name, stringCount) ||
+                    !IsOptionalIndex(slot.Target, blockCount) ||
+                    !IsOptionalIndex(slot.First, valueCount))
+                {
+                    return Fail(error, "Invalid input slot");
+                }
+            }
+
+            for (u32 s = 0; s < block.NestedCount; ++s)
+            {
+                const SlotRecord& slot = m_Slots[block.FirstSlot + block.InputCount + s];
+                const u64 childEnd = static_cast<u64>(slot.First) + slot.Count;
+                if (!IsIndex(slot.Name, stringCount) || (slot.Count > 0 && childEnd > childCount))
+                {
+                    return Fail(error, "Invalid nested slot");
+                }
+            }
+        }
+
+        for (u32 i = 0; i < childCount; ++i)
+        {
+            if (!IsIndex(m_Children[i], blockCount)) return Fail(error, "Invalid nested block");
+        }
+
+        // The block graph (chains, nested bodies, value inputs) must be acyclic,
+        // otherwise instantiation would leak reference cycles and execution
+        // would never terminate. Kahn's algorithm over in-degrees.
+        std::vector<u32> inDegree(blockCount, 0);
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            ForEachEdge(i, [&](u32 target) { inDegree[target]++; });
+        }
+
+        std::vector<u32> ready;
+        ready.reserve(blockCount);
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            if (inDegree[i] == 0) ready.push_back(i);
+        }
+
+        for (size_t cursor = 0; cursor < ready.size(); ++cursor)
+        {
+            ForEachEdge(ready[cursor], [&](u32 target)
+            {
+                if (--inDegree[target] == 0) ready.push_back(target);
+            });
+        }
+
+        if (ready.size() != blockCount) return Fail(error, "Block graph contains a cycle");
+
+        return true;
+    }
+
+    //=========================================================================
+    // BinaryScriptView - Access
+    //=========================================================================
+
+    std::string_view BinaryScriptView::GetString(u32 index) const
+    {
+        if (index == None) return {};
+        const StringRecord& record = m_Strings[index];
+        return std::string_view(m_StringData + record.Offset, record.Length);
+    }
+
+    Value BinaryScriptView::GetValue(u32 index) const
+    {
+        if (index == None) return Value();
+
+        const ValueRecord& record = m_Values[index];
+        const auto& c = record.Data.Components;
+
+        switch (static_cast<ValueType>(record.Type))
+        {
+            case ValueType::Bool:    return Value(record.Data.Int != 0);
+            case ValueType::Int:     return Value(record.Data.Int);
+            case ValueType::Float:   return Value(record.Data.Float);
+            case ValueType::String:  return Value(std::string(GetString(record.String)));
+            case ValueType::Vector2: return Value(glm::vec2(c[0], c[1]));
+            case ValueType::Vector3: return Value(glm::vec3(c[0], c[1], c[2]));
+            case ValueType::Color:   return Value(glm::vec4(c[0], c[1], c[2], c[3]));
+            case ValueType::Entity:  return Value::FromEntityHandle(record.Data.Entity);
+            case ValueType::List:
+            {
+                Value list = Value::CreateList();
+                auto& items = list.AsList();
+                items.reserve(record.Data.List[1]);
+                for (u32 i = 0; i < record.Data.List[1]; ++i)
+                {
+                    items.push_back(GetValue(record.Data.List[0] + i));
+                }
+                return list;
+            }
+            default:                 return Value();
+        }
+    }
+
+    //=========================================================================
+    // BinaryScriptView - Instantiation
+    //=========================================================================
+
+    static BlockSlot* MatchSlot(Block* block, bool nested, u32 position, std::string_view name)
+    {
+        if (nested)
+        {
+            const size_t index = block->FindNestedSlot(name, position);
+            return index != Block::InvalidSlot ? block->GetNestedSlot(index) : nullptr;
+        }
+
+        const size_t index = block->FindInputSlot(name, position);
+        return index != Block::InvalidSlot ? block->GetInputSlot(index) : nullptr;
+    }
+
+    void BinaryScriptView::Instantiate(std::vector<BlockPtr>& blocks, bool withEditorState) const
+    {
+        const BlockRegistry& registry = BlockRegistry::Get();
+        const u32 blockCount = GetBlockCount();
+
+        // Resolve each type name once, not once per block
+        std::vector<TypeIndex> types(GetTypeCount());
+        for (u32 i = 0; i < types.size(); ++i)
+        {
+            types[i] = registry.GetTypeIndex(GetTypeName(i));
+        }
+
+        blocks.assign(blockCount, nullptr);
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            const BlockRecord& record = m_Blocks[i];
+            BlockPtr block = registry.CreateBlock(types[record.Type], UUID(record.IdHigh, record.IdLow));
+            if (!block) continue;  // Unknown type, its connections are dropped below
+
+            block->SetDisabled((record.Flags & BlockFlags::Disabled) != 0);
+            if (withEditorState)
+            {
+                block->SetPosition({ record.PositionX, record.PositionY });
+                block->SetCollapsed((record.Flags & BlockFlags::Collapsed) != 0);
+                if (record.Comment != None) block->SetComment(std::string(GetString(record.Comment)));
+            }
+
+            for (u32 s = 0; s < record.InputCount; ++s)
+            {
+                const SlotRecord& slotRecord = m_Slots[record.FirstSlot + s];
+                if (slotRecord.First == None) continue;
+
+                if (BlockSlot* slot = MatchSlot(block.get(), false, s, GetString(slotRecord.Name)))
+                {
+                    slot->SetDefaultValue(GetValue(slotRecord.First));
+                }
+            }
+
+            blocks[i] = std::move(block);
+        }
+
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            Block* block = blocks[i].get();
+            if (!block) continue;
+
+            const BlockRecord& record = m_Blocks[i];
+
+            for (u32 s = 0; s < record.InputCount; ++s)
+            {
+                const SlotRecord& slotRecord = m_Slots[record.FirstSlot + s];
+                if (slotRecord.Target == None || !blocks[slotRecord.Target]) continue;
+
+                if (BlockSlot* slot = MatchSlot(block, false, s, GetString(slotRecord.Name)))
+                {
+                    slot->Connect(blocks[slotRecord.Target]);
+                }
+            }
+
+            for (u32 s = 0; s < record.NestedCount; ++s)
+            {
+                const SlotRecord& slotRecord = m_Slots[record.FirstSlot + record.InputCount + s];
+                BlockSlot* slot = MatchSlot(block, true, s, GetString(slotRecord.Name));
+                if (!slot) continue;
+
+                for (u32 c = 0; c < slotRecord.Count; ++c)
+                {
+                    slot->AddNestedBlock(blocks[m_Children[slotRecord.First + c]]);
+                }
+            }
+
+            if (record.Next != None && blocks[record.Next])
+            {
+                block->SetNextBlock(blocks[record.Next]);
+            }
+        }
+    }
+
+    BlockScriptPtr BinaryScriptView::CreateScript() const
+    {
+        if (!IsValid()) return nullptr;
+
+        auto script = std::make_shared<BlockScript>(std::string(GetName()));
+        script->SetId(GetId());
+        script->SetDescription(std::string(GetDescription()));
+
+        std::vector<BlockPtr> blocks;
+        Instantiate(blocks, true);
+
+        for (u32 i = 0; i < blocks.size(); ++i)
+        {
+            if (blocks[i] && (m_Blocks[i].Flags & BlockFlags::InScript))
+            {
+                script->AddBlock(blocks[i]);
+            }
+        }
+
+        script->SetVersion(GetScriptVersion());  // AddBlock bumps the version
+        return script;
+    }
+
+    //=========================================================================
+    // BinaryScriptWriter
+    //=========================================================================
+
+    namespace
+    {
+        struct WriterState
+        {
+            std::unordered_map<const Block*, u32> BlockIndex;
+            std::vector<const Block*> Order;
+
+            BlockTypeTable Types;
+            std::vector<BlockRecord> Blocks;
+            std::vector<SlotRecord> Slots;
+            std::vector<u32> Children;
+            std::vector<ValueRecord> Values;
+
+            std::unordered_map<std::string, u32> StringIndex;
+            std::vector<StringRecord> Strings;
+            std::string StringData;
+
+            void Collect(const Block* block)
+            {
+                if (!block || BlockIndex.count(block)) return;
+
+                BlockIndex.emplace(block, static_cast<u32>(Order.size()));
+                Order.push_back(block);
+                CollectChildren(block);
+            }
+
+            void CollectChildren(const Block* block)
+            {
+                for (size_t i = 0; i < block->GetInputSlotCount(); ++i)
+                {
+                    Collect(block->GetInputSlot(i)->GetConnectedBlock().get());
+                }
+
+                for (size_t i = 0; i < block->GetNestedSlotCount(); ++i)
+                {
+                    for (const auto& nested : block->GetNestedSlot(i)->GetNestedBlocks())
+                    {
+                        Collect(nested.get());
+                    }
+                }
+
+                Collect(block->GetNextBlock().get());
+            }
+
+            u32 AddString(const std::string& text)
+            {
+                auto [it, inserted] = StringIndex.try_emplace(text, static_cast<u32>(Strings.size()));
+                if (inserted)
+                {
+                    Strings.push_back({ static_cast<u32>(StringData.size()), static_cast<u32>(text.size()) });
+                    StringData.append(text);
+                }
+                return it->second;
+            }
+
+            u32 FindBlock(const Block* block) const
+            {
+                if (!block) return None;
+                auto it = BlockIndex.find(block);
+                return it != BlockIndex.end() ? it->second : None;
+            }
+
+            /// Encode value into Values[index]; list elements are appended as one run
+            void EncodeValue(const Value& value, u32 index)
+            {
+                ValueRecord record;
+                record.Type = static_cast<u8>(value.GetType());
+
+                switch (value.GetType())
+                {
+                    case ValueType::Bool:   record.Data.Int = value.AsBool() ? 1 : 0; break;
+                    case ValueType::Int:    record.Data.Int = value.AsInt(); break;
+                    case ValueType::Float:  record.Data.Float = value.AsFloat(); break;
+                    case ValueType::String: record.String = AddString(value.AsString()); break;
+                    case ValueType::Entity: record.Data.Entity = value.AsEntityHandle(); break;
+                    case ValueType::Vector2:
+                    {
+                        const glm::vec2 v = value.AsVector2();
+                        record.Data.Components[0] = v.x; record.Data.Components[1] = v.y;
+                        break;
+                    }
+                    case ValueType::Vector3:
+                    {
+                        const glm::vec3 v = value.AsVector3();
+                        record.Data.Components[0] = v.x; record.Data.Components[1] = v.y;
+                        record.Data.Components[2] = v.z;
+                        break;
+                    }
+                    case ValueType::Color:
+                    {
+                        const glm::vec4 v = value.AsColor();
+                        record.Data.Components[0] = v.r; record.Data.Components[1] = v.g;
+                        record.Data.Components[2] = v.b; record.Data.Components[3] = v.a;
+                        break;
+                    }
+                    case ValueType::List:
+                    {
+                        const auto& items = value.AsList();
+                        const u32 first = static_cast<u32>(Values.size());
+                        record.Data.List[0] = first;
+                        record.Data.List[1] = static_cast<u32>(items.size());
+
+                        Values.resize(Values.size() + items.size());
+                        for (size_t i = 0; i < items.size(); ++i)
+                        {
+                            EncodeValue(items[i], first + static_cast<u32>(i));
+                        }
+                        break;
+                    }
+                    default:
+                        record.Type = static_cast<u8>(ValueType::Void);
+                        break;
+                }
+
+                Values[index] = record;
+            }
+
+            u32 AddValue(const Value& value)
+            {
+                const u32 index = static_cast<u32>(Values.size());
+                Values.emplace_back();
+                EncodeValue(value, index);
+                return index;
+            }
+
+            void AddBlock(const Block* block, bool inScript)
+            {
+                BlockRecord record;
+                record.IdHigh = block->GetId().GetHigh();
+                record.IdLow = block->GetId().GetLow();
+                record.Type = Types.Add(block->GetDefinition());
+                record.Next = FindBlock(block->GetNextBlock().get());
+                record.PositionX = block->GetPosition().x;
+                record.PositionY = block->GetPosition().y;
+                if (!block->GetComment().empty()) record.Comment = AddString(block->GetComment());
+
+                if (block->IsDisabled()) record.Flags |= BlockFlags::Disabled;
+                if (block->IsCollapsed()) record.Flags |= BlockFlags::Collapsed;
+                if (inScript) record.Flags |= BlockFlags::InScript;
+
+                record.FirstSlot = static_cast<u32>(Slots.size());
+                record.InputCount = static_cast<u16>(block->GetInputSlotCount());
+                record.NestedCount = static_cast<u16>(block->GetNestedSlotCount());
+
+                for (size_t i = 0; i < block->GetInputSlotCount(); ++i)
+                {
+                    const BlockSlot* slot = block->GetInputSlot(i);
+
+                    SlotRecord slotRecord;
+                    slotRecord.Name = AddString(slot->GetName());
+                    slotRecord.Target = FindBlock(slot->GetConnectedBlock().get());
+                    if (!slot->GetDefaultValue().IsVoid()) slotRecord.First = AddValue(slot->GetDefaultValue());
+                    Slots.push_back(slotRecord);
+                }
+
+                for (size_t i = 0; i < block->GetNestedSlotCount(); ++i)
+                {
+                    const BlockSlot* slot = block->GetNestedSlot(i);
+
+                    SlotRecord slotRecord;
+                    slotRecord.Name = AddString(slot->GetName());
+                    slotRecord.First = static_cast<u32>(Children.size());
+                    for (const auto& nested : slot->GetNestedBlocks())
+                    {
+                        Children.push_back(FindBlock(nested.get()));
+                    }
+                    slotRecord.Count = static_cast<u32>(Children.size()) - slotRecord.First;
+                    Slots.push_back(slotRecord);
+                }
+
+                Blocks.push_back(record);
+            }
+        };
+
+        u32 AlignSection(u32 offset)
+        {
+            return (offset + SectionAlignment - 1) & ~(SectionAlignment - 1);
+        }
+
+        /// Place a section after offset and advance offset past it
+        Section PlaceSection(u32& offset, size_t count, size_t recordSize)
+        {
+            Section section;
+            section.Offset = AlignSection(offset);
+            section.Count = static_cast<u32>(count);
+            offset = section.Offset + static_cast<u32>(count * recordSize);
+            return section;
+        }
+
+        template<typename T>
+        void CopySection(std::vector<u8>& buffer, const Section& section, const T* data, size_t count)
+        {
+            if (count > 0) std::memcpy(buffer.data() + section.Offset, data, count * sizeof(T));
+        }
+    }
+
+    std::vector<u8> BinaryScriptWriter::Write(const BlockScript& script)
+    {
+        WriterState state;
+
+        // Script blocks keep their order; nested/connected blocks follow
+        const auto& scriptBlocks = script.GetBlocks();
+        for (const auto& block : scriptBlocks)
+        {
+            if (block && !state.BlockIndex.count(block.get()))
+            {
+                state.BlockIndex.emplace(block.get(), static_cast<u32>(state.Order.size()));
+                state.Order.push_back(block.get());
+            }
+        }
+
+        const size_t scriptBlockCount = state.Order.size();
+        for (size_t i = 0; i < scriptBlockCount; ++i)
+        {
+            state.CollectChildren(state.Order[i]);
+        }
+
+        state.Blocks.reserve(state.Order.size());
+        for (size_t i = 0; i < state.Order.size(); ++i)
+        {
+            state.AddBlock(state.Order[i], i < scriptBlockCount);
+        }
+
+        Header header;
+        header.Magic = BinaryScriptFormat::Magic;
+        header.Version = BinaryScriptFormat::Version;
+        header.HeaderSize = sizeof(Header);
+        header.ScriptVersion = script.GetVersion();
+        header.IdHigh = script.GetId().GetHigh();
+        header.IdLow = script.GetId().GetLow();
+        header.Name = state.AddString(script.GetName());
+        if (!script.GetDescription().empty()) header.Description = state.AddString(script.GetDescription());
+
+        std::vector<u32> types;
+        types.reserve(state.Types.GetCount());
+        for (const auto& name : state.Types.GetNames())
+        {
+            types.push_back(state.AddString(name));
+        }
+
+        u32 offset = sizeof(Header);
+        header.Types = PlaceSection(offset, types.size(), sizeof(u32));
+        header.Blocks = PlaceSection(offset, state.Blocks.size(), sizeof(BlockRecord));
+        header.Slots = PlaceSection(offset, state.Slots.size(), sizeof(SlotRecord));
+        header.Children = PlaceSection(offset, state.Children.size(), sizeof(u32));
+        header.Values = PlaceSection(offset, state.Values.size(), sizeof(ValueRecord));
+        header.Strings = PlaceSection(offset, state.Strings.size(), sizeof(StringRecord));
+        header.StringData = PlaceSection(offset, state.StringData.size(), 1);
+        header.FileSize = AlignSection(offset);
+
+        std::vector<u8> buffer(header.FileSize, 0);
+        std::memcpy(buffer.data(), &header, sizeof(Header));
+        CopySection(buffer, header.Types, types.data(), types.size());
+        CopySection(buffer, header.Blocks, state.Blocks.data(), state.Blocks.size());
+        CopySection(buffer, header.Slots, state.Slots.data(), state.Slots.size());
+        CopySection(buffer, header.Children, state.Children.data(), state.Children.size());
+        CopySection(buffer, header.Values, state.Values.data(), state.Values.size());
+        CopySection(buffer, header.Strings, state.Strings.data(), state.Strings.size());
+        CopySection(buffer, header.StringData, state.StringData.data(), state.StringData.size());
+
+        return buffer;
+    }
+
+    //=========================================================================
+    // BinaryScriptFile
+    //=========================================================================
+
+    BinaryScriptFilePtr BinaryScriptFile::Open(const std::string& path, std::string* error)
+    {
+        BinaryScriptFilePtr file(new BinaryScriptFile());
+
+        file->m_File = MappedFile::Open(path);
+        if (!file->m_File)
+        {
+            if (error) *error = "Failed to open file";
+            return nullptr;
+        }
+
+        if (!file->m_View.Open(file->m_File->GetBytes(), error)) return nullptr;
+        return file;
+    }
+
+    BinaryScriptFilePtr BinaryScriptFile::FromBytes(std::vector<u8> bytes, std::string* error)
+    {
+        BinaryScriptFilePtr file(new BinaryScriptFile());
+        file->m_Bytes = std::move(bytes);
+
+        if (!file->m_View.Open(file->m_Bytes, error)) return nullptr;
+        return file;
+    }
+
+    const CompiledScriptPtr& BinaryScriptFile::GetProgram()
+    {
+        if (!m_Program)
+        {
+            m_Program = CompiledScript::Compile(m_View);
+        }
+        return m_Program;
+    }
+
+    BlockScriptPtr BinaryScriptFile::GetScript()
+    {
+        if (!m_Script)
+        {
+            m_Script = m_View.CreateScript();
+        }
+        return m_Script;
+    }
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "../Core/BlockScript.h"
+#include "../Execution/CompiledScript.h"
+#include "MappedFile.h"
+#include <bit>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // BinaryScriptFormat - On-disk layout of .rbsbin files
+    //=========================================================================
+
+    /// Flat, offset-based layout that is used in place: a file is mapped (or
+    /// read) once, validated once, and then read through plain struct views.
+    /// All offsets are from the start of the file, every section is 8-byte
+    /// aligned, and all references are indices into another section, so no
+    /// pointer fix-up is needed. Little-endian only.
+    namespace BinaryScriptFormat
+    {
+        static_assert(std::endian::native == std::endian::little, "BinaryScript reads records in place");
+
+        constexpr u32 Magic = 0x52425343;       // "RBSC" = RiftBlocks Script
+        constexpr u16 Version = 2;              // Version 1 files only ever held the header
+        constexpr u32 None = 0xFFFFFFFF;        // Empty index
+        constexpr u32 SectionAlignment = 8;
+
+        struct Section
+        {
+            u32 Offset = 0;
+            u32 Count = 0;                      // Records (bytes for StringData)
+        };
+
+        struct Header
+        {
+            u32 Magic = 0;
+            u16 Version = 0;
+            u16 HeaderSize = 0;
+            u32 FileSize = 0;
+            u32 ScriptVersion = 0;
+            u64 IdHigh = 0;
+            u64 IdLow = 0;
+            u32 Name = None;                    // String index
+            u32 Description = None;             // String index
+
+            Section Types;                      // u32 string index per type
+            Section Blocks;                     // BlockRecord
+            Section Slots;                      // SlotRecord
+            Section Children;                   // u32 block index per nested entry
+            Section Values;                     // ValueRecord
+            Section Strings;                    // StringRecord
+            Section StringData;                 // Raw UTF-8 bytes
+        };
+
+        enum BlockFlags : u16
+        {
+            Disabled  = 1 << 0,
+            Collapsed = 1 << 1,
+            InScript  = 1 << 2,                 // Listed in BlockScript::GetBlocks()
+        };
+
+        struct BlockRecord
+        {
+            u64 IdHigh = 0;
+            u64 IdLow = 0;
+            u16 Type = 0;                       // Index into Types
+            u16 Flags = 0;
+            u32 Next = None;                    // Block index
+            f32 PositionX = 0.0f;
+            f32 PositionY = 0.0f;
+            u32 Comment = None;                 // String index
+            u32 FirstSlot = 0;                  // Inputs first, then nested bodies
+            u16 InputCount = 0;
+            u16 NestedCount = 0;
+            u32 Reserved = 0;
+        };
+
+        struct SlotRecord
+        {
+            u32 Name = None;                    // String index
+            u32 Target = None;                  // Input: connected block index
+            u32 First = None;                   // Input: default value index, nested: first child
+            u32 Count = 0;                      // Nested: child count
+        };
+
+        struct ValueRecord
+        {
+            u8 Type = 0;                        // ValueType
+            u8 Reserved[3] = {};
+            u32 String = None;                  // String values: string index
+            union
+            {
+                i64 Int;
+                f64 Float;
+                f32 Components[4];              // Vector2/3 and Color
+                u64 Entity;
+                u32 List[2];                    // First element value index, element count
+            } Data = {};
+        };
+
+        struct StringRecord
+        {
+            u32 Offset = 0;                     // Into StringData
+            u32 Length = 0;
+        };
+
+        static_assert(sizeof(Header) == 96);
+        static_assert(sizeof(BlockRecord) == 48);
+        static_assert(sizeof(SlotRecord) == 16);
+        static_assert(sizeof(ValueRecord) == 24);
+        static_assert(sizeof(StringRecord) == 8);
+    }
+
+    //=========================================================================
+    // BinaryScriptView - Validated, read-only view over .rbsbin bytes
+    //=========================================================================
+
+    class BinaryScriptView
+    {
+    public:
+        using Header = BinaryScriptFormat::Header;
+        using BlockRecord = BinaryScriptFormat::BlockRecord;
+        using SlotRecord = BinaryScriptFormat::SlotRecord;
+        using ValueRecord = BinaryScriptFormat::ValueRecord;
+
+        BinaryScriptView() = default;
+
+        /// Validate every header field, offset and index once. On success the
+        /// accessors below need no further checks; on failure the view stays
+        /// empty and error (if given) says why. The bytes are not copied and
+        /// must outlive the view.
+        bool Open(std::span<const u8> bytes, std::string* error = nullptr);
+
+        bool IsValid() const { return m_Header != nullptr; }
+
+        //---------------------------------------------------------------------
+        // Script
+        //---------------------------------------------------------------------
+
+        UUID GetId() const { return UUID(m_Header->IdHigh, m_Header->IdLow); }
+        u32 GetScriptVersion() const { return m_Header->ScriptVersion; }
+        std::string_view GetName() const { return GetString(m_Header->Name); }
+        std::string_view GetDescription() const { return GetString(m_Header->Description); }
+
+        //---------------------------------------------------------------------
+        // Records (indices are validated by Open)
+        //---------------------------------------------------------------------
+
+        u32 GetTypeCount() const { return m_Header->Types.Count; }
+        std::string_view GetTypeName(u32 index) const { return GetString(m_Types[index]); }
+
+        u32 GetBlockCount() const { return m_Header->Blocks.Count; }
+        const BlockRecord& GetBlock(u32 index) const { return m_Blocks[index]; }
+        const SlotRecord& GetSlot(u32 index) const { return m_Slots[index]; }
+        u32 GetChild(u32 index) const { return m_Children[index]; }
+        const ValueRecord& GetValueRecord(u32 index) const { return m_Values[index]; }
+
+        /// Empty view for BinaryScriptFormat::None
+        std::string_view GetString(u32 index) const;
+
+        /// Decode a value (allocates only for strings and lists). Open caps list
+        /// nesting at BinaryCodec::MaxValueDepth and keeps element runs disjoint.
+        Value GetValue(u32 index) const;
+
+        //---------------------------------------------------------------------
+        // Instantiation
+        //---------------------------------------------------------------------
+
+        /// Create one Block per record (nullptr for unknown types), with
+        /// defaults and connections wired. Editor state (position, comment,
+        /// collapsed) is only restored when requested. blocks is indexed like
+        /// the file's block table.
+        void Instantiate(std::vector<BlockPtr>& blocks, bool withEditorState) const;
+
+        /// Build an editable BlockScript
+        BlockScriptPtr CreateScript() const;
+
+    private:
+        template<typename T>
+        const T* SectionData(const BinaryScriptFormat::Section& section) const
+        {
+            return reinterpret_cast<const T*>(m_Data + section.Offset);
+        }
+
+        template<typename Fn>
+        void ForEachEdge(u32 block, Fn&& fn) const;
+
+        bool Fail(std::string* error, const char* message);
+
+        const u8* m_Data = nullptr;
+        const Header* m_Header = nullptr;
+        const u32* m_Types = nullptr;
+        const BlockRecord* m_Blocks = nullptr;
+        const SlotRecord* m_Slots = nullptr;
+        const u32* m_Children = nullptr;
+        const ValueRecord* m_Values = nullptr;
+        const BinaryScriptFormat::StringRecord* m_Strings = nullptr;
+        const char* m_StringData = nullptr;
+    };
+
+    //=========================================================================
+    // BinaryScriptWriter - Produces .rbsbin bytes
+    //=========================================================================
+
+    class BinaryScriptWriter
+    {
+    public:
+        static std::vector<u8> Write(const BlockScript& script);
+    };
+
+    //=========================================================================
+    // BinaryScriptFile - Loaded .rbsbin with on-demand editor script
+    //=========================================================================
+
+    /// Keeps the file bytes alive and exposes the validated view. The
+    /// runtime program is compiled straight from the view on first use and
+    /// shared by every instance after that; the editable BlockScript is only
+    /// built the first time GetScript() is called.
+    class BinaryScriptFile
+    {
+    public:
+        static std::shared_ptr<BinaryScriptFile> Open(const std::string& path, std::string* error = nullptr);
+        static std::shared_ptr<BinaryScriptFile> FromBytes(std::vector<u8> bytes, std::string* error = nullptr);
+
+        const BinaryScriptView& GetView() const { return m_View; }
+
+        /// Runtime program built directly from the file, compiled once
+        const CompiledScriptPtr& GetProgram();
+
+        /// Spawn path: one allocation for the instance state, the blocks
+        /// are shared through the program
+        ScriptInstancePtr CreateInstance() { return ScriptInstance::Create(GetProgram()); }
+
+        /// Editable script, materialized on first use
+        BlockScriptPtr GetScript();
+        bool IsMaterialized() const { return m_Script != nullptr; }
+
+    private:
+        BinaryScriptFile() = default;
+
+        std::unique_ptr<MappedFile> m_File;
+        std::vector<u8> m_Bytes;                // Used when built from memory
+        BinaryScriptView m_View;
+        CompiledScriptPtr m_Program;
+        BlockScriptPtr m_Script;
+    };
+
+    using BinaryScriptFilePtr = std::shared_ptr<BinaryScriptFile>;
+}
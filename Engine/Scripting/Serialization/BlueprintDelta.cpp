@@ -0,0 +1,667 @@
+#include "BlueprintDelta.h"
+#include "BinaryCodec.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <optional>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // Patch layout
+    //=========================================================================
+
+    // Magic, version, blueprint id, base checksum, target checksum, then:
+    //   varuint header mask, changed header fields in bit order
+    //   varuint count + ids of removed nodes
+    //   varuint count + added nodes (BlueprintSerializer node records)
+    //   varuint count + modified nodes: id, varuint field mask, changed fields
+    // Connections (when flagged) are a splice: kept prefix, removed count,
+    // inserted records.
+
+    namespace
+    {
+        enum HeaderField : uint32_t
+        {
+            FieldVersion          = 1u << 0,
+            FieldName             = 1u << 1,
+            FieldDescription      = 1u << 2,
+            FieldIconPath         = 1u << 3,
+            FieldBaseCooldown     = 1u << 4,
+            FieldManaCost         = 1u << 5,
+            FieldCastTime         = 1u << 6,
+            FieldRange            = 1u << 7,
+            FieldMaxLevel         = 1u << 8,
+            FieldCooldownPerLevel = 1u << 9,
+            FieldManaCostPerLevel = 1u << 10,
+            FieldDamagePerLevel   = 1u << 11,
+            FieldRootId           = 1u << 12,
+            FieldConnections      = 1u << 13,
+            HeaderFieldMask       = (1u << 14) - 1
+        };
+
+        enum NodeField : uint32_t
+        {
+            NodeTypeId            = 1u << 0,
+            NodeNext              = 1u << 1,
+            NodeParent            = 1u << 2,
+            NodeProperties        = 1u << 3,
+            NodeChildren          = 1u << 4,
+            NodeFieldMask         = (1u << 5) - 1
+        };
+
+        struct NodeChange
+        {
+            UUID Id;
+            uint32_t Fields = 0;
+            std::string TypeId;
+            UUID NextBlockId;
+            UUID ParentId;
+            std::vector<std::string> RemovedKeys;
+            std::vector<std::pair<std::string, Value>> SetProperties;
+            std::vector<UUID> Children;
+        };
+
+        /// A decoded patch, applied only once it has been read completely
+        struct Patch
+        {
+            UUID Id;
+            uint64_t BaseChecksum = 0;
+            uint64_t TargetChecksum = 0;
+            uint32_t Fields = 0;
+            AbilityBlueprint Header;            // Changed header fields; its AST is unused
+            std::vector<UUID> Removed;
+            std::vector<ASTNode> Added;
+            std::vector<NodeChange> Modified;
+            uint32_t ConnectionPrefix = 0;
+            uint32_t ConnectionsRemoved = 0;
+            std::vector<ASTConnection> ConnectionsAdded;
+        };
+
+        // Smallest encodings, used to reject counts before allocating
+        constexpr size_t MinNodeChangeSize = 16 + 1;
+        constexpr size_t MinAddedNodeSize = 16 + 1 + 16 + 16 + 1 + 1;
+        constexpr size_t MinConnectionSize = 16 + 16 + 1 + 1;
+
+        bool SameBits(float a, float b)
+        {
+            return std::bit_cast<uint32_t>(a) == std::bit_cast<uint32_t>(b);
+        }
+
+        bool SameBits(const std::vector<float>& a, const std::vector<float>& b)
+        {
+            return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0);
+        }
+
+        /// Equal encodings; Value::operator== converts between numbers and
+        /// never matches lists
+        bool SameValue(const Value& a, const Value& b)
+        {
+            if (a.GetType() != b.GetType()) return false;
+
+            thread_local BinaryWriter left, right;
+            left.Clear();
+            right.Clear();
+            left.WriteValue(a);
+            right.WriteValue(b);
+            return left.GetSize() == right.GetSize() && std::memcmp(left.GetData(), right.GetData(), left.GetSize()) == 0;
+        }
+
+        bool SameConnection(const ASTConnection& a, const ASTConnection& b)
+        {
+            return a.SourceBlockId == b.SourceBlockId && a.TargetBlockId == b.TargetBlockId &&
+                   a.SourcePortName == b.SourcePortName && a.TargetPortName == b.TargetPortName;
+        }
+
+        void WriteConnection(const ASTConnection& connection, BinaryWriter& writer)
+        {
+            writer.WriteUUID(connection.SourceBlockId);
+            writer.WriteUUID(connection.TargetBlockId);
+            writer.WriteString(connection.SourcePortName);
+            writer.WriteString(connection.TargetPortName);
+        }
+
+        bool ReadConnection(BinaryReader& reader, ASTConnection& connection)
+        {
+            return reader.ReadUUID(connection.SourceBlockId) &&
+                   reader.ReadUUID(connection.TargetBlockId) &&
+                   reader.ReadString(connection.SourcePortName) &&
+                   reader.ReadString(connection.TargetPortName);
+        }
+
+        /// Leaf hash of the node at a position of the (valid) hash cache
+        const Hash128& LeafHash(const BlockAST& ast, size_t index)
+        {
+            return ast.HashCache.Tree[ast.HashCache.Width + index];
+        }
+    }
+
+    //=========================================================================
+    // Create
+    //=========================================================================
+
+    static uint32_t DiffNode(const ASTNode& from, const ASTNode& to)
+    {
+        uint32_t fields = 0;
+        if (from.TypeId != to.TypeId) fields |= NodeTypeId;
+        if (from.NextBlockId != to.NextBlockId) fields |= NodeNext;
+        if (from.ParentId != to.ParentId) fields |= NodeParent;
+        if (from.Children != to.Children) fields |= NodeChildren;
+
+        if (from.Properties.size() != to.Properties.size())
+        {
+            fields |= NodeProperties;
+        }
+        else
+        {
+            for (auto a = from.Properties.begin(), b = to.Properties.begin(); a != from.Properties.end(); ++a, ++b)
+            {
+                if (a->first != b->first || !SameValue(a->second, b->second))
+                {
+                    fields |= NodeProperties;
+                    break;
+                }
+            }
+        }
+        return fields;
+    }
+
+    static void WriteProperties(const ASTNode& from, const ASTNode& to, BinaryWriter& writer)
+    {
+        std::vector<const std::string*> removed;
+        std::vector<const std::pair<const std::string, Value>*> set;
+
+        // Both maps are sorted: one merge pass
+        auto a = from.Properties.begin();
+        auto b = to.Properties.begin();
+        while (a != from.Properties.end() || b != to.Properties.end())
+        {
+            if (b == to.Properties.end() || (a != from.Properties.end() && a->first < b->first))
+            {
+                removed.push_back(&a->first);
+                ++a;
+            }
+            else if (a == from.Properties.end() || b->first < a->first)
+            {
+                set.push_back(&*b);
+                ++b;
+            }
+            else
+            {
+                if (!SameValue(a->second, b->second)) set.push_back(&*b);
+                ++a;
+                ++b;
+            }
+        }
+
+        writer.WriteVarUInt(removed.size());
+        for (const std::string* key : removed)
+        {
+            writer.WriteString(*key);
+        }
+
+        writer.WriteVarUInt(set.size());
+        for (const auto* property : set)
+        {
+            writer.WriteString(property->first);
+            writer.WriteValue(property->second);
+        }
+    }
+
+    static void WriteConnectionSplice(const std::vector<ASTConnection>& from, const std::vector<ASTConnection>& to,
+                                      BinaryWriter& writer)
+    {
+        size_t prefix = 0;
+        while (prefix < from.size() && prefix < to.size() && SameConnection(from[prefix], to[prefix])) ++prefix;
+
+        size_t suffix = 0;
+        while (suffix < from.size() - prefix && suffix < to.size() - prefix &&
+               SameConnection(from[from.size() - 1 - suffix], to[to.size() - 1 - suffix]))
+        {
+            ++suffix;
+        }
+
+        writer.WriteVarUInt(prefix);
+        writer.WriteVarUInt(from.size() - prefix - suffix);
+        writer.WriteVarUInt(to.size() - prefix - suffix);
+        for (size_t i = prefix; i < to.size() - suffix; ++i)
+        {
+            WriteConnection(to[i], writer);
+        }
+    }
+
+    std::vector<uint8_t> BlueprintDelta::Create(const AbilityBlueprint& from, const AbilityBlueprint& to)
+    {
+        BinaryWriter writer(256);
+        Create(from, to, writer);
+        return writer.TakeBytes();
+    }
+
+    void BlueprintDelta::Create(const AbilityBlueprint& from, const AbilityBlueprint& to, BinaryWriter& writer)
+    {
+        // Also brings both Merkle trees up to date; their leaves find the changed nodes
+        const uint64_t baseChecksum = BlueprintSerializer::ComputeChecksum(from);
+        const uint64_t targetChecksum = BlueprintSerializer::ComputeChecksum(to);
+
+        writer.WriteU32(MAGIC);
+        writer.WriteU32(VERSION);
+        writer.WriteUUID(to.Id);
+        writer.WriteU64(baseChecksum);
+        writer.WriteU64(targetChecksum);
+
+        const BlockAST& fromAST = from.ScriptAST;
+        const BlockAST& toAST = to.ScriptAST;
+
+        uint32_t fields = 0;
+        if (from.Version != to.Version) fields |= FieldVersion;
+        if (from.Name != to.Name) fields |= FieldName;
+        if (from.Description != to.Description) fields |= FieldDescription;
+        if (from.IconPath != to.IconPath) fields |= FieldIconPath;
+        if (!SameBits(from.BaseCooldown, to.BaseCooldown)) fields |= FieldBaseCooldown;
+        if (!SameBits(from.ManaCost, to.ManaCost)) fields |= FieldManaCost;
+        if (!SameBits(from.CastTime, to.CastTime)) fields |= FieldCastTime;
+        if (!SameBits(from.Range, to.Range)) fields |= FieldRange;
+        if (from.MaxLevel != to.MaxLevel) fields |= FieldMaxLevel;
+        if (!SameBits(from.CooldownPerLevel, to.CooldownPerLevel)) fields |= FieldCooldownPerLevel;
+        if (!SameBits(from.ManaCostPerLevel, to.ManaCostPerLevel)) fields |= FieldManaCostPerLevel;
+        if (!SameBits(from.DamagePerLevel, to.DamagePerLevel)) fields |= FieldDamagePerLevel;
+        if (fromAST.RootId != toAST.RootId) fields |= FieldRootId;
+        if (!std::equal(fromAST.Connections.begin(), fromAST.Connections.end(),
+                        toAST.Connections.begin(), toAST.Connections.end(), SameConnection))
+        {
+            fields |= FieldConnections;
+        }
+
+        writer.WriteVarUInt(fields);
+        if (fields & FieldVersion) writer.WriteVarUInt(to.Version);
+        if (fields & FieldName) writer.WriteString(to.Name);
+        if (fields & FieldDescription) writer.WriteString(to.Description);
+        if (fields & FieldIconPath) writer.WriteString(to.IconPath);
+        if (fields & FieldBaseCooldown) writer.WriteF32(to.BaseCooldown);
+        if (fields & FieldManaCost) writer.WriteF32(to.ManaCost);
+        if (fields & FieldCastTime) writer.WriteF32(to.CastTime);
+        if (fields & FieldRange) writer.WriteF32(to.Range);
+        if (fields & FieldMaxLevel) writer.WriteVarInt(to.MaxLevel);
+        if (fields & FieldCooldownPerLevel) writer.WriteF32Array(to.CooldownPerLevel);
+        if (fields & FieldManaCostPerLevel) writer.WriteF32Array(to.ManaCostPerLevel);
+        if (fields & FieldDamagePerLevel) writer.WriteF32Array(to.DamagePerLevel);
+        if (fields & FieldRootId) writer.WriteUUID(toAST.RootId);
+        if (fields & FieldConnections) WriteConnectionSplice(fromAST.Connections, toAST.Connections, writer);
+
+        // Merge the two sorted id lists
+        const std::vector<UUID>& fromOrder = fromAST.HashCache.Order;
+        const std::vector<UUID>& toOrder = toAST.HashCache.Order;
+
+        std::vector<UUID> removed;
+        std::vector<const ASTNode*> added;
+        std::vector<std::pair<size_t, size_t>> common;      // (from index, to index) with different leaves
+
+        size_t i = 0, j = 0;
+        while (i < fromOrder.size() || j < toOrder.size())
+        {
+            if (j == toOrder.size() || (i < fromOrder.size() && fromOrder[i] < toOrder[j]))
+            {
+                removed.push_back(fromOrder[i++]);
+            }
+            else if (i == fromOrder.size() || toOrder[j] < fromOrder[i])
+            {
+                added.push_back(&toAST.Nodes.at(toOrder[j++]));
+            }
+            else
+            {
+                if (LeafHash(fromAST, i) != LeafHash(toAST, j)) common.emplace_back(i, j);
+                ++i;
+                ++j;
+            }
+        }
+
+        writer.WriteVarUInt(removed.size());
+        for (const UUID& id : removed)
+        {
+            writer.WriteUUID(id);
+        }
+
+        writer.WriteVarUInt(added.size());
+        for (const ASTNode* node : added)
+        {
+            BlueprintSerializer::WriteNode(*node, writer);
+        }
+
+        writer.WriteVarUInt(common.size());
+        for (const auto& [fromIndex, toIndex] : common)
+        {
+            const ASTNode& a = fromAST.Nodes.at(fromOrder[fromIndex]);
+            const ASTNode& b = toAST.Nodes.at(toOrder[toIndex]);
+            const uint32_t nodeFields = DiffNode(a, b);
+
+            writer.WriteUUID(b.Id);
+            writer.WriteVarUInt(nodeFields);
+            if (nodeFields & NodeTypeId) writer.WriteString(b.TypeId);
+            if (nodeFields & NodeNext) writer.WriteUUID(b.NextBlockId);
+            if (nodeFields & NodeParent) writer.WriteUUID(b.ParentId);
+            if (nodeFields & NodeProperties) WriteProperties(a, b, writer);
+            if (nodeFields & NodeChildren)
+            {
+                writer.WriteVarUInt(b.Children.size());
+                for (const UUID& child : b.Children)
+                {
+                    writer.WriteUUID(child);
+                }
+            }
+        }
+    }
+
+    //=========================================================================
+    // Apply
+    //=========================================================================
+
+    static bool ReadPatch(BinaryReader& reader, Patch& patch)
+    {
+        uint32_t magic = 0, version = 0;
+        reader.ReadU32(magic);
+        reader.ReadU32(version);
+        if (reader.HasError() || magic != BlueprintDelta::MAGIC) return reader.Fail("Not a blueprint patch");
+        if (version != BlueprintDelta::VERSION) return reader.Fail("Unsupported patch version");
+
+        reader.ReadUUID(patch.Id);
+        reader.ReadU64(patch.BaseChecksum);
+        reader.ReadU64(patch.TargetChecksum);
+
+        u64 fields = 0;
+        if (!reader.ReadVarUInt(fields)) return false;
+        if (fields & ~static_cast<u64>(HeaderFieldMask)) return reader.Fail("Unknown header field");
+        patch.Fields = static_cast<uint32_t>(fields);
+
+        AbilityBlueprint& header = patch.Header;
+        if (fields & FieldVersion)
+        {
+            u64 value = 0;
+            if (reader.ReadVarUInt(value) && value > UINT32_MAX) return reader.Fail("Version out of range");
+            header.Version = static_cast<uint32_t>(value);
+        }
+        if (fields & FieldName) reader.ReadString(header.Name);
+        if (fields & FieldDescription) reader.ReadString(header.Description);
+        if (fields & FieldIconPath) reader.ReadString(header.IconPath);
+        if (fields & FieldBaseCooldown) reader.ReadF32(header.BaseCooldown);
+        if (fields & FieldManaCost) reader.ReadF32(header.ManaCost);
+        if (fields & FieldCastTime) reader.ReadF32(header.CastTime);
+        if (fields & FieldRange) reader.ReadF32(header.Range);
+        if (fields & FieldMaxLevel)
+        {
+            int64_t value = 0;
+            if (reader.ReadVarInt(value) && (value < INT32_MIN || value > INT32_MAX)) return reader.Fail("MaxLevel out of range");
+            header.MaxLevel = static_cast<int>(value);
+        }
+        if (fields & FieldCooldownPerLevel) reader.ReadF32Array(header.CooldownPerLevel);
+        if (fields & FieldManaCostPerLevel) reader.ReadF32Array(header.ManaCostPerLevel);
+        if (fields & FieldDamagePerLevel) reader.ReadF32Array(header.DamagePerLevel);
+        if (fields & FieldRootId) reader.ReadUUID(header.ScriptAST.RootId);
+        if (fields & FieldConnections)
+        {
+            uint32_t count = 0;
+            reader.ReadCount(patch.ConnectionPrefix, 0);
+            reader.ReadCount(patch.ConnectionsRemoved, 0);
+            if (!reader.ReadCount(count, MinConnectionSize)) return false;
+
+            patch.ConnectionsAdded.resize(count);
+            for (ASTConnection& connection : patch.ConnectionsAdded)
+            {
+                if (!ReadConnection(reader, connection)) return false;
+            }
+        }
+
+        uint32_t count = 0;
+        if (!reader.ReadCount(count, 16)) return false;
+        patch.Removed.resize(count);
+        for (UUID& id : patch.Removed)
+        {
+            if (!reader.ReadUUID(id)) return false;
+        }
+
+        if (!reader.ReadCount(count, MinAddedNodeSize)) return false;
+        patch.Added.resize(count);
+        for (ASTNode& node : patch.Added)
+        {
+            if (!BlueprintSerializer::ReadNode(reader, node)) return false;
+        }
+
+        if (!reader.ReadCount(count, MinNodeChangeSize)) return false;
+        patch.Modified.resize(count);
+        for (NodeChange& change : patch.Modified)
+        {
+            u64 nodeFields = 0;
+            if (!reader.ReadUUID(change.Id) || !reader.ReadVarUInt(nodeFields)) return false;
+            if (nodeFields & ~static_cast<u64>(NodeFieldMask)) return reader.Fail("Unknown node field");
+            change.Fields = static_cast<uint32_t>(nodeFields);
+
+            if (nodeFields & NodeTypeId) reader.ReadString(change.TypeId);
+            if (nodeFields & NodeNext) reader.ReadUUID(change.NextBlockId);
+            if (nodeFields & NodeParent) reader.ReadUUID(change.ParentId);
+            if (nodeFields & NodeProperties)
+            {
+                uint32_t keys = 0;
+                if (!reader.ReadCount(keys, 1)) return false;
+                change.RemovedKeys.resize(keys);
+                for (std::string& key : change.RemovedKeys)
+                {
+                    if (!reader.ReadString(key)) return false;
+                }
+
+                if (!reader.ReadCount(keys, 2)) return false;
+                change.SetProperties.resize(keys);
+                for (auto& [key, value] : change.SetProperties)
+                {
+                    if (!reader.ReadString(key) || !reader.ReadValue(value)) return false;
+                }
+            }
+            if (nodeFields & NodeChildren)
+            {
+                uint32_t children = 0;
+                if (!reader.ReadCount(children, 16)) return false;
+                change.Children.resize(children);
+                for (UUID& child : change.Children)
+                {
+                    if (!reader.ReadUUID(child)) return false;
+                }
+            }
+            if (reader.HasError()) return false;
+        }
+
+        if (reader.HasError()) return false;
+        if (!reader.IsAtEnd()) return reader.Fail("Trailing data");
+        return true;
+    }
+
+    /// Everything Apply() changed, so a failed verification can put it back
+    struct UndoLog
+    {
+        std::optional<AbilityBlueprint> Header;         // AST-less copy of the old header
+        std::optional<std::vector<ASTConnection>> Connections;
+        std::vector<ASTNode> Removed;
+        std::vector<UUID> Added;
+        std::vector<ASTNode> Modified;
+    };
+
+    static void CopyHeader(const AbilityBlueprint& from, AbilityBlueprint& to)
+    {
+        to.Version = from.Version;
+        to.Name = from.Name;
+        to.Description = from.Description;
+        to.IconPath = from.IconPath;
+        to.BaseCooldown = from.BaseCooldown;
+        to.ManaCost = from.ManaCost;
+        to.CastTime = from.CastTime;
+        to.Range = from.Range;
+        to.MaxLevel = from.MaxLevel;
+        to.CooldownPerLevel = from.CooldownPerLevel;
+        to.ManaCostPerLevel = from.ManaCostPerLevel;
+        to.DamagePerLevel = from.DamagePerLevel;
+        to.ScriptAST.RootId = from.ScriptAST.RootId;
+    }
+
+    static void Rollback(AbilityBlueprint& blueprint, UndoLog& undo)
+    {
+        BlockAST& ast = blueprint.ScriptAST;
+
+        if (undo.Header) CopyHeader(*undo.Header, blueprint);
+        if (undo.Connections) ast.Connections = std::move(*undo.Connections);
+
+        for (const UUID& id : undo.Added)
+        {
+            ast.Nodes.erase(id);
+        }
+        for (ASTNode& node : undo.Removed)
+        {
+            const UUID id = node.Id;
+            ast.Nodes.insert_or_assign(id, std::move(node));
+        }
+        // Newest first, in case a node was listed twice
+        for (auto node = undo.Modified.rbegin(); node != undo.Modified.rend(); ++node)
+        {
+            const UUID id = node->Id;
+            ast.Nodes.insert_or_assign(id, std::move(*node));
+        }
+
+        ast.InvalidateHashes();
+    }
+
+    bool BlueprintDelta::Apply(AbilityBlueprint& blueprint, std::span<const uint8_t> bytes, std::string* error)
+    {
+        auto fail = [error](const char* message)
+        {
+            if (error) *error = message;
+            return false;
+        };
+
+        Patch patch;
+        BinaryReader reader(bytes);
+        if (!ReadPatch(reader, patch)) return fail(reader.GetError());
+
+        if (patch.Id != blueprint.Id) return fail("Patch is for another blueprint");
+        if (BlueprintSerializer::ComputeChecksumUncached(blueprint) != patch.BaseChecksum) return fail("Blueprint is not the patch base");
+
+        // Check every reference before touching anything
+        BlockAST& ast = blueprint.ScriptAST;
+        if ((patch.Fields & FieldConnections) &&
+            (patch.ConnectionPrefix > ast.Connections.size() ||
+             patch.ConnectionsRemoved > ast.Connections.size() - patch.ConnectionPrefix))
+        {
+            return fail("Connection splice out of range");
+        }
+        for (const UUID& id : patch.Removed)
+        {
+            if (!ast.Nodes.count(id)) return fail("Removed node does not exist");
+        }
+        for (const NodeChange& change : patch.Modified)
+        {
+            if (!ast.Nodes.count(change.Id)) return fail("Modified node does not exist");
+        }
+        for (const ASTNode& node : patch.Added)
+        {
+            if (ast.Nodes.count(node.Id)) return fail("Added node already exists");
+        }
+
+        UndoLog undo;
+
+        if (patch.Fields & ~FieldConnections)
+        {
+            undo.Header.emplace();
+            CopyHeader(blueprint, *undo.Header);
+
+            const AbilityBlueprint& header = patch.Header;
+            if (patch.Fields & FieldVersion) blueprint.Version = header.Version;
+            if (patch.Fields & FieldName) blueprint.Name = header.Name;
+            if (patch.Fields & FieldDescription) blueprint.Description = header.Description;
+            if (patch.Fields & FieldIconPath) blueprint.IconPath = header.IconPath;
+            if (patch.Fields & FieldBaseCooldown) blueprint.BaseCooldown = header.BaseCooldown;
+            if (patch.Fields & FieldManaCost) blueprint.ManaCost = header.ManaCost;
+            if (patch.Fields & FieldCastTime) blueprint.CastTime = header.CastTime;
+            if (patch.Fields & FieldRange) blueprint.Range = header.Range;
+            if (patch.Fields & FieldMaxLevel) blueprint.MaxLevel = header.MaxLevel;
+            if (patch.Fields & FieldCooldownPerLevel) blueprint.CooldownPerLevel = header.CooldownPerLevel;
+            if (patch.Fields & FieldManaCostPerLevel) blueprint.ManaCostPerLevel = header.ManaCostPerLevel;
+            if (patch.Fields & FieldDamagePerLevel) blueprint.DamagePerLevel = header.DamagePerLevel;
+            if (patch.Fields & FieldRootId) ast.RootId = header.ScriptAST.RootId;
+        }
+
+        if (patch.Fields & FieldConnections)
+        {
+            undo.Connections = ast.Connections;
+
+            auto first = ast.Connections.begin() + patch.ConnectionPrefix;
+            first = ast.Connections.erase(first, first + patch.ConnectionsRemoved);
+            ast.Connections.insert(first, std::make_move_iterator(patch.ConnectionsAdded.begin()),
+                                   std::make_move_iterator(patch.ConnectionsAdded.end()));
+        }
+
+        for (const UUID& id : patch.Removed)
+        {
+            auto it = ast.Nodes.find(id);
+            if (it == ast.Nodes.end())
+            {
+                // Listed twice in the patch
+                Rollback(blueprint, undo);
+                return fail("Removed node does not exist");
+            }
+            undo.Removed.push_back(std::move(it->second));
+            ast.Nodes.erase(it);
+        }
+
+        for (ASTNode& node : patch.Added)
+        {
+            const UUID id = node.Id;
+            if (!ast.Nodes.emplace(id, std::move(node)).second)
+            {
+                // Listed twice in the patch
+                Rollback(blueprint, undo);
+                return fail("Added node already exists");
+            }
+            undo.Added.push_back(id);
+        }
+
+        // Re-sorts the hash tree but keeps the leaves of untouched nodes
+        for (const ASTNode& node : undo.Removed)
+        {
+            ast.MarkNodeDirty(node.Id);
+        }
+        for (const UUID& id : undo.Added)
+        {
+            ast.MarkNodeDirty(id);
+        }
+
+        for (NodeChange& change : patch.Modified)
+        {
+            ASTNode* node = ast.EditNode(change.Id);
+            if (!node)
+            {
+                // Also removed by this patch
+                Rollback(blueprint, undo);
+                return fail("Modified node does not exist");
+            }
+            undo.Modified.push_back(*node);
+
+            if (change.Fields & NodeTypeId) node->TypeId = std::move(change.TypeId);
+            if (change.Fields & NodeNext) node->NextBlockId = change.NextBlockId;
+            if (change.Fields & NodeParent) node->ParentId = change.ParentId;
+            if (change.Fields & NodeChildren) node->Children = std::move(change.Children);
+            if (change.Fields & NodeProperties)
+            {
+                for (const std::string& key : change.RemovedKeys)
+                {
+                    node->Properties.erase(key);
+                }
+                for (auto& [key, value] : change.SetProperties)
+                {
+                    node->Properties.insert_or_assign(std::move(key), std::move(value));
+                }
+            }
+        }
+
+        if (BlueprintSerializer::ComputeChecksumUncached(blueprint) != patch.TargetChecksum)
+        {
+            Rollback(blueprint, undo);
+            return fail("Checksum mismatch after applying the patch");
+        }
+        return true;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "AbilityBlueprint.h"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace RiftSpire
+{
+    class BinaryWriter;
+
+    //=========================================================================
+    // BlueprintDelta - Patch between two versions of a blueprint
+    //=========================================================================
+
+    /// Only what changed is written: header fields by bitmask, nodes added or
+    /// removed whole, and for modified nodes (keyed by UUID) just the changed
+    /// fields and properties. Counts and masks are varints. The patch carries
+    /// the checksums of both versions; Apply() refuses a blueprint that is not
+    /// the base version and verifies the result.
+    class BlueprintDelta
+    {
+    public:
+        static constexpr uint32_t MAGIC = 0x44415352;   // "RSAD"
+        static constexpr uint32_t VERSION = 1;
+
+        /// Patch that turns `from` into `to` (versions of the same blueprint)
+        static std::vector<uint8_t> Create(const AbilityBlueprint& from, const AbilityBlueprint& to);
+        static void Create(const AbilityBlueprint& from, const AbilityBlueprint& to, BinaryWriter& writer);
+
+        /// Apply in place. The patch is fully decoded and validated first; if
+        /// anything fails, including the final checksum, the blueprint is left
+        /// as it was. Unchanged nodes keep their cached hashes.
+        static bool Apply(AbilityBlueprint& blueprint, std::span<const uint8_t> patch, std::string* error = nullptr);
+    };
+}
@@ -0,0 +1,180 @@
+#include "BlueprintPack.h"
+#include "BinaryCodec.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace RiftSpire
+{
+    using namespace BlueprintPackFormat;
+
+    static bool SetError(std::string* error, const char* message)
+    {
+        if (error) *error = message;
+        return false;
+    }
+
+    static bool IdLess(const IndexEntry& a, const IndexEntry& b)
+    {
+        return a.IdHigh != b.IdHigh ? a.IdHigh < b.IdHigh : a.IdLow < b.IdLow;
+    }
+
+    //=========================================================================
+    // Writing
+    //=========================================================================
+
+    bool BlueprintPack::Write(const std::string& path, std::span<const AbilityBlueprint* const> blueprints,
+                              std::string* error)
+    {
+        std::vector<const AbilityBlueprint*> sorted(blueprints.begin(), blueprints.end());
+        std::sort(sorted.begin(), sorted.end(),
+            [](const AbilityBlueprint* a, const AbilityBlueprint* b) { return a->Id < b->Id; });
+
+        for (size_t i = 1; i < sorted.size(); ++i)
+        {
+            if (sorted[i - 1]->Id == sorted[i]->Id) return SetError(error, "Duplicate blueprint id");
+        }
+
+        // Payloads first, so the index can record offsets and sizes
+        BinaryWriter data;
+        std::vector<IndexEntry> entries(sorted.size());
+        for (size_t i = 0; i < sorted.size(); ++i)
+        {
+            const AbilityBlueprint& blueprint = *sorted[i];
+            IndexEntry& entry = entries[i];
+
+            entry.IdHigh = blueprint.Id.GetHigh();
+            entry.IdLow = blueprint.Id.GetLow();
+            entry.NameHash = HashName(blueprint.Name);
+            entry.Offset = data.GetSize();
+            BlueprintSerializer::SerializeTo(blueprint, data);
+            entry.Size = data.GetSize() - entry.Offset;
+            entry.Checksum = BlueprintSerializer::ComputeChecksumUncached(blueprint);
+        }
+
+        Header header{};
+        header.Magic = Magic;
+        header.Version = Version;
+        header.EntryCount = static_cast<u32>(entries.size());
+        header.IndexOffset = sizeof(Header);
+        header.DataOffset = header.IndexOffset + entries.size() * sizeof(IndexEntry);
+        header.DataSize = data.GetSize();
+
+        std::ofstream file(path, std::ios::binary);
+        if (!file.is_open()) return SetError(error, "Cannot open file for writing");
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(IndexEntry)));
+        file.write(reinterpret_cast<const char*>(data.GetData()), static_cast<std::streamsize>(data.GetSize()));
+        file.close();
+
+        if (!file) return SetError(error, "Write failed");
+        return true;
+    }
+
+    //=========================================================================
+    // Reading
+    //=========================================================================
+
+    std::unique_ptr<BlueprintPack> BlueprintPack::Open(const std::string& path, std::string* error)
+    {
+        auto file = MappedFile::Open(path);
+        if (!file)
+        {
+            SetError(error, "Cannot open file");
+            return nullptr;
+        }
+
+        const std::span<const u8> bytes = file->GetBytes();
+
+        Header header;
+        if (bytes.size() < sizeof(Header))
+        {
+            SetError(error, "File too small");
+            return nullptr;
+        }
+        std::memcpy(&header, bytes.data(), sizeof(Header));
+
+        if (header.Magic != Magic)
+        {
+            SetError(error, "Not a blueprint pack");
+            return nullptr;
+        }
+        if (header.Version != Version)
+        {
+            SetError(error, "Unsupported pack version");
+            return nullptr;
+        }
+
+        const size_t size = bytes.size();
+        const u8* index = bytes.data() + (header.IndexOffset <= size ? header.IndexOffset : 0);
+        if (header.IndexOffset > size ||
+            header.EntryCount > (size - header.IndexOffset) / sizeof(IndexEntry) ||
+            reinterpret_cast<std::uintptr_t>(index) % alignof(IndexEntry) != 0)
+        {
+            SetError(error, "Index out of bounds");
+            return nullptr;
+        }
+        if (header.DataOffset > size || header.DataSize > size - header.DataOffset)
+        {
+            SetError(error, "Data section out of bounds");
+            return nullptr;
+        }
+
+        std::unique_ptr<BlueprintPack> pack(new BlueprintPack());
+        pack->m_Entries = std::span<const IndexEntry>(reinterpret_cast<const IndexEntry*>(index), header.EntryCount);
+        pack->m_Data = bytes.subspan(static_cast<size_t>(header.DataOffset), static_cast<size_t>(header.DataSize));
+
+        pack->m_NameIndex.reserve(header.EntryCount);
+        for (size_t i = 0; i < pack->m_Entries.size(); ++i)
+        {
+            const IndexEntry& entry = pack->m_Entries[i];
+            if (entry.Offset > header.DataSize || entry.Size > header.DataSize - entry.Offset)
+            {
+                SetError(error, "Entry out of bounds");
+                return nullptr;
+            }
+            if (i > 0 && !IdLess(pack->m_Entries[i - 1], entry))
+            {
+                SetError(error, "Index not sorted");
+                return nullptr;
+            }
+            pack->m_NameIndex.emplace_back(entry.NameHash, static_cast<u32>(i));
+        }
+        std::sort(pack->m_NameIndex.begin(), pack->m_NameIndex.end());
+
+        pack->m_File = std::move(file);
+        return pack;
+    }
+
+    size_t BlueprintPack::Find(const UUID& id) const
+    {
+        IndexEntry key{};
+        key.IdHigh = id.GetHigh();
+        key.IdLow = id.GetLow();
+
+        auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), key, IdLess);
+        if (it == m_Entries.end() || it->IdHigh != key.IdHigh || it->IdLow != key.IdLow)
+        {
+            return InvalidEntry;
+        }
+        return static_cast<size_t>(it - m_Entries.begin());
+    }
+
+    bool BlueprintPack::Decode(size_t index, AbilityBlueprint& outBlueprint, std::string* error) const
+    {
+        if (index >= m_Entries.size()) return SetError(error, "Entry index out of range");
+
+        const IndexEntry& entry = m_Entries[index];
+        const auto bytes = m_Data.subspan(static_cast<size_t>(entry.Offset), static_cast<size_t>(entry.Size));
+
+        AbilityBlueprint blueprint;
+        if (!BlueprintSerializer::DeserializeFromBytes(bytes, blueprint, error)) return false;
+
+        if (blueprint.Id != GetId(index)) return SetError(error, "Id does not match the index");
+        if (BlueprintSerializer::ComputeChecksumUncached(blueprint) != entry.Checksum) return SetError(error, "Checksum mismatch");
+
+        outBlueprint = std::move(blueprint);
+        return true;
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include "AbilityBlueprint.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // BlueprintPackFormat - On-disk layout of .rsabpack archives
+    //=========================================================================
+
+    /// Header, an index sorted by blueprint id, then each blueprint's
+    /// BlueprintSerializer bytes back to back. Header and index are read in
+    /// place from the mapping, so the layout is little-endian only.
+    namespace BlueprintPackFormat
+    {
+        static_assert(std::endian::native == std::endian::little, "BlueprintPack reads its index in place");
+
+        static constexpr u32 Magic = 0x50415352;        // "RSAP"
+        static constexpr u32 Version = 1;
+
+        struct Header
+        {
+            u32 Magic;
+            u32 Version;
+            u32 EntryCount;
+            u32 Reserved;
+            u64 IndexOffset;
+            u64 DataOffset;
+            u64 DataSize;
+        };
+
+        struct IndexEntry
+        {
+            u64 IdHigh;
+            u64 IdLow;
+            u64 NameHash;           // HashName(Name)
+            u64 Offset;             // Relative to DataOffset
+            u64 Size;
+            u64 Checksum;           // BlueprintSerializer::ComputeChecksum
+        };
+
+        static_assert(sizeof(Header) == 40);
+        static_assert(sizeof(IndexEntry) == 48);
+
+        inline u64 HashName(std::string_view name)
+        {
+            return ContentHash::Compute(name.data(), name.size()).Low;
+        }
+    }
+
+    //=========================================================================
+    // BlueprintPack - Mapped archive with lazy per-entry decoding
+    //=========================================================================
+
+    /// Open() validates the header and index only (bounds, order, unique
+    /// ids); a blueprint is decoded and its checksum verified when Decode()
+    /// is called for it.
+    class BlueprintPack
+    {
+    public:
+        using Entry = BlueprintPackFormat::IndexEntry;
+
+        static constexpr size_t InvalidEntry = static_cast<size_t>(-1);
+
+        static std::unique_ptr<BlueprintPack> Open(const std::string& path, std::string* error = nullptr);
+
+        /// Write blueprints into a new pack (any order; the index is sorted)
+        static bool Write(const std::string& path, std::span<const AbilityBlueprint* const> blueprints,
+                          std::string* error = nullptr);
+
+        std::span<const Entry> GetEntries() const { return m_Entries; }
+        size_t GetEntryCount() const { return m_Entries.size(); }
+
+        UUID GetId(size_t index) const { return UUID(m_Entries[index].IdHigh, m_Entries[index].IdLow); }
+
+        /// Index of the entry with this id, or InvalidEntry
+        size_t Find(const UUID& id) const;
+
+        /// Calls fn(index) for every entry whose name hash matches; the name
+        /// itself is only known after decoding
+        template<typename Fn>
+        void ForEachNameMatch(std::string_view name, Fn&& fn) const
+        {
+            const u64 hash = BlueprintPackFormat::HashName(name);
+            auto it = std::lower_bound(m_NameIndex.begin(), m_NameIndex.end(), std::pair<u64, u32>(hash, 0));
+            for (; it != m_NameIndex.end() && it->first == hash; ++it)
+            {
+                fn(static_cast<size_t>(it->second));
+            }
+        }
+
+        /// Decode and verify one entry
+        bool Decode(size_t index, AbilityBlueprint& outBlueprint, std::string* error = nullptr) const;
+
+    private:
+        BlueprintPack() = default;
+
+        std::unique_ptr<MappedFile> m_File;
+        std::span<const Entry> m_Entries;
+        std::span<const u8> m_Data;
+        std::vector<std::pair<u64, u32>> m_NameIndex;   // (name hash, entry), sorted
+    };
+}
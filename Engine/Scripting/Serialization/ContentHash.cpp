@@ -0,0 +1,138 @@
+#include "ContentHash.h"
+#include "BinaryCodec.h"
+#include <bit>
+#include <cstring>
+
+namespace RiftSpire
+{
+    static constexpr u64 Prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr u64 Prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr u64 Prime3 = 0x165667B19E3779F9ULL;
+    static constexpr u64 Prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr u64 Prime5 = 0x27D4EB2F165667C5ULL;
+
+    // Seed for Combine(), so a parent never equals a leaf over the same 32 bytes
+    static constexpr u64 CombineSeed = 0x4D65726B6C654E64ULL;
+
+    static u64 Read64(const u8* p)
+    {
+        u64 value;
+        std::memcpy(&value, p, sizeof(value));
+        return BinaryCodec::ToLittleEndian(value);
+    }
+
+    static u32 Read32(const u8* p)
+    {
+        u32 value;
+        std::memcpy(&value, p, sizeof(value));
+        return BinaryCodec::ToLittleEndian(value);
+    }
+
+    static u64 Round(u64 acc, u64 input)
+    {
+        acc += input * Prime2;
+        acc = std::rotl(acc, 31);
+        return acc * Prime1;
+    }
+
+    static u64 MergeRound(u64 acc, u64 lane)
+    {
+        acc ^= Round(0, lane);
+        return acc * Prime1 + Prime4;
+    }
+
+    static u64 Avalanche(u64 h)
+    {
+        h ^= h >> 33;
+        h *= Prime2;
+        h ^= h >> 29;
+        h *= Prime3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    Hash128 ContentHash::Compute(const void* data, size_t size, u64 seed)
+    {
+        const u8* p = static_cast<const u8*>(data);
+        const u8* const end = p + size;
+
+        u64 low, high;
+
+        if (size >= 32)
+        {
+            u64 v1 = seed + Prime1 + Prime2;
+            u64 v2 = seed + Prime2;
+            u64 v3 = seed;
+            u64 v4 = seed - Prime1;
+
+            // Lanes are independent, so the four multiplies overlap
+            const u8* const limit = end - 32;
+            do
+            {
+                v1 = Round(v1, Read64(p));
+                v2 = Round(v2, Read64(p + 8));
+                v3 = Round(v3, Read64(p + 16));
+                v4 = Round(v4, Read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            low = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+            low = MergeRound(MergeRound(MergeRound(MergeRound(low, v1), v2), v3), v4);
+
+            // Same lanes, different rotations and merge order
+            high = std::rotl(v1, 19) + std::rotl(v2, 5) + std::rotl(v3, 29) + std::rotl(v4, 41);
+            high = MergeRound(MergeRound(MergeRound(MergeRound(high, v4), v3), v2), v1);
+        }
+        else
+        {
+            low = seed + Prime5;
+            high = (seed ^ Prime3) + Prime4;
+        }
+
+        low += size;
+        high += size * Prime5;
+
+        // Tail: up to 31 bytes
+        for (; p + 8 <= end; p += 8)
+        {
+            const u64 word = Read64(p);
+            low ^= Round(0, word);
+            low = std::rotl(low, 27) * Prime1 + Prime4;
+            high ^= Round(0, word ^ Prime3);
+            high = std::rotl(high, 31) * Prime2 + Prime5;
+        }
+
+        if (p + 4 <= end)
+        {
+            const u64 word = Read32(p);
+            low ^= word * Prime1;
+            low = std::rotl(low, 23) * Prime2 + Prime3;
+            high ^= word * Prime4;
+            high = std::rotl(high, 29) * Prime1 + Prime2;
+            p += 4;
+        }
+
+        for (; p < end; ++p)
+        {
+            low ^= *p * Prime5;
+            low = std::rotl(low, 11) * Prime1;
+            high ^= *p * Prime3;
+            high = std::rotl(high, 13) * Prime2;
+        }
+
+        low = Avalanche(low);
+        high = Avalanche(high ^ low);
+        return { low, high };
+    }
+
+    Hash128 ContentHash::Combine(const Hash128& left, const Hash128& right)
+    {
+        u8 bytes[32];
+        const u64 words[4] = {
+            BinaryCodec::ToLittleEndian(left.Low), BinaryCodec::ToLittleEndian(left.High),
+            BinaryCodec::ToLittleEndian(right.Low), BinaryCodec::ToLittleEndian(right.High)
+        };
+        std::memcpy(bytes, words, sizeof(bytes));
+        return Compute(bytes, sizeof(bytes), CombineSeed);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include "../Core/Value.h"
+#include <span>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // ContentHash - Fast non-cryptographic 128-bit hash
+    //=========================================================================
+
+    struct Hash128
+    {
+        u64 Low = 0;
+        u64 High = 0;
+
+        bool operator==(const Hash128& other) const = default;
+    };
+
+    /// Four independent 64-bit multiply/rotate lanes over 32-byte stripes
+    /// (the xxHash64 round), finished into two differently mixed halves.
+    /// Input words are read as little-endian, so a hash depends only on the
+    /// bytes and is the same on every platform; feed it canonical encodings
+    /// (e.g. BinaryWriter output), not in-memory structs.
+    namespace ContentHash
+    {
+        Hash128 Compute(const void* data, size_t size, u64 seed = 0);
+
+        inline Hash128 Compute(std::span<const u8> bytes, u64 seed = 0)
+        {
+            return Compute(bytes.data(), bytes.size(), seed);
+        }
+
+        /// Order-dependent combination of two hashes (Merkle tree parent)
+        Hash128 Combine(const Hash128& left, const Hash128& right);
+    }
+}
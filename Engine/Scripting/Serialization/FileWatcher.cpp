@@ -0,0 +1,112 @@
+#include "FileWatcher.h"
+#include <algorithm>
+
+#ifdef __linux__
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+namespace RiftSpire
+{
+#ifdef __linux__
+    FileWatcher::FileWatcher()
+    {
+        m_Handle = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        if (m_Handle >= 0) ::close(m_Handle);
+    }
+
+    bool FileWatcher::AddDirectory(const std::string& directory)
+    {
+        if (m_Handle < 0) return false;
+
+        const int watch = ::inotify_add_watch(m_Handle, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_ONLYDIR);
+        if (watch < 0) return false;
+
+        std::string& path = m_Directories[watch];
+        path = directory;
+        if (!path.empty() && path.back() != '/') path += '/';
+        return true;
+    }
+
+    void FileWatcher::ReadEvents(Clock::time_point now)
+    {
+        // One read returns as many whole events as fit
+        alignas(inotify_event) char buffer[16 * 1024];
+
+        for (;;)
+        {
+            const ssize_t length = ::read(m_Handle, buffer, sizeof(buffer));
+            if (length <= 0) break;  // EAGAIN: queue drained
+
+            for (ssize_t offset = 0; offset < length;)
+            {
+                const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+                if (event->mask & IN_IGNORED)
+                {
+                    m_Directories.erase(event->wd);
+                    continue;
+                }
+                if (event->len == 0 || (event->mask & IN_ISDIR)) continue;
+
+                auto directory = m_Directories.find(event->wd);
+                if (directory == m_Directories.end()) continue;
+
+                auto [it, inserted] = m_Pending.try_emplace(directory->second + event->name);
+                if (inserted) it->second.First = now;
+                it->second.Last = now;
+            }
+        }
+    }
+#else
+    FileWatcher::FileWatcher() = default;
+    FileWatcher::~FileWatcher() = default;
+
+    bool FileWatcher::AddDirectory(const std::string&)
+    {
+        return false;
+    }
+
+    void FileWatcher::ReadEvents(Clock::time_point)
+    {
+    }
+#endif
+
+    std::vector<std::string> FileWatcher::Poll()
+    {
+        std::vector<std::string> changed;
+        m_Reported.clear();
+        if (m_Handle < 0) return changed;
+
+        const Clock::time_point now = Clock::now();
+        ReadEvents(now);
+
+        for (auto it = m_Pending.begin(); it != m_Pending.end();)
+        {
+            if (now - it->second.Last < m_SettleTime)
+            {
+                ++it;
+                continue;
+            }
+
+            changed.push_back(it->first);
+            m_Reported.emplace(it->first, it->second.First);
+            it = m_Pending.erase(it);
+        }
+
+        std::sort(changed.begin(), changed.end());
+        return changed;
+    }
+
+    FileWatcher::Clock::time_point FileWatcher::GetFirstEventTime(const std::string& path) const
+    {
+        auto it = m_Reported.find(path);
+        return it != m_Reported.end() ? it->second : Clock::time_point{};
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // FileWatcher - Batched change notifications for watched directories
+    //=========================================================================
+
+    /// Non-blocking: Poll() drains whatever the OS queued since the last call
+    /// and returns each changed file once. Only completed writes are reported
+    /// (close after write, or a file renamed into the directory), so an
+    /// editor's save-to-temp-then-rename shows up as a single change.
+    /// Backed by inotify on Linux; elsewhere IsValid() is false and Poll()
+    /// never reports anything.
+    class FileWatcher
+    {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        FileWatcher();
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        bool IsValid() const { return m_Handle >= 0; }
+
+        /// Watch the files directly inside a directory (not recursive)
+        bool AddDirectory(const std::string& directory);
+
+        /// A path is held back until it has been quiet this long, so a file
+        /// written several times in a row is reported once. Zero reports
+        /// everything on the next Poll().
+        void SetSettleTime(Clock::duration settle) { m_SettleTime = settle; }
+
+        /// Changed paths whose settle time has passed, sorted and unique
+        std::vector<std::string> Poll();
+
+        /// When a path returned by the last Poll() was first seen changing
+        /// (events are timestamped as they are drained, not as written)
+        Clock::time_point GetFirstEventTime(const std::string& path) const;
+
+    private:
+        struct PendingChange
+        {
+            Clock::time_point First;
+            Clock::time_point Last;
+        };
+
+        void ReadEvents(Clock::time_point now);
+
+        int m_Handle = -1;
+        Clock::duration m_SettleTime = Clock::duration::zero();
+
+        std::unordered_map<int, std::string> m_Directories;    // Watch descriptor -> directory
+        std::unordered_map<std::string, PendingChange> m_Pending;
+        std::unordered_map<std::string, Clock::time_point> m_Reported;
+    };
+}
@@ -0,0 +1,410 @@
+#include "JsonReader.h"
+#include <charconv>
+#include <cmath>
+
+namespace RiftSpire
+{
+    JsonReader::JsonReader(std::string_view text)
+        : m_Begin(text.data())
+        , m_Pos(text.data())
+        , m_End(text.data() + text.size())
+    {
+        m_First.reserve(32);
+    }
+
+    bool JsonReader::Fail(const char* message)
+    {
+        if (!m_Error) m_Error = message;
+        m_Pos = m_End;
+        return false;
+    }
+
+    bool JsonReader::Expect(char c)
+    {
+        if (m_Pos < m_End && *m_Pos == c)
+        {
+            ++m_Pos;
+            return true;
+        }
+        return Fail("Unexpected character");
+    }
+
+    bool JsonReader::Push()
+    {
+        if (m_First.size() >= MaxDepth) return Fail("Nesting too deep");
+        m_First.push_back(1);
+        return true;
+    }
+
+    //=========================================================================
+    // Structure
+    //=========================================================================
+
+    bool JsonReader::BeginObject()
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+        return Expect('{') && Push();
+    }
+
+    bool JsonReader::BeginArray()
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+        return Expect('[') && Push();
+    }
+
+    bool JsonReader::NextKey(std::string_view& key)
+    {
+        if (m_Error) return false;
+        if (m_First.empty()) return Fail("Key outside of an object");
+
+        SkipWhitespace();
+        if (m_Pos < m_End && *m_Pos == '}')
+        {
+            ++m_Pos;
+            m_First.pop_back();
+            return false;
+        }
+
+        if (!m_First.back())
+        {
+            if (!Expect(',')) return false;
+            SkipWhitespace();
+        }
+        m_First.back() = 0;
+
+        if (!ParseString(key)) return false;
+
+        SkipWhitespace();
+        return Expect(':');
+    }
+
+    bool JsonReader::NextElement()
+    {
+        if (m_Error) return false;
+        if (m_First.empty()) return Fail("Element outside of an array");
+
+        SkipWhitespace();
+        if (m_Pos < m_End && *m_Pos == ']')
+        {
+            ++m_Pos;
+            m_First.pop_back();
+            return false;
+        }
+
+        if (!m_First.back())
+        {
+            if (!Expect(',')) return false;
+        }
+        m_First.back() = 0;
+        return true;
+    }
+
+    JsonValueKind JsonReader::PeekValue()
+    {
+        if (m_Error) return JsonValueKind::Invalid;
+
+        SkipWhitespace();
+        if (m_Pos >= m_End) return JsonValueKind::Invalid;
+
+        switch (*m_Pos)
+        {
+            case '{': return JsonValueKind::Object;
+            case '[': return JsonValueKind::Array;
+            case '"': return JsonValueKind::String;
+            case 't':
+            case 'f': return JsonValueKind::Bool;
+            case 'n':
+                // "nan" is accepted as a number (ToJson writes non-finite floats as-is)
+                return (m_End - m_Pos >= 4 && std::string_view(m_Pos, 4) == "null")
+                    ? JsonValueKind::Null : JsonValueKind::Number;
+            case '-':
+            case 'i': return JsonValueKind::Number;
+            default:
+                return (*m_Pos >= '0' && *m_Pos <= '9') ? JsonValueKind::Number : JsonValueKind::Invalid;
+        }
+    }
+
+    bool JsonReader::SkipValue()
+    {
+        switch (PeekValue())
+        {
+            case JsonValueKind::Object:
+            {
+                if (!BeginObject()) return false;
+                std::string_view key;
+                while (NextKey(key))
+                {
+                    if (!SkipValue()) return false;
+                }
+                return !m_Error;
+            }
+            case JsonValueKind::Array:
+            {
+                if (!BeginArray()) return false;
+                while (NextElement())
+                {
+                    if (!SkipValue()) return false;
+                }
+                return !m_Error;
+            }
+            case JsonValueKind::String:
+            {
+                std::string_view value;
+                return ParseString(value);
+            }
+            case JsonValueKind::Number:
+            {
+                f64 value;
+                return ReadFloat(value);
+            }
+            case JsonValueKind::Bool:
+            {
+                bool value;
+                return ReadBool(value);
+            }
+            case JsonValueKind::Null:
+                return ReadNull();
+            default:
+                return Fail("Expected a value");
+        }
+    }
+
+    bool JsonReader::IsAtEnd()
+    {
+        SkipWhitespace();
+        return !m_Error && m_Pos == m_End && m_First.empty();
+    }
+
+    //=========================================================================
+    // Strings
+    //=========================================================================
+
+    bool JsonReader::ReadString(std::string_view& value)
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+        return ParseString(value);
+    }
+
+    bool JsonReader::ParseString(std::string_view& value)
+    {
+        if (!Expect('"')) return false;
+
+        const char* start = m_Pos;
+        while (m_Pos < m_End && *m_Pos != '"' && *m_Pos != '\\')
+        {
+            ++m_Pos;
+        }
+
+        if (m_Pos >= m_End) return Fail("Unterminated string");
+
+        if (*m_Pos == '"')
+        {
+            value = std::string_view(start, static_cast<size_t>(m_Pos - start));
+            ++m_Pos;
+            return true;
+        }
+
+        if (!DecodeEscapes(start)) return false;
+        value = m_Scratch;
+        return true;
+    }
+
+    static int HexDigit(char c)
+    {
+        if (c >= '0' && c <= '9') return c - '0';
+        if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+        if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+        return -1;
+    }
+
+    static void AppendUtf8(std::string& out, u32 codepoint)
+    {
+        if (codepoint < 0x80)
+        {
+            out += static_cast<char>(codepoint);
+        }
+        else if (codepoint < 0x800)
+        {
+            out += static_cast<char>(0xC0 | (codepoint >> 6));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else if (codepoint < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | (codepoint >> 12));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | (codepoint >> 18));
+            out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+
+    bool JsonReader::DecodeEscapes(const char* start)
+    {
+        // m_Pos is at the first backslash; everything before it is literal
+        m_Scratch.assign(start, m_Pos);
+
+        auto readHex4 = [this](u32& out) -> bool
+        {
+            if (m_End - m_Pos < 4) return false;
+            out = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                const int digit = HexDigit(m_Pos[i]);
+                if (digit < 0) return false;
+                out = (out << 4) | static_cast<u32>(digit);
+            }
+            m_Pos += 4;
+            return true;
+        };
+
+        while (m_Pos < m_End)
+        {
+            const char c = *m_Pos++;
+            if (c == '"') return true;
+
+            if (c != '\\')
+            {
+                m_Scratch += c;
+                continue;
+            }
+
+            if (m_Pos >= m_End) break;
+
+            switch (*m_Pos++)
+            {
+                case '"':  m_Scratch += '"'; break;
+                case '\\': m_Scratch += '\\'; break;
+                case '/':  m_Scratch += '/'; break;
+                case 'b':  m_Scratch += '\b'; break;
+                case 'f':  m_Scratch += '\f'; break;
+                case 'n':  m_Scratch += '\n'; break;
+                case 'r':  m_Scratch += '\r'; break;
+                case 't':  m_Scratch += '\t'; break;
+                case 'u':
+                {
+                    u32 codepoint;
+                    if (!readHex4(codepoint)) return Fail("Invalid unicode escape");
+
+                    if (codepoint >= 0xD800 && codepoint <= 0xDBFF)
+                    {
+                        // High surrogate, combine with the following low surrogate
+                        u32 low = 0;
+                        if (m_End - m_Pos >= 2 && m_Pos[0] == '\\' && m_Pos[1] == 'u')
+                        {
+                            m_Pos += 2;
+                            if (!readHex4(low)) return Fail("Invalid unicode escape");
+                        }
+
+                        codepoint = (low >= 0xDC00 && low <= 0xDFFF)
+                            ? 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00)
+                            : 0xFFFD;
+                    }
+                    else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF)
+                    {
+                        codepoint = 0xFFFD;  // Lone low surrogate
+                    }
+
+                    AppendUtf8(m_Scratch, codepoint);
+                    break;
+                }
+                default:
+                    return Fail("Invalid escape sequence");
+            }
+        }
+
+        return Fail("Unterminated string");
+    }
+
+    //=========================================================================
+    // Scalars
+    //=========================================================================
+
+    std::string_view JsonReader::NumberText()
+    {
+        const char* start = m_Pos;
+        const char* p = m_Pos;
+        while (p < m_End)
+        {
+            const char c = *p;
+            if ((c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E')
+            {
+                ++p;
+                continue;
+            }
+            break;
+        }
+        return std::string_view(start, static_cast<size_t>(p - start));
+    }
+
+    bool JsonReader::ReadInt(i64& value)
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+
+        const std::string_view text = NumberText();
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (ec == std::errc() && ptr == text.data() + text.size() && !text.empty())
+        {
+            m_Pos = ptr;
+            return true;
+        }
+
+        // Written as a float (e.g. "3.0"): accept integral values in range
+        f64 number;
+        if (!ReadFloat(number)) return false;
+        if (!(number >= -9.2233720368547758e18 && number < 9.2233720368547758e18) || std::trunc(number) != number)
+        {
+            return Fail("Expected an integer");
+        }
+
+        value = static_cast<i64>(number);
+        return true;
+    }
+
+    bool JsonReader::ReadFloat(f64& value)
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+
+        auto [ptr, ec] = std::from_chars(m_Pos, m_End, value);
+        if (ec != std::errc() || ptr == m_Pos) return Fail("Expected a number");
+
+        m_Pos = ptr;
+        return true;
+    }
+
+    bool JsonReader::MatchWord(std::string_view word)
+    {
+        if (static_cast<size_t>(m_End - m_Pos) >= word.size() && std::string_view(m_Pos, word.size()) == word)
+        {
+            m_Pos += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    bool JsonReader::ReadBool(bool& value)
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+
+        if (MatchWord("true")) { value = true; return true; }
+        if (MatchWord("false")) { value = false; return true; }
+        return Fail("Expected a boolean");
+    }
+
+    bool JsonReader::ReadNull()
+    {
+        if (m_Error) return false;
+        SkipWhitespace();
+        return MatchWord("null") || Fail("Expected null");
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include "../Core/Value.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // JsonReader - Pull parser over an in-memory JSON document
+    //=========================================================================
+
+    enum class JsonValueKind : u8
+    {
+        Object,
+        Array,
+        String,
+        Number,
+        Bool,
+        Null,
+        Invalid
+    };
+
+    /// Reads JSON token by token without building a DOM. Strings without
+    /// escapes are returned as views into the input; escaped strings are
+    /// decoded into a scratch buffer that is reused, so a returned view is
+    /// only valid until the next read. Numbers go through std::from_chars.
+    ///
+    /// Usage:
+    ///     reader.BeginObject();
+    ///     std::string_view key;
+    ///     while (reader.NextKey(key)) { ... read or SkipValue() ... }
+    ///
+    /// Every Read/Begin/Next call returns false on malformed input; after
+    /// the first failure the reader stays failed.
+    class JsonReader
+    {
+    public:
+        /// Guards recursion in callers and in SkipValue()
+        static constexpr u32 MaxDepth = 256;
+
+        explicit JsonReader(std::string_view text);
+
+        //---------------------------------------------------------------------
+        // Structure
+        //---------------------------------------------------------------------
+
+        bool BeginObject();
+        bool BeginArray();
+
+        /// Next key of the current object; false at '}' (consumed) or on error
+        bool NextKey(std::string_view& key);
+
+        /// True if the current array has another element; false at ']' (consumed) or on error
+        bool NextElement();
+
+        /// Kind of the value at the read position (does not consume it)
+        JsonValueKind PeekValue();
+
+        /// Skip one complete value of any kind
+        bool SkipValue();
+
+        //---------------------------------------------------------------------
+        // Values
+        //---------------------------------------------------------------------
+
+        bool ReadString(std::string_view& value);
+        bool ReadInt(i64& value);
+        bool ReadFloat(f64& value);
+        bool ReadBool(bool& value);
+        bool ReadNull();
+
+        //---------------------------------------------------------------------
+        // State
+        //---------------------------------------------------------------------
+
+        bool HasError() const { return m_Error != nullptr; }
+        const char* GetError() const { return m_Error; }
+        size_t GetOffset() const { return static_cast<size_t>(m_Pos - m_Begin); }
+        u32 GetDepth() const { return static_cast<u32>(m_First.size()); }
+
+        /// True once the whole document was consumed (trailing whitespace allowed)
+        bool IsAtEnd();
+
+    private:
+        void SkipWhitespace()
+        {
+            while (m_Pos < m_End && (*m_Pos == ' ' || *m_Pos == '\n' || *m_Pos == '\r' || *m_Pos == '\t'))
+            {
+                ++m_Pos;
+            }
+        }
+
+        bool Fail(const char* message);
+        bool Expect(char c);
+        bool Push();
+        bool ParseString(std::string_view& value);
+        bool DecodeEscapes(const char* start);
+        bool MatchWord(std::string_view word);
+        std::string_view NumberText();
+
+        const char* m_Begin;
+        const char* m_Pos;
+        const char* m_End;
+        const char* m_Error = nullptr;
+
+        std::vector<u8> m_First;        // Per open container: no element read yet
+        std::string m_Scratch;          // Decoded escaped strings
+    };
+}
@@ -0,0 +1,305 @@
+#include "JsonWriter.h"
+#include <charconv>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <emmintrin.h>
+    #define RS_JSON_SSE2 1
+#endif
+
+#ifdef _WIN32
+    #include <io.h>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // Platform file helpers
+    //=========================================================================
+
+    static int OpenForWrite(const std::string& path)
+    {
+#ifdef _WIN32
+        int fd = -1;
+        _sopen_s(&fd, path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _SH_DENYWR, _S_IREAD | _S_IWRITE);
+        return fd;
+#else
+        return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+    }
+
+    static bool WriteAll(int fd, const char* data, size_t size)
+    {
+        while (size > 0)
+        {
+#ifdef _WIN32
+            const unsigned int chunk = size > 0x40000000 ? 0x40000000u : static_cast<unsigned int>(size);
+            const int written = _write(fd, data, chunk);
+#else
+            const ssize_t written = ::write(fd, data, size);
+#endif
+            if (written <= 0) return false;
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+        return true;
+    }
+
+    static bool CloseFile(int fd)
+    {
+#ifdef _WIN32
+        return _close(fd) == 0;
+#else
+        return ::close(fd) == 0;
+#endif
+    }
+
+    //=========================================================================
+    // Escape scan
+    //=========================================================================
+
+    static bool NeedsEscape(unsigned char c)
+    {
+        return c == '"' || c == '\\' || c < 0x20;
+    }
+
+    /// Index of the first byte that must be escaped, or text.size()
+    static size_t FindEscape(std::string_view text)
+    {
+        const char* data = text.data();
+        const size_t size = text.size();
+        size_t i = 0;
+
+#ifdef RS_JSON_SSE2
+        // 16 bytes per step: quote, backslash, or control (min(c, 0x1F) == c)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1F);
+
+        for (; i + 16 <= size; i += 16)
+        {
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i hits = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                _mm_cmpeq_epi8(_mm_min_epu8(chunk, control), chunk));
+
+            const int mask = _mm_movemask_epi8(hits);
+            if (mask != 0)
+            {
+#if defined(_MSC_VER) && !defined(__clang__)
+                unsigned long bit;
+                _BitScanForward(&bit, static_cast<unsigned long>(mask));
+                return i + bit;
+#else
+                return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(mask)));
+#endif
+            }
+        }
+#endif
+
+        for (; i < size; ++i)
+        {
+            if (NeedsEscape(static_cast<unsigned char>(data[i]))) return i;
+        }
+        return size;
+    }
+
+    //=========================================================================
+    // JsonWriter
+    //=========================================================================
+
+    JsonWriter::~JsonWriter()
+    {
+        if (m_File >= 0)
+        {
+            EndFile();
+        }
+    }
+
+    void JsonWriter::Reset(bool pretty)
+    {
+        m_Buffer.clear();
+        m_Indent = 0;
+        m_Pretty = pretty;
+        m_Empty = true;
+    }
+
+    void JsonWriter::BeginObject()
+    {
+        Append('{');
+        m_Indent++;
+        m_Empty = true;
+    }
+
+    void JsonWriter::EndObject()
+    {
+        m_Indent--;
+        if (!m_Empty) NewLine();
+        Append('}');
+        m_Empty = false;
+    }
+
+    void JsonWriter::BeginArray()
+    {
+        Append('[');
+        m_Indent++;
+        m_Empty = true;
+    }
+
+    void JsonWriter::EndArray()
+    {
+        m_Indent--;
+        if (!m_Empty) NewLine();
+        Append(']');
+        m_Empty = false;
+    }
+
+    void JsonWriter::Key(std::string_view key)
+    {
+        if (!m_Empty) Append(',');
+        NewLine();
+        AppendEscaped(key);
+        Append(m_Pretty ? std::string_view(": ") : std::string_view(":"));
+        m_Empty = false;
+    }
+
+    void JsonWriter::ArrayItem()
+    {
+        if (!m_Empty) Append(',');
+        NewLine();
+        m_Empty = false;
+    }
+
+    void JsonWriter::NewLine()
+    {
+        if (!m_Pretty) return;
+
+        static constexpr char Spaces[] = "                                                                ";
+        static constexpr size_t MaxSpaces = sizeof(Spaces) - 1;
+
+        Append('\n');
+        size_t remaining = static_cast<size_t>(m_Indent > 0 ? m_Indent : 0) * 2;
+        while (remaining > 0)
+        {
+            const size_t count = remaining < MaxSpaces ? remaining : MaxSpaces;
+            Append(std::string_view(Spaces, count));
+            remaining -= count;
+        }
+    }
+
+    void JsonWriter::WriteString(std::string_view value)
+    {
+        AppendEscaped(value);
+    }
+
+    void JsonWriter::AppendEscaped(std::string_view text)
+    {
+        static constexpr char Hex[] = "0123456789abcdef";
+
+        Append('"');
+
+        while (!text.empty())
+        {
+            // Copy the clean run in one piece
+            const size_t run = FindEscape(text);
+            Append(text.substr(0, run));
+            if (run == text.size()) break;
+
+            const unsigned char c = static_cast<unsigned char>(text[run]);
+            switch (c)
+            {
+                case '"':  Append("\\\""); break;
+                case '\\': Append("\\\\"); break;
+                case '\n': Append("\\n"); break;
+                case '\r': Append("\\r"); break;
+                case '\t': Append("\\t"); break;
+                case '\b': Append("\\b"); break;
+                case '\f': Append("\\f"); break;
+                default:
+                {
+                    const char escape[6] = { '\\', 'u', '0', '0', Hex[c >> 4], Hex[c & 0xF] };
+                    Append(std::string_view(escape, sizeof(escape)));
+                    break;
+                }
+            }
+
+            text.remove_prefix(run + 1);
+        }
+
+        Append('"');
+    }
+
+    void JsonWriter::WriteInt(i64 value)
+    {
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        Append(std::string_view(digits, static_cast<size_t>(result.ptr - digits)));
+    }
+
+    void JsonWriter::WriteFloat(f64 value)
+    {
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        Append(std::string_view(digits, static_cast<size_t>(result.ptr - digits)));
+    }
+
+    void JsonWriter::WriteFloat(f32 value)
+    {
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        Append(std::string_view(digits, static_cast<size_t>(result.ptr - digits)));
+    }
+
+    void JsonWriter::WriteUuid(const UUID& id)
+    {
+        char text[UUID::StringLength + 2];
+        text[0] = '"';
+        id.ToChars(text + 1);
+        text[UUID::StringLength + 1] = '"';
+        Append(std::string_view(text, sizeof(text)));
+    }
+
+    //=========================================================================
+    // File streaming
+    //=========================================================================
+
+    bool JsonWriter::BeginFile(const std::string& path)
+    {
+        if (m_File >= 0) EndFile();
+
+        m_File = OpenForWrite(path);
+        m_FileError = m_File < 0;
+        if (m_FileError) return false;
+
+        // Anything written before the file was attached goes first
+        Flush();
+        return !m_FileError;
+    }
+
+    void JsonWriter::Flush()
+    {
+        if (m_File < 0 || m_Buffer.empty()) return;
+
+        if (!WriteAll(m_File, m_Buffer.data(), m_Buffer.size()))
+        {
+            m_FileError = true;
+        }
+        m_Buffer.clear();
+    }
+
+    bool JsonWriter::EndFile()
+    {
+        if (m_File < 0) return false;
+
+        Flush();
+        if (!CloseFile(m_File)) m_FileError = true;
+        m_File = -1;
+
+        return !m_FileError;
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include "../Core/Value.h"
+#include <Core/UUID.h>
+#include <string>
+#include <string_view>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // JsonWriter - Streaming JSON writer into a reusable buffer
+    //=========================================================================
+
+    /// Appends straight into one growable buffer: no temporaries per key or
+    /// value, numbers through std::to_chars (floats in shortest round-trip
+    /// form), and strings copied in one piece unless they need escaping.
+    /// Reset() keeps the capacity, so a long-lived writer (e.g. for editor
+    /// autosave) stops allocating after the first document.
+    ///
+    /// With a file attached the buffer is flushed to the file descriptor
+    /// whenever it passes FlushThreshold, so output size is not bounded by
+    /// memory.
+    class JsonWriter
+    {
+    public:
+        static constexpr size_t FlushThreshold = 64 * 1024;
+
+        explicit JsonWriter(bool pretty = true) : m_Pretty(pretty) {}
+        ~JsonWriter();
+
+        JsonWriter(const JsonWriter&) = delete;
+        JsonWriter& operator=(const JsonWriter&) = delete;
+
+        /// Start a new document, keeping the buffer's capacity
+        void Reset(bool pretty);
+        void Reset() { Reset(m_Pretty); }
+
+        //---------------------------------------------------------------------
+        // Structure
+        //---------------------------------------------------------------------
+
+        void BeginObject();
+        void EndObject();
+        void BeginArray();
+        void EndArray();
+
+        void Key(std::string_view key);
+        void ArrayItem();
+
+        //---------------------------------------------------------------------
+        // Values
+        //---------------------------------------------------------------------
+
+        void WriteString(std::string_view value);
+        void WriteInt(i64 value);
+        void WriteFloat(f64 value);
+        void WriteFloat(f32 value);             // Shortest form that reads back as the same f32
+        void WriteBool(bool value) { Append(value ? std::string_view("true") : std::string_view("false")); }
+        void WriteNull() { Append("null"); }
+        void WriteUuid(const UUID& id);         // Canonical text form, no temporary string
+
+        //---------------------------------------------------------------------
+        // Output
+        //---------------------------------------------------------------------
+
+        /// Bytes written so far (pending bytes only when streaming to a file)
+        std::string_view GetView() const { return m_Buffer; }
+        size_t GetSize() const { return m_Buffer.size(); }
+
+        std::string GetResult() const { return m_Buffer; }
+
+        /// Move the document out; the writer is left empty
+        std::string TakeResult() { return std::move(m_Buffer); }
+
+        /// Stream to a file from now on (truncates it). False if it cannot be opened.
+        bool BeginFile(const std::string& path);
+
+        /// Flush and close the file. False if any write failed.
+        bool EndFile();
+
+    private:
+        void Append(std::string_view text)
+        {
+            m_Buffer.append(text.data(), text.size());
+            if (m_File >= 0 && m_Buffer.size() >= FlushThreshold) Flush();
+        }
+
+        void Append(char c)
+        {
+            m_Buffer.push_back(c);
+        }
+
+        void NewLine();
+        void AppendEscaped(std::string_view text);
+        void Flush();
+
+        std::string m_Buffer;
+        int m_Indent = 0;
+        bool m_Pretty = true;
+        bool m_Empty = true;
+
+        int m_File = -1;                        // File descriptor while streaming
+        bool m_FileError = false;
+    };
+}
@@ -0,0 +1,103 @@
+#include "MappedFile.h"
+#include <fstream>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace RiftSpire
+{
+    std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path)
+    {
+        std::unique_ptr<MappedFile> file(new MappedFile());
+
+#ifdef _WIN32
+        HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (handle != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER size;
+            if (GetFileSizeEx(handle, &size) && size.QuadPart > 0)
+            {
+                HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping)
+                {
+                    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    CloseHandle(mapping);  // The view keeps the mapping alive
+
+                    if (view)
+                    {
+                        file->m_Mapping = view;
+                        file->m_Data = static_cast<const u8*>(view);
+                        file->m_Size = static_cast<size_t>(size.QuadPart);
+                    }
+                }
+            }
+            CloseHandle(handle);
+
+            if (file->m_Mapping) return file;
+        }
+#else
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd >= 0)
+        {
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && info.st_size > 0)
+            {
+                void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (view != MAP_FAILED)
+                {
+                    file->m_Mapping = view;
+                    file->m_Data = static_cast<const u8*>(view);
+                    file->m_Size = static_cast<size_t>(info.st_size);
+                }
+            }
+            ::close(fd);
+
+            if (file->m_Mapping) return file;
+        }
+#endif
+
+        // Empty files cannot be mapped; anything else unmappable is read instead
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if (!stream.is_open())
+        {
+            return nullptr;
+        }
+
+        const std::streamsize size = stream.tellg();
+        stream.seekg(0);
+
+        file->m_Fallback.resize(static_cast<size_t>(size));
+        if (size > 0 && !stream.read(reinterpret_cast<char*>(file->m_Fallback.data()), size))
+        {
+            return nullptr;
+        }
+
+        file->m_Data = file->m_Fallback.data();
+        file->m_Size = file->m_Fallback.size();
+        return file;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (!m_Mapping) return;
+
+#ifdef _WIN32
+        UnmapViewOfFile(m_Mapping);
+#else
+        ::munmap(m_Mapping, m_Size);
+#endif
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "../Core/BlockTypes.h"
+#include <string>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace RiftSpire
+{
+    //=========================================================================
+    // MappedFile - Read-only view of a whole file
+    //=========================================================================
+
+    /// Memory-maps the file where the platform allows it and falls back to
+    /// reading it into a buffer otherwise. The bytes stay valid for the
+    /// lifetime of the object.
+    class MappedFile
+    {
+    public:
+        static std::unique_ptr<MappedFile> Open(const std::string& path);
+
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const u8* GetData() const { return m_Data; }
+        size_t GetSize() const { return m_Size; }
+        std::span<const u8> GetBytes() const { return { m_Data, m_Size }; }
+
+        /// True if the bytes come from a mapping rather than a heap copy
+        bool IsMapped() const { return m_Mapping != nullptr; }
+
+    private:
+        MappedFile() = default;
+
+        const u8* m_Data = nullptr;
+        size_t m_Size = 0;
+
+        void* m_Mapping = nullptr;      // Platform mapping handle/address
+        std::vector<u8> m_Fallback;     // Used when mapping is unavailable
+    };
+}
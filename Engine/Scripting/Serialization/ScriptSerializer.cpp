@@ -1,135 +1,16 @@
 #include "ScriptSerializer.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
+#include "MappedFile.h"
 #include "../Core/BlockRegistry.h"
 // #include <Core/Logger.h>  // TODO: Integrate logger
+#include <algorithm>
 #include <fstream>
-#include <sstream>
-#include <iomanip>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace RiftSpire
 {
-    //=========================================================================
-    // Simple JSON Writer (no external dependency)
-    //=========================================================================
-    
-    class JsonWriter
-    {
-    public:
-        JsonWriter(bool pretty = true) : m_Pretty(pretty) {}
-        
-        void BeginObject()
-        {
-            Write("{");
-            m_Indent++;
-            m_Empty = true;
-        }
-        
-        void EndObject()
-        {
-            m_Indent--;
-            if (!m_Empty) NewLine();
-            Write("}");
-            m_Empty = false;
-        }
-        
-        void BeginArray()
-        {
-            Write("[");
-            m_Indent++;
-            m_Empty = true;
-        }
-        
-        void EndArray()
-        {
-            m_Indent--;
-            if (!m_Empty) NewLine();
-            Write("]");
-            m_Empty = false;
-        }
-        
-        void Key(const std::string& key)
-        {
-            if (!m_Empty) Write(",");
-            NewLine();
-            Write("\"" + EscapeString(key) + "\":");
-            if (m_Pretty) Write(" ");
-            m_Empty = false;
-        }
-        
-        void ArrayItem()
-        {
-            if (!m_Empty) Write(",");
-            NewLine();
-            m_Empty = false;
-        }
-        
-        void WriteString(const std::string& value)
-        {
-            Write("\"" + EscapeString(value) + "\"");
-        }
-        
-        void WriteInt(i64 value)
-        {
-            Write(std::to_string(value));
-        }
-        
-        void WriteFloat(f64 value)
-        {
-            std::ostringstream ss;
-            ss << std::fixed << std::setprecision(6) << value;
-            Write(ss.str());
-        }
-        
-        void WriteBool(bool value)
-        {
-            Write(value ? "true" : "false");
-        }
-        
-        void WriteNull()
-        {
-            Write("null");
-        }
-        
-        std::string GetResult() const { return m_Buffer.str(); }
-        
-    private:
-        void Write(const std::string& s) { m_Buffer << s; }
-        
-        void NewLine()
-        {
-            if (m_Pretty)
-            {
-                m_Buffer << "\n";
-                for (int i = 0; i < m_Indent; i++)
-                {
-                    m_Buffer << "  ";
-                }
-            }
-        }
-        
-        std::string EscapeString(const std::string& s)
-        {
-            std::string result;
-            for (char c : s)
-            {
-                switch (c)
-                {
-                    case '"': result += "\\\""; break;
-                    case '\\': result += "\\\\"; break;
-                    case '\n': result += "\\n"; break;
-                    case '\r': result += "\\r"; break;
-                    case '\t': result += "\\t"; break;
-                    default: result += c; break;
-                }
-            }
-            return result;
-        }
-        
-        std::ostringstream m_Buffer;
-        int m_Indent = 0;
-        bool m_Pretty = true;
-        bool m_Empty = true;
-    };
-    
     //=========================================================================
     // Helper: Serialize Value
     //=========================================================================
@@ -157,7 +38,7 @@ namespace RiftSpire
                 writer.WriteFloat(value.AsFloat());
                 break;
             case ValueType::String:
-                writer.WriteString(value.AsString());
+                writer.WriteString(value.AsStringView());
                 break;
             case ValueType::Vector2:
             {
@@ -204,18 +85,25 @@ namespace RiftSpire
     // Helper: Serialize Block
     //=========================================================================
     
-    static void SerializeBlock(JsonWriter& writer, const Block* block)
+    static void SerializeBlock(JsonWriter& writer, const Block* block, BlockTypeTable* types, bool detached = false)
     {
         if (!block) return;
         
         writer.BeginObject();
         
         writer.Key("id");
-        writer.WriteString(block->GetId().ToString());
+        writer.WriteUuid(block->GetId());
         
         writer.Key("type");
         writer.WriteString(block->GetTypeId());
         
+        // Index into the file's "types" table (numeric id that survives registry reordering)
+        if (types)
+        {
+            writer.Key("typeIndex");
+            writer.WriteInt(types->Add(block->GetDefinition()));
+        }
+        
         writer.Key("position");
         writer.BeginObject();
         writer.Key("x"); writer.WriteFloat(block->GetPosition().x);
@@ -240,6 +128,13 @@ namespace RiftSpire
             writer.WriteString(block->GetComment());
         }
         
+        // Kept alive by a connection only, not listed in the script
+        if (detached)
+        {
+            writer.Key("detached");
+            writer.WriteBool(true);
+        }
+        
         // Input slots
         if (block->GetInputSlotCount() > 0)
         {
@@ -260,7 +155,7 @@ namespace RiftSpire
                 if (slot->GetConnectedBlock())
                 {
                     writer.Key("connected");
-                    writer.WriteString(slot->GetConnectedBlock()->GetId().ToString());
+                    writer.WriteUuid(slot->GetConnectedBlock()->GetId());
                 }
                 else
                 {
@@ -297,7 +192,7 @@ namespace RiftSpire
                 for (const auto& nested : slot->GetNestedBlocks())
                 {
                     writer.ArrayItem();
-                    SerializeBlock(writer, nested.get());
+                    SerializeBlock(writer, nested.get(), types);
                 }
                 
                 writer.EndArray();
@@ -311,12 +206,703 @@ namespace RiftSpire
         if (block->GetNextBlock())
         {
             writer.Key("next");
-            writer.WriteString(block->GetNextBlock()->GetId().ToString());
+            writer.WriteUuid(block->GetNextBlock()->GetId());
         }
         
         writer.EndObject();
     }
     
+    //=========================================================================
+    // Helper: Collect Block Types
+    //=========================================================================
+    
+    static void CollectBlockTypes(BlockTypeTable& types, const Block* block)
+    {
+        if (!block) return;
+        
+        types.Add(block->GetDefinition());
+        
+        for (size_t i = 0; i < block->GetNestedSlotCount(); i++)
+        {
+            for (const auto& nested : block->GetNestedSlot(i)->GetNestedBlocks())
+            {
+                CollectBlockTypes(types, nested.get());
+            }
+        }
+    }
+    
+    //=========================================================================
+    // Helper: Collect Detached Blocks
+    //=========================================================================
+    
+    /// Blocks reached through "next" or "connected" that are neither script
+    /// blocks nor written inline in a nested body. They would otherwise be
+    /// lost, since the file only refers to them by id.
+    static std::vector<const Block*> CollectDetachedBlocks(const std::vector<BlockPtr>& blocks)
+    {
+        std::unordered_set<const Block*> written;
+        std::vector<const Block*> pending;
+        std::vector<const Block*> detached;
+        std::vector<const Block*> stack;
+        
+        written.reserve(blocks.size() * 2);
+        pending.reserve(blocks.size() * 2);
+        
+        auto markWritten = [&](const Block* root)
+        {
+            // A block and everything serialized inline below it
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                const Block* block = stack.back();
+                stack.pop_back();
+                if (!block || !written.insert(block).second) continue;
+                
+                pending.push_back(block);
+                for (size_t i = 0; i < block->GetNestedSlotCount(); i++)
+                {
+                    for (const auto& nested : block->GetNestedSlot(i)->GetNestedBlocks())
+                    {
+                        stack.push_back(nested.get());
+                    }
+                }
+            }
+        };
+        
+        for (const auto& block : blocks)
+        {
+            markWritten(block.get());
+        }
+        
+        for (size_t cursor = 0; cursor < pending.size(); cursor++)
+        {
+            const Block* block = pending[cursor];
+            
+            auto visit = [&](const Block* target)
+            {
+                if (target && !written.count(target))
+                {
+                    detached.push_back(target);
+                    markWritten(target);
+                }
+            };
+            
+            for (size_t i = 0; i < block->GetInputSlotCount(); i++)
+            {
+                visit(block->GetInputSlot(i)->GetConnectedBlock().get());
+            }
+            visit(block->GetNextBlock().get());
+        }
+        
+        return detached;
+    }
+    
+    //=========================================================================
+    // Helper: JSON Loader
+    //=========================================================================
+    
+    /// Rebuilds blocks in a single pass over the document. "next" and
+    /// "connected" may name blocks that appear later in the file, so they are
+    /// queued in a fix-up table and resolved once everything is read.
+    class ScriptJsonLoader
+    {
+    public:
+        explicit ScriptJsonLoader(std::string_view json) : m_Reader(json) {}
+        
+        BlockScriptPtr LoadScript(u32 maxVersion);
+        std::vector<BlockPtr> LoadClipboard();
+        
+    private:
+        static constexpr u32 None = 0xFFFFFFFF;
+        
+        struct Fixup
+        {
+            u32 Source;             // Index into m_Created
+            u32 Slot;               // Input slot index, None for the statement chain
+            UUID Target;
+        };
+        
+        bool ReadTypes();
+        u32 Resolve(const UUID& target) const;
+        BlockPtr ReadBlock(bool& detached);
+        bool ReadInputs(const BlockPtr& block, u32 source);
+        bool ReadNested(const BlockPtr& block);
+        bool ReadValue(Value& value);
+        bool ReadComponents(f32 (&components)[4]);
+        bool Finish();
+        
+        JsonReader m_Reader;
+        std::vector<TypeIndex> m_Types;             // File "types" table -> registry
+        std::vector<BlockPtr> m_Created;            // Keeps blocks alive until fix-up
+        std::unordered_map<UUID, u32> m_IndexById;
+        std::vector<Fixup> m_Fixups;
+        
+        // Pasted blocks get new ids, so they never clash with their originals
+        bool m_FreshIds = false;
+        std::unordered_map<UUID, UUID> m_FreshIdOf;  // Id in the data -> new id
+    };
+    
+    bool ScriptJsonLoader::ReadTypes()
+    {
+        const BlockRegistry& registry = BlockRegistry::Get();
+        
+        if (!m_Reader.BeginArray()) return false;
+        while (m_Reader.NextElement())
+        {
+            std::string_view name;
+            if (!m_Reader.ReadString(name)) return false;
+            m_Types.push_back(registry.GetTypeIndex(name));
+        }
+        return !m_Reader.HasError();
+    }
+    
+    u32 ScriptJsonLoader::Resolve(const UUID& target) const
+    {
+        UUID id = target;
+        if (m_FreshIds)
+        {
+            auto fresh = m_FreshIdOf.find(target);
+            if (fresh == m_FreshIdOf.end()) return None;
+            id = fresh->second;
+        }
+        
+        auto it = m_IndexById.find(id);
+        return it != m_IndexById.end() ? it->second : None;
+    }
+    
+    bool ScriptJsonLoader::ReadComponents(f32 (&components)[4])
+    {
+        if (!m_Reader.BeginObject()) return false;
+        
+        std::string_view key;
+        while (m_Reader.NextKey(key))
+        {
+            int index = -1;
+            if (key == "x" || key == "r") index = 0;
+            else if (key == "y" || key == "g") index = 1;
+            else if (key == "z" || key == "b") index = 2;
+            else if (key == "a") index = 3;
+            
+            if (index < 0)
+            {
+                if (!m_Reader.SkipValue()) return false;
+                continue;
+            }
+            
+            f64 component;
+            if (!m_Reader.ReadFloat(component)) return false;
+            components[index] = static_cast<f32>(component);
+        }
+        return !m_Reader.HasError();
+    }
+    
+    bool ScriptJsonLoader::ReadValue(Value& value)
+    {
+        if (!m_Reader.BeginObject()) return false;
+        
+        i64 type = static_cast<i64>(ValueType::Void);
+        bool typeRead = false;
+        
+        bool boolValue = false;
+        i64 intValue = 0;
+        f64 floatValue = 0.0;
+        bool isInteger = false;
+        std::string stringValue;
+        f32 components[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        
+        std::string_view key;
+        while (m_Reader.NextKey(key))
+        {
+            if (key == "type")
+            {
+                if (!m_Reader.ReadInt(type)) return false;
+                typeRead = true;
+                continue;
+            }
+            
+            if (key != "value")
+            {
+                if (!m_Reader.SkipValue()) return false;
+                continue;
+            }
+            
+            switch (m_Reader.PeekValue())
+            {
+                case JsonValueKind::Bool:
+                    if (!m_Reader.ReadBool(boolValue)) return false;
+                    break;
+                case JsonValueKind::Number:
+                {
+                    // ToJson writes "type" first, so integers keep full 64-bit precision
+                    const bool integral = typeRead && (type == static_cast<i64>(ValueType::Int) ||
+                                                       type == static_cast<i64>(ValueType::Entity));
+                    if (integral)
+                    {
+                        if (!m_Reader.ReadInt(intValue)) return false;
+                        floatValue = static_cast<f64>(intValue);
+                        isInteger = true;
+                    }
+                    else
+                    {
+                        if (!m_Reader.ReadFloat(floatValue)) return false;
+                    }
+                    break;
+                }
+                case JsonValueKind::String:
+                {
+                    std::string_view text;
+                    if (!m_Reader.ReadString(text)) return false;
+                    stringValue.assign(text);
+                    break;
+                }
+                case JsonValueKind::Object:
+                    if (!ReadComponents(components)) return false;
+                    break;
+                default:
+                    if (!m_Reader.SkipValue()) return false;
+                    break;
+            }
+        }
+        if (m_Reader.HasError()) return false;
+        
+        if (!isInteger) intValue = static_cast<i64>(floatValue);
+        
+        switch (static_cast<ValueType>(type))
+        {
+            case ValueType::Bool:    value = Value(boolValue); break;
+            case ValueType::Int:     value = Value(intValue); break;
+            case ValueType::Float:   value = Value(floatValue); break;
+            case ValueType::String:  value = Value(std::move(stringValue)); break;
+            case ValueType::Vector2: value = Value(glm::vec2(components[0], components[1])); break;
+            case ValueType::Vector3: value = Value(glm::vec3(components[0], components[1], components[2])); break;
+            case ValueType::Color:   value = Value(glm::vec4(components[0], components[1], components[2], components[3])); break;
+            case ValueType::Entity:  value = Value::FromEntityHandle(static_cast<Value::EntityHandle>(intValue)); break;
+            default:                 value = Value(); break;
+        }
+        return true;
+    }
+    
+    bool ScriptJsonLoader::ReadInputs(const BlockPtr& block, u32 source)
+    {
+        if (!m_Reader.BeginArray()) return false;
+        
+        for (size_t position = 0; m_Reader.NextElement(); position++)
+        {
+            if (!m_Reader.BeginObject()) return false;
+            
+            // Positional until "name" says otherwise
+            size_t slot = position < block->GetInputSlotCount() ? position : Block::InvalidSlot;
+            
+            std::string_view key;
+            while (m_Reader.NextKey(key))
+            {
+                if (key == "name")
+                {
+                    std::string_view name;
+                    if (!m_Reader.ReadString(name)) return false;
+                    slot = block->FindInputSlot(name, position);
+                }
+                else if (key == "connected")
+                {
+                    std::string_view id;
+                    UUID target;
+                    if (!m_Reader.ReadString(id)) return false;
+                    if (slot != Block::InvalidSlot && UUID::TryParse(id, target))
+                    {
+                        m_Fixups.push_back({ source, static_cast<u32>(slot), target });
+                    }
+                }
+                else if (key == "default")
+                {
+                    Value value;
+                    if (!ReadValue(value)) return false;
+                    if (slot != Block::InvalidSlot)
+                    {
+                        block->GetInputSlot(slot)->SetDefaultValue(value);
+                    }
+                }
+                else if (!m_Reader.SkipValue())
+                {
+                    return false;
+                }
+            }
+            if (m_Reader.HasError()) return false;
+        }
+        return !m_Reader.HasError();
+    }
+    
+    bool ScriptJsonLoader::ReadNested(const BlockPtr& block)
+    {
+        if (!m_Reader.BeginArray()) return false;
+        
+        for (size_t position = 0; m_Reader.NextElement(); position++)
+        {
+            if (!m_Reader.BeginObject()) return false;
+            
+            size_t slot = position < block->GetNestedSlotCount() ? position : Block::InvalidSlot;
+            
+            std::string_view key;
+            while (m_Reader.NextKey(key))
+            {
+                if (key == "name")
+                {
+                    std::string_view name;
+                    if (!m_Reader.ReadString(name)) return false;
+                    slot = block->FindNestedSlot(name, position);
+                }
+                else if (key == "blocks")
+                {
+                    if (!m_Reader.BeginArray()) return false;
+                    while (m_Reader.NextElement())
+                    {
+                        if (m_Reader.PeekValue() != JsonValueKind::Object)
+                        {
+                            if (!m_Reader.SkipValue()) return false;
+                            continue;
+                        }
+                        
+                        bool detached = false;
+                        BlockPtr nested = ReadBlock(detached);
+                        if (m_Reader.HasError()) return false;
+                        if (nested && slot != Block::InvalidSlot)
+                        {
+                            block->GetNestedSlot(slot)->AddNestedBlock(nested);
+                        }
+                    }
+                    if (m_Reader.HasError()) return false;
+                }
+                else if (!m_Reader.SkipValue())
+                {
+                    return false;
+                }
+            }
+            if (m_Reader.HasError()) return false;
+        }
+        return !m_Reader.HasError();
+    }
+    
+    BlockPtr ScriptJsonLoader::ReadBlock(bool& detached)
+    {
+        if (!m_Reader.BeginObject()) return nullptr;
+        
+        const BlockRegistry& registry = BlockRegistry::Get();
+        
+        UUID id;
+        UUID next;
+        TypeIndex type = InvalidTypeIndex;
+        f32 position[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        bool disabled = false;
+        bool collapsed = false;
+        std::string comment;
+        detached = false;
+        
+        BlockPtr block;
+        u32 index = None;
+        
+        // Created once the type is known; slots need the instance
+        auto ensureBlock = [&]() -> bool
+        {
+            if (block) return true;
+            if (type == InvalidTypeIndex) return false;
+            
+            const UUID sourceId = id;
+            if (m_FreshIds || !id.IsValid() || m_IndexById.count(id)) id = UUID::Generate();
+            block = registry.CreateBlock(type, id);
+            if (!block) return false;
+            
+            index = static_cast<u32>(m_Created.size());
+            m_Created.push_back(block);
+            m_IndexById.emplace(id, index);
+            if (m_FreshIds && sourceId.IsValid()) m_FreshIdOf.emplace(sourceId, id);
+            return true;
+        };
+        
+        std::string_view key;
+        while (m_Reader.NextKey(key))
+        {
+            bool ok = true;
+            
+            if (key == "id")
+            {
+                std::string_view text;
+                ok = m_Reader.ReadString(text);
+                if (ok && !block) UUID::TryParse(text, id);
+            }
+            else if (key == "type")
+            {
+                std::string_view name;
+                ok = m_Reader.ReadString(name);
+                if (ok && type == InvalidTypeIndex) type = registry.GetTypeIndex(name);
+            }
+            else if (key == "typeIndex")
+            {
+                // Only needed when the name did not resolve
+                i64 local = -1;
+                ok = m_Reader.ReadInt(local);
+                if (ok && type == InvalidTypeIndex && local >= 0 && static_cast<u64>(local) < m_Types.size())
+                {
+                    type = m_Types[static_cast<size_t>(local)];
+                }
+            }
+            else if (key == "position")
+            {
+                ok = ReadComponents(position);
+            }
+            else if (key == "disabled")
+            {
+                ok = m_Reader.ReadBool(disabled);
+            }
+            else if (key == "collapsed")
+            {
+                ok = m_Reader.ReadBool(collapsed);
+            }
+            else if (key == "detached")
+            {
+                ok = m_Reader.ReadBool(detached);
+            }
+            else if (key == "comment")
+            {
+                std::string_view text;
+                ok = m_Reader.ReadString(text);
+                comment.assign(text);
+            }
+            else if (key == "inputs")
+            {
+                ok = ensureBlock() ? ReadInputs(block, index) : m_Reader.SkipValue();
+            }
+            else if (key == "nested")
+            {
+                ok = ensureBlock() ? ReadNested(block) : m_Reader.SkipValue();
+            }
+            else if (key == "next")
+            {
+                std::string_view text;
+                ok = m_Reader.ReadString(text);
+                if (ok) UUID::TryParse(text, next);
+            }
+            else
+            {
+                ok = m_Reader.SkipValue();
+            }
+            
+            if (!ok) return nullptr;
+        }
+        
+        // Unknown block types are dropped, along with references to them
+        if (m_Reader.HasError() || !ensureBlock()) return nullptr;
+        
+        block->SetPosition({ position[0], position[1] });
+        block->SetDisabled(disabled);
+        block->SetCollapsed(collapsed);
+        if (!comment.empty()) block->SetComment(comment);
+        
+        if (next.IsValid())
+        {
+            m_Fixups.push_back({ index, None, next });
+        }
+        
+        return block;
+    }
+    
+    bool ScriptJsonLoader::Finish()
+    {
+        if (m_Reader.HasError() || !m_Reader.IsAtEnd()) return false;
+        
+        const u32 count = static_cast<u32>(m_Created.size());
+        std::vector<u32> nextOf(count, None);
+        std::vector<u8> hasPrevious(count, 0);
+        std::vector<const Fixup*> connections;
+        std::vector<std::pair<u32, u32>> edges;     // (from, to) over chains, nested bodies and inputs
+        
+        for (const Fixup& fixup : m_Fixups)
+        {
+            const u32 target = Resolve(fixup.Target);
+            if (target == None) continue;           // Dangling reference
+            if (fixup.Slot != None)
+            {
+                connections.push_back(&fixup);
+                edges.push_back({ fixup.Source, target });
+            }
+            else if (!hasPrevious[target] && nextOf[fixup.Source] == None)
+            {
+                // A block has at most one previous block
+                nextOf[fixup.Source] = target;
+                hasPrevious[target] = 1;
+                edges.push_back({ fixup.Source, target });
+            }
+        }
+        
+        for (u32 i = 0; i < count; i++)
+        {
+            const Block* block = m_Created[i].get();
+            for (size_t s = 0; s < block->GetNestedSlotCount(); s++)
+            {
+                for (const auto& nested : block->GetNestedSlot(s)->GetNestedBlocks())
+                {
+                    edges.push_back({ i, m_IndexById.at(nested->GetId()) });
+                }
+            }
+        }
+        
+        // Reject cycles before wiring anything, as BinaryScriptView::Open does:
+        // they would leak shared_ptr references and recurse without end at
+        // run time. Kahn's algorithm over in-degrees.
+        std::sort(edges.begin(), edges.end());
+        std::vector<u32> firstEdge(count + 1, 0);
+        std::vector<u32> inDegree(count, 0);
+        for (const auto& [from, to] : edges)
+        {
+            firstEdge[from + 1]++;
+            inDegree[to]++;
+        }
+        for (u32 i = 0; i < count; i++)
+        {
+            firstEdge[i + 1] += firstEdge[i];
+        }
+        
+        std::vector<u32> ready;
+        ready.reserve(count);
+        for (u32 i = 0; i < count; i++)
+        {
+            if (inDegree[i] == 0) ready.push_back(i);
+        }
+        
+        for (size_t cursor = 0; cursor < ready.size(); cursor++)
+        {
+            for (u32 e = firstEdge[ready[cursor]]; e < firstEdge[ready[cursor] + 1]; e++)
+            {
+                if (--inDegree[edges[e].second] == 0) ready.push_back(edges[e].second);
+            }
+        }
+        
+        if (ready.size() != count) return false;
+        
+        for (const Fixup* fixup : connections)
+        {
+            m_Created[fixup->Source]->GetInputSlot(fixup->Slot)->Connect(m_Created[Resolve(fixup->Target)]);
+        }
+        
+        for (u32 i = 0; i < count; i++)
+        {
+            if (nextOf[i] != None)
+            {
+                m_Created[i]->SetNextBlock(m_Created[nextOf[i]]);
+            }
+        }
+        
+        return true;
+    }
+    
+    BlockScriptPtr ScriptJsonLoader::LoadScript(u32 maxVersion)
+    {
+        auto script = std::make_shared<BlockScript>();
+        std::vector<BlockPtr> blocks;
+        
+        if (!m_Reader.BeginObject()) return nullptr;
+        
+        std::string_view key;
+        while (m_Reader.NextKey(key))
+        {
+            bool ok = true;
+            
+            if (key == "version")
+            {
+                i64 version = 0;
+                ok = m_Reader.ReadInt(version) && version >= 1 && version <= static_cast<i64>(maxVersion);
+            }
+            else if (key == "id")
+            {
+                std::string_view text;
+                UUID id;
+                ok = m_Reader.ReadString(text);
+                if (ok && UUID::TryParse(text, id)) script->SetId(id);
+            }
+            else if (key == "name")
+            {
+                std::string_view text;
+                ok = m_Reader.ReadString(text);
+                script->SetName(std::string(text));
+            }
+            else if (key == "description")
+            {
+                std::string_view text;
+                ok = m_Reader.ReadString(text);
+                script->SetDescription(std::string(text));
+            }
+            else if (key == "types")
+            {
+                ok = ReadTypes();
+            }
+            else if (key == "blocks")
+            {
+                ok = m_Reader.BeginArray();
+                while (ok && m_Reader.NextElement())
+                {
+                    bool detached = false;
+                    BlockPtr block = ReadBlock(detached);
+                    if (block && !detached) blocks.push_back(block);
+                    ok = !m_Reader.HasError();
+                }
+                ok = ok && !m_Reader.HasError();
+            }
+            else
+            {
+                ok = m_Reader.SkipValue();
+            }
+            
+            if (!ok) return nullptr;
+        }
+        
+        if (!Finish()) return nullptr;
+        
+        for (auto& block : blocks)
+        {
+            script->AddBlock(std::move(block));
+        }
+        return script;
+    }
+    
+    std::vector<BlockPtr> ScriptJsonLoader::LoadClipboard()
+    {
+        std::vector<BlockPtr> blocks;
+        m_FreshIds = true;
+        
+        if (!m_Reader.BeginObject()) return {};
+        
+        std::string_view key;
+        while (m_Reader.NextKey(key))
+        {
+            bool ok = true;
+            
+            if (key == "type")
+            {
+                std::string_view type;
+                ok = m_Reader.ReadString(type) && type == "riftblocks_clipboard";
+            }
+            else if (key == "blocks")
+            {
+                ok = m_Reader.BeginArray();
+                while (ok && m_Reader.NextElement())
+                {
+                    bool detached = false;
+                    BlockPtr block = ReadBlock(detached);
+                    if (block && !detached) blocks.push_back(block);
+                    ok = !m_Reader.HasError();
+                }
+                ok = ok && !m_Reader.HasError();
+            }
+            else
+            {
+                ok = m_Reader.SkipValue();
+            }
+            
+            if (!ok) return {};
+        }
+        
+        if (!Finish()) return {};
+        return blocks;
+    }
+    
     //=========================================================================
     // JSON Serialization
     //=========================================================================
@@ -326,6 +912,18 @@ namespace RiftSpire
         if (!script) return "{}";
         
         JsonWriter writer(pretty);
+        WriteJson(script, writer);
+        return writer.TakeResult();
+    }
+    
+    void ScriptSerializer::WriteJson(const BlockScript* script, JsonWriter& writer)
+    {
+        if (!script)
+        {
+            writer.BeginObject();
+            writer.EndObject();
+            return;
+        }
         
         writer.BeginObject();
         
@@ -333,7 +931,7 @@ namespace RiftSpire
         writer.WriteInt(JSON_VERSION);
         
         writer.Key("id");
-        writer.WriteString(script->GetId().ToString());
+        writer.WriteUuid(script->GetId());
         
         writer.Key("name");
         writer.WriteString(script->GetName());
@@ -344,63 +942,83 @@ namespace RiftSpire
             writer.WriteString(script->GetDescription());
         }
         
+        const auto detached = CollectDetachedBlocks(script->GetBlocks());
+        
+        // Type name table, written first so readers can resolve "typeIndex"
+        BlockTypeTable types;
+        for (const auto& block : script->GetBlocks())
+        {
+            CollectBlockTypes(types, block.get());
+        }
+        for (const Block* block : detached)
+        {
+            CollectBlockTypes(types, block);
+        }
+        
+        writer.Key("types");
+        writer.BeginArray();
+        for (const auto& name : types.GetNames())
+        {
+            writer.ArrayItem();
+            writer.WriteString(name);
+        }
+        writer.EndArray();
+        
         writer.Key("blocks");
         writer.BeginArray();
         
-        // Only serialize root blocks (others are nested or chained)
-        auto rootBlocks = script->GetRootBlocks();
-        for (const auto& block : rootBlocks)
+        // Every script block, chained ones included ("next" only holds an id);
+        // nested bodies are written inline by their parent
+        for (const auto& block : script->GetBlocks())
         {
             writer.ArrayItem();
-            SerializeBlock(writer, block.get());
+            SerializeBlock(writer, block.get(), &types);
+        }
+        
+        for (const Block* block : detached)
+        {
+            writer.ArrayItem();
+            SerializeBlock(writer, block, &types, true);
         }
         
         writer.EndArray();
         
         writer.EndObject();
-        
-        return writer.GetResult();
     }
     
-    BlockScriptPtr ScriptSerializer::FromJson(const std::string& json)
+    BlockScriptPtr ScriptSerializer::FromJson(std::string_view json)
     {
-        // TODO: Implement JSON parser
-        // For now, return empty script
-        // RS_WARN("JSON deserialization not yet implemented");
-        return std::make_shared<BlockScript>("Imported Script");
+        ScriptJsonLoader loader(json);
+        return loader.LoadScript(JSON_VERSION);
     }
     
     bool ScriptSerializer::SaveToJsonFile(const BlockScript* script, const std::string& path)
     {
-        std::string json = ToJson(script, true);
-        
-        std::ofstream file(path);
-        if (!file.is_open())
+        // Streamed in chunks; the whole document is never held in memory
+        JsonWriter writer(true);
+        if (!writer.BeginFile(path))
         {
             // RS_ERROR("Failed to open file for writing: {}", path);
             return false;
         }
         
-        file << json;
-        file.close();
+        WriteJson(script, writer);
         
         // RS_INFO("Saved script to: {}", path);
-        return true;
+        return writer.EndFile();
     }
     
     BlockScriptPtr ScriptSerializer::LoadFromJsonFile(const std::string& path)
     {
-        std::ifstream file(path);
-        if (!file.is_open())
+        auto file = MappedFile::Open(path);
+        if (!file)
         {
             // RS_ERROR("Failed to open file for reading: {}", path);
             return nullptr;
         }
         
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        
-        return FromJson(buffer.str());
+        const std::string_view json(reinterpret_cast<const char*>(file->GetData()), file->GetSize());
+        return FromJson(json);
     }
     
     //=========================================================================
@@ -409,44 +1027,20 @@ namespace RiftSpire
     
     std::vector<u8> ScriptSerializer::ToBinary(const BlockScript* script)
     {
-        std::vector<u8> buffer;
-        
-        // Write magic number
-        auto writeu32 = [&](u32 v) {
-            buffer.push_back(v & 0xFF);
-            buffer.push_back((v >> 8) & 0xFF);
-            buffer.push_back((v >> 16) & 0xFF);
-            buffer.push_back((v >> 24) & 0xFF);
-        };
-        
-        writeu32(BINARY_MAGIC);
-        writeu32(BINARY_VERSION);
-        
-        // TODO: Implement binary serialization
-        // RS_WARN("Binary serialization not yet implemented");
-        
-        return buffer;
+        if (!script) return {};
+        return BinaryScriptWriter::Write(*script);
     }
     
     BlockScriptPtr ScriptSerializer::FromBinary(const std::vector<u8>& data)
     {
-        if (data.size() < 8)
+        BinaryScriptView view;
+        if (!view.Open(data))
         {
             // RS_ERROR("Invalid binary script data");
             return nullptr;
         }
         
-        // Read magic number
-        u32 magic = data[0] | (data[1] << 8) | (data[2] << 16) | (data[3] << 24);
-        if (magic != BINARY_MAGIC)
-        {
-            // RS_ERROR("Invalid script file magic number");
-            return nullptr;
-        }
-        
-        // TODO: Implement binary deserialization
-        // RS_WARN("Binary deserialization not yet implemented");
-        return std::make_shared<BlockScript>("Imported Script");
+        return view.CreateScript();
     }
     
     bool ScriptSerializer::SaveToBinaryFile(const BlockScript* script, const std::string& path)
@@ -468,17 +1062,21 @@ namespace RiftSpire
     
     BlockScriptPtr ScriptSerializer::LoadFromBinaryFile(const std::string& path)
     {
-        std::ifstream file(path, std::ios::binary);
-        if (!file.is_open())
+        auto file = OpenBinaryFile(path);
+        return file ? file->GetScript() : nullptr;
+    }
+    
+    BinaryScriptFilePtr ScriptSerializer::OpenBinaryFile(const std::string& path)
+    {
+        std::string error;
+        auto file = BinaryScriptFile::Open(path, &error);
+        if (!file)
         {
-            // RS_ERROR("Failed to open file for reading: {}", path);
+            // RS_ERROR("Failed to load binary script {}: {}", path, error);
             return nullptr;
         }
         
-        std::vector<u8> data((std::istreambuf_iterator<char>(file)),
-                              std::istreambuf_iterator<char>());
-        
-        return FromBinary(data);
+        return file;
     }
     
     //=========================================================================
@@ -535,19 +1133,18 @@ namespace RiftSpire
         for (const auto& block : blocks)
         {
             writer.ArrayItem();
-            SerializeBlock(writer, block.get());
+            SerializeBlock(writer, block.get(), nullptr);
         }
         
         writer.EndArray();
         writer.EndObject();
         
-        return writer.GetResult();
+        return writer.TakeResult();
     }
     
-    std::vector<BlockPtr> ScriptSerializer::BlocksFromClipboard(const std::string& data)
+    std::vector<BlockPtr> ScriptSerializer::BlocksFromClipboard(std::string_view data)
     {
-        // TODO: Implement clipboard deserialization
-        // RS_WARN("Clipboard deserialization not yet implemented");
-        return {};
+        ScriptJsonLoader loader(data);
+        return loader.LoadClipboard();
     }
 }
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "../Core/BlockScript.h"
+#include "BinaryScript.h"
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace RiftSpire
 {
+    class JsonWriter;
+    
     //=========================================================================
     // ScriptSerializer - Serializes/deserializes BlockScripts
     //=========================================================================
@@ -20,8 +24,12 @@ namespace RiftSpire
         /// Serialize script to JSON string
         static std::string ToJson(const BlockScript* script, bool pretty = true);
         
-        /// Deserialize script from JSON string
-        static BlockScriptPtr FromJson(const std::string& json);
+        /// Serialize into a caller-owned writer (reuse its buffer across
+        /// autosaves, or attach a file to stream the output)
+        static void WriteJson(const BlockScript* script, JsonWriter& writer);
+        
+        /// Deserialize script from JSON text (nullptr if malformed)
+        static BlockScriptPtr FromJson(std::string_view json);
         
         /// Save script to JSON file (.rbs)
         static bool SaveToJsonFile(const BlockScript* script, const std::string& path);
@@ -45,6 +53,9 @@ namespace RiftSpire
         /// Load script from binary file
         static BlockScriptPtr LoadFromBinaryFile(const std::string& path);
         
+        /// Map a binary file without building the editor script (runtime loads)
+        static BinaryScriptFilePtr OpenBinaryFile(const std::string& path);
+        
         //---------------------------------------------------------------------
         // Auto-detect format
         //---------------------------------------------------------------------
@@ -62,13 +73,15 @@ namespace RiftSpire
         /// Serialize blocks to clipboard format
         static std::string BlocksToClipboard(const std::vector<BlockPtr>& blocks);
         
-        /// Deserialize blocks from clipboard format
-        static std::vector<BlockPtr> BlocksFromClipboard(const std::string& data);
+        /// Deserialize blocks from clipboard format. Every block gets a new id
+        /// (links between the pasted blocks are kept), so pasting into the
+        /// script the blocks were copied from adds them instead of clashing.
+        static std::vector<BlockPtr> BlocksFromClipboard(std::string_view data);
         
     private:
         // Version for compatibility
-        static constexpr u32 JSON_VERSION = 1;
-        static constexpr u32 BINARY_VERSION = 1;
-        static constexpr u32 BINARY_MAGIC = 0x52425343;  // "RBSC" = RiftBlocks Script
+        static constexpr u32 JSON_VERSION = 2;  // 2: "blocks" lists every script block
+        static constexpr u32 BINARY_VERSION = BinaryScriptFormat::Version;
+        static constexpr u32 BINARY_MAGIC = BinaryScriptFormat::Magic;
     };
 }
@@ -0,0 +1,109 @@
+#include "TestFramework.h"
+#include <Core/UUID.h>
+#include <Core/RuntimeId.h>
+#include <algorithm>
+#include <cctype>
+#include <thread>
+#include <vector>
+
+using namespace RiftSpire;
+
+namespace
+{
+    constexpr u32 ThreadCount = 8;
+    constexpr u32 IdsPerThread = 20000;
+}
+
+RS_TEST(UUIDGenerateIsUniqueAcrossThreads)
+{
+    // Each thread seeds its own generator; ids from all of them must not collide
+    std::vector<std::vector<UUID>> perThread(ThreadCount);
+    std::vector<std::thread> threads;
+
+    for (u32 t = 0; t < ThreadCount; ++t)
+    {
+        threads.emplace_back([&ids = perThread[t]]
+        {
+            ids.reserve(IdsPerThread);
+            for (u32 i = 0; i < IdsPerThread; ++i)
+            {
+                ids.push_back(UUID::Generate());
+            }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    std::vector<UUID> all;
+    all.reserve(ThreadCount * IdsPerThread);
+    for (const auto& ids : perThread) all.insert(all.end(), ids.begin(), ids.end());
+
+    for (const UUID& id : all)
+    {
+        RS_CHECK(id.IsValid());
+        RS_CHECK(((id.GetHigh() >> 12) & 0xF) == 4);    // Version 4
+        RS_CHECK((id.GetLow() >> 62) == 2);             // RFC 4122 variant
+    }
+
+    std::sort(all.begin(), all.end());
+    RS_CHECK(std::adjacent_find(all.begin(), all.end()) == all.end());
+}
+
+RS_TEST(UUIDStringRoundTrip)
+{
+    for (u32 i = 0; i < 1000; ++i)
+    {
+        const UUID id = UUID::Generate();
+        std::string text = id.ToString();
+        RS_CHECK(text.size() == UUID::StringLength);
+        RS_CHECK(UUID::FromString(text) == id);
+
+        std::transform(text.begin(), text.end(), text.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+        RS_CHECK(UUID::FromString(text) == id);
+    }
+
+    UUID parsed;
+    RS_CHECK(!UUID::TryParse("not-a-uuid", parsed));
+    RS_CHECK(!UUID::TryParse("0123456789abcdef0123456789abcdef0123", parsed));
+    RS_CHECK(!UUID::TryParse("01234567-89ab-cdef-0123-456789abcdeg", parsed));
+}
+
+RS_TEST(RuntimeIdTableIsConsistentAcrossThreads)
+{
+    // Threads acquire the same shared ids plus their own, then release them all
+    RuntimeIdTable& table = RuntimeIdTable::Get();
+    const size_t liveBefore = table.GetLiveCount();
+
+    std::vector<UUID> shared(64);
+    for (UUID& id : shared) id = UUID::Generate();
+
+    std::vector<std::thread> threads;
+    std::vector<u32> mismatches(ThreadCount, 0);
+
+    for (u32 t = 0; t < ThreadCount; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            std::vector<RuntimeId> held;
+            for (u32 round = 0; round < 200; ++round)
+            {
+                for (const UUID& id : shared)
+                {
+                    const RuntimeId runtimeId = table.Acquire(id);
+                    if (table.GetUUID(runtimeId) != id) mismatches[t]++;
+                    held.push_back(runtimeId);
+                }
+
+                const UUID own = UUID::Generate();
+                const RuntimeId ownId = table.Acquire(own);
+                if (table.Find(own) != ownId) mismatches[t]++;
+                held.push_back(ownId);
+            }
+            for (RuntimeId id : held) table.Release(id);
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    for (u32 count : mismatches) RS_CHECK(count == 0);
+    for (const UUID& id : shared) RS_CHECK(table.Find(id) == InvalidRuntimeId);
+    RS_CHECK(table.GetLiveCount() == liveBefore);
+}
@@ -0,0 +1,203 @@
+#include "TestFramework.h"
+#include <Core/Logger.h>
+#include <ECS/Entity.h>
+#include <ECS/Scene.h>
+#include <initializer_list>
+#include <vector>
+
+using namespace RiftSpire;
+
+// Scene forwards its systems' events through the global EventDispatcher
+
+namespace
+{
+    /// Records every event of the given types until destroyed
+    class EventRecorder
+    {
+    public:
+        EventRecorder(std::initializer_list<EventType> types)
+            : m_Types(types)
+        {
+            if (!Logger::GetEngineLogger()) Logger::Init();
+            for (EventType type : m_Types)
+            {
+                EventDispatcher::Get().Subscribe(type, "SceneEventTests", [this](const EventData& data)
+                {
+                    Events.push_back(data);
+                });
+            }
+        }
+
+        ~EventRecorder()
+        {
+            for (EventType type : m_Types)
+            {
+                EventDispatcher::Get().Unsubscribe(type, "SceneEventTests");
+            }
+        }
+
+        u32 Count(EventType type) const
+        {
+            u32 count = 0;
+            for (const EventData& data : Events)
+            {
+                if (data.Type == type) count++;
+            }
+            return count;
+        }
+
+        std::vector<EventData> Events;
+
+    private:
+        std::vector<EventType> m_Types;
+    };
+
+    u64 Handle(Entity entity)
+    {
+        return entt::to_integral(entity.GetHandle());
+    }
+}
+
+RS_TEST(RegenEventsReachTheDispatcher)
+{
+    EventRecorder recorder{ EventType::HealReceived, EventType::HealthChanged };
+    Scene scene;
+
+    Entity unit = scene.CreateEntity("Unit");
+    unit.GetComponent<TransformComponent>().Position = { 1.0f, 2.0f, 3.0f };
+    auto& health = unit.AddComponent<HealthComponent>();
+    health.MaxHealth = 100.0f;
+    health.CurrentHealth = 10.0f;
+    health.HealthRegen = 50.0f;
+
+    for (int tick = 0; tick < 40; ++tick)
+    {
+        scene.OnUpdate(0.05f);
+    }
+
+    // One pair per band crossed on the way to full
+    RS_CHECK(health.CurrentHealth == 100.0f);
+    RS_CHECK(recorder.Count(EventType::HealReceived) == 4);
+    RS_CHECK(recorder.Count(EventType::HealthChanged) == 4);
+    for (const EventData& data : recorder.Events)
+    {
+        RS_CHECK(data.TargetEntity == Handle(unit));
+        RS_CHECK(data.Amount > 0.0f);
+        RS_CHECK(data.Position.z == 3.0f);
+        RS_CHECK(data.Timestamp > 0.0f);
+    }
+}
+
+RS_TEST(CollisionEventsReachTheDispatcher)
+{
+    EventRecorder recorder{ EventType::CollisionBegin, EventType::CollisionStay, EventType::CollisionEnd };
+    Scene scene;
+
+    Entity first = scene.CreateEntity("First");
+    Entity second = scene.CreateEntity("Second");
+    first.AddComponent<ColliderComponent>();
+    second.AddComponent<ColliderComponent>();
+    second.GetComponent<TransformComponent>().Position = { 60.0f, 0.0f, 0.0f };
+
+    scene.OnUpdate(0.05f);
+    scene.OnUpdate(0.05f);
+    RS_CHECK(recorder.Count(EventType::CollisionBegin) == 1);
+    RS_CHECK(recorder.Count(EventType::CollisionStay) == 1);
+
+    // A destroyed side still ends the contact
+    const u64 secondHandle = Handle(second);
+    scene.DestroyEntity(second);
+    scene.OnUpdate(0.05f);
+    RS_CHECK(recorder.Count(EventType::CollisionEnd) == 1);
+    RS_CHECK(recorder.Events.size() == 3);
+
+    for (const EventData& data : recorder.Events)
+    {
+        const bool ordered = data.SourceEntity == Handle(first) && data.TargetEntity == secondHandle;
+        const bool swapped = data.SourceEntity == secondHandle && data.TargetEntity == Handle(first);
+        RS_CHECK(ordered || swapped);
+    }
+}
+
+RS_TEST(AreaEventsReachTheDispatcher)
+{
+    EventRecorder recorder{ EventType::AreaEnter, EventType::AreaLeave };
+    Scene scene;
+
+    Entity area = scene.CreateEntity("Brush");
+    area.AddComponent<AreaTriggerComponent>().Radius = 200.0f;
+    Entity unit = scene.CreateEntity("Unit");
+    unit.GetComponent<TransformComponent>().Position = { 100.0f, 0.0f, 0.0f };
+
+    scene.OnUpdate(0.05f);
+    RS_CHECK(recorder.Count(EventType::AreaEnter) == 1);
+
+    unit.GetComponent<TransformComponent>().Position = { 1000.0f, 0.0f, 0.0f };
+    scene.OnUpdate(0.05f);
+    RS_CHECK(recorder.Count(EventType::AreaLeave) == 1);
+    RS_CHECK(recorder.Events.size() == 2);
+
+    for (const EventData& data : recorder.Events)
+    {
+        RS_CHECK(data.SourceEntity == Handle(area));
+        RS_CHECK(data.TargetEntity == Handle(unit));
+    }
+    RS_CHECK(recorder.Events.back().Position.x == 1000.0f);
+}
+
+RS_TEST(ProjectileEventsReachTheDispatcher)
+{
+    EventRecorder recorder{ EventType::AbilityHit, EventType::AbilityMiss };
+    Scene scene;
+
+    // Wider than any fixed broadphase margin would allow for
+    Entity owner = scene.CreateEntity("Owner");
+    Entity target = scene.CreateEntity("Target");
+    target.GetComponent<TransformComponent>().Position = { 200.0f, 0.0f, 500.0f };
+    target.AddComponent<ColliderComponent>().Radius = 250.0f;
+
+    // Hit lists of projectiles that finish are still there for handlers
+    std::vector<entt::entity> handlerHits;
+    EventDispatcher::Get().Subscribe(EventType::AbilityHit, "SceneEventTests.Hits", [&](const EventData& data)
+    {
+        if (const auto* hits = scene.GetProjectiles().GetHitTargets(data.InstanceId)) handlerHits = *hits;
+    });
+
+    ProjectileDesc desc;
+    desc.Owner = owner.GetHandle();
+    const u32 hit = scene.GetProjectiles().Spawn(scene.GetRegistry(), desc);
+    desc.Direction = { 0.0f, -1.0f };
+    desc.Lifetime = 0.1f;
+    const u32 miss = scene.GetProjectiles().Spawn(scene.GetRegistry(), desc);
+
+    for (int tick = 0; tick < 10; ++tick)
+    {
+        scene.OnUpdate(0.05f);
+    }
+    EventDispatcher::Get().Unsubscribe(EventType::AbilityHit, "SceneEventTests.Hits");
+
+    RS_CHECK(scene.GetProjectiles().GetCount() == 0);
+    RS_CHECK(recorder.Events.size() == 2);
+    RS_CHECK(recorder.Count(EventType::AbilityHit) == 1);
+    RS_CHECK(recorder.Count(EventType::AbilityMiss) == 1);
+    RS_CHECK(handlerHits.size() == 1 && handlerHits[0] == target.GetHandle());
+
+    // Gone once the next update has run
+    RS_CHECK(!scene.GetProjectiles().GetHitTargets(hit));
+
+    for (const EventData& data : recorder.Events)
+    {
+        RS_CHECK(data.SourceEntity == Handle(owner));
+        if (data.Type == EventType::AbilityHit)
+        {
+            RS_CHECK(data.InstanceId == hit);
+            RS_CHECK(data.TargetEntity == Handle(target));
+            RS_CHECK(data.Position.z > 0.0f && data.Position.z < 500.0f);
+        }
+        else
+        {
+            RS_CHECK(data.InstanceId == miss);
+            RS_CHECK(data.Position.z < 0.0f);
+        }
+    }
+}
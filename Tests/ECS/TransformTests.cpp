@@ -0,0 +1,223 @@
+#include "TestFramework.h"
+#include <Core/Logger.h>
+#include <Core/SIMD.h>
+#include <ECS/HierarchySystem.h>
+#include <ECS/TransformSystem.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+
+using namespace RiftSpire;
+
+namespace
+{
+    /// Relative to the largest entry, since translations sum large terms
+    bool Near(const glm::mat4& a, const glm::mat4& b, float tolerance)
+    {
+        float scale = 1.0f;
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                scale = std::max({ scale, std::abs(a[column][row]), std::abs(b[column][row]) });
+            }
+        }
+
+        for (int column = 0; column < 4; ++column)
+        {
+            for (int row = 0; row < 4; ++row)
+            {
+                if (std::abs(a[column][row] - b[column][row]) > tolerance * scale) return false;
+            }
+        }
+        return true;
+    }
+
+    void RandomizeTransform(std::mt19937& rng, TransformComponent& transform)
+    {
+        std::uniform_real_distribution<float> position(-5000.0f, 5000.0f);
+        std::uniform_real_distribution<float> angle(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> scale(0.1f, 3.0f);
+
+        transform.Position = { position(rng), position(rng), position(rng) };
+        transform.Rotation = { angle(rng), angle(rng), angle(rng) };
+        transform.Scale = { scale(rng), scale(rng), scale(rng) };
+    }
+
+    glm::quat RandomOrientation(std::mt19937& rng)
+    {
+        std::normal_distribution<float> component(0.0f, 1.0f);
+        glm::quat q(component(rng), component(rng), component(rng), component(rng));
+        const float length = std::sqrt(q.w * q.w + q.x * q.x + q.y * q.y + q.z * q.z);
+        return glm::quat(q.w / length, q.x / length, q.y / length, q.z / length);
+    }
+
+    /// Plain glm composition, the reference for the SIMD batches
+    glm::mat4 ScalarMatrix(const entt::registry& registry, entt::entity entity)
+    {
+        const TransformComponent& transform = registry.get<TransformComponent>(entity);
+        if (const auto* orientation = registry.try_get<OrientationComponent>(entity))
+        {
+            return glm::translate(glm::mat4(1.0f), transform.Position)
+                 * glm::mat4_cast(orientation->Rotation)
+                 * glm::scale(glm::mat4(1.0f), transform.Scale);
+        }
+        return transform.GetTransform();
+    }
+
+    /// World matrix by walking up the parents on every call
+    glm::mat4 NaiveWorld(const entt::registry& registry, entt::entity entity)
+    {
+        const auto* node = registry.try_get<HierarchyComponent>(entity);
+        const glm::mat4 local = ScalarMatrix(registry, entity);
+        if (!node || !registry.valid(node->Parent)) return local;
+        return NaiveWorld(registry, node->Parent) * local;
+    }
+}
+
+RS_TEST(SIMDSinCosMatchesStd)
+{
+    std::mt19937 rng(40);
+    std::uniform_real_distribution<float> angle(-100.0f, 100.0f);
+
+    for (u32 i = 0; i < 10000; ++i)
+    {
+        alignas(16) float in[SIMD::Width];
+        alignas(16) float sines[SIMD::Width];
+        alignas(16) float cosines[SIMD::Width];
+        for (float& value : in) value = angle(rng);
+
+        SIMD::Float4 s, c;
+        SIMD::SinCos(SIMD::Load(in), s, c);
+        SIMD::Store(sines, s);
+        SIMD::Store(cosines, c);
+
+        for (u32 lane = 0; lane < SIMD::Width; ++lane)
+        {
+            RS_CHECK(std::abs(sines[lane] - std::sin(in[lane])) < 1e-5f);
+            RS_CHECK(std::abs(cosines[lane] - std::cos(in[lane])) < 1e-5f);
+        }
+    }
+}
+
+RS_TEST(TransformBatchesMatchScalar)
+{
+    // Counts that are not a multiple of the SIMD width, Euler and quaternion
+    // entities mixed, then a random subset changed between updates
+    std::mt19937 rng(41);
+    entt::registry registry;
+    TransformSystem transforms;
+
+    std::vector<entt::entity> entities;
+    for (u32 i = 0; i < 1003; ++i)
+    {
+        const entt::entity entity = registry.create();
+        RandomizeTransform(rng, registry.emplace<TransformComponent>(entity));
+        registry.emplace<WorldTransformComponent>(entity);
+        if (rng() % 3 == 0) registry.emplace<OrientationComponent>(entity).Rotation = RandomOrientation(rng);
+        entities.push_back(entity);
+    }
+
+    for (u32 round = 0; round < 5; ++round)
+    {
+        transforms.Update(registry);
+        for (entt::entity entity : entities)
+        {
+            RS_CHECK(Near(registry.get<WorldTransformComponent>(entity).Matrix, ScalarMatrix(registry, entity), 1e-4f));
+            RS_CHECK(Near(TransformSystem::Compose(registry.get<TransformComponent>(entity)),
+                          registry.get<TransformComponent>(entity).GetTransform(), 1e-4f));
+        }
+
+        for (u32 i = 0; i < 100; ++i)
+        {
+            const entt::entity entity = entities[rng() % entities.size()];
+            RandomizeTransform(rng, registry.get<TransformComponent>(entity));
+            if (auto* orientation = registry.try_get<OrientationComponent>(entity))
+            {
+                orientation->Rotation = RandomOrientation(rng);
+            }
+        }
+    }
+
+    // Nothing changed: nothing rebuilt
+    transforms.Update(registry);
+    RS_CHECK(transforms.Update(registry) == 0);
+}
+
+RS_TEST(HierarchyMatchesNaiveRecursion)
+{
+    // A random forest, checked after building, after local edits and after
+    // reparenting (through SetParent, and detaching by direct writes)
+    if (!Logger::GetEngineLogger()) Logger::Init();
+    std::mt19937 rng(410);
+    entt::registry registry;
+    TransformSystem transforms;
+    HierarchySystem hierarchy;
+    hierarchy.Connect(registry);
+
+    std::vector<entt::entity> entities;
+    for (u32 i = 0; i < 2000; ++i)
+    {
+        const entt::entity entity = registry.create();
+        auto& transform = registry.emplace<TransformComponent>(entity);
+        RandomizeTransform(rng, transform);
+        transform.Position = transform.Position * 0.01f;
+        registry.emplace<WorldTransformComponent>(entity);
+
+        // Parents are always created earlier, so the forest has no cycles
+        if (!entities.empty() && rng() % 8 != 0)
+        {
+            RS_CHECK(hierarchy.SetParent(registry, entity, entities[rng() % entities.size()]));
+        }
+        entities.push_back(entity);
+    }
+
+    auto check = [&]()
+    {
+        transforms.Update(registry);
+        hierarchy.Update(registry);
+
+        u32 mismatches = 0;
+        for (entt::entity entity : entities)
+        {
+            if (!Near(registry.get<WorldTransformComponent>(entity).Matrix, NaiveWorld(registry, entity), 1e-4f)) mismatches++;
+        }
+        RS_CHECK(mismatches == 0);
+
+        // Parents come before their children
+        std::unordered_map<entt::entity, size_t> position;
+        const auto& order = hierarchy.GetOrder();
+        for (size_t i = 0; i < order.size(); ++i) position[order[i]] = i;
+        for (entt::entity entity : order)
+        {
+            const entt::entity parent = registry.get<HierarchyComponent>(entity).Parent;
+            if (registry.valid(parent) && position.count(parent)) RS_CHECK(position[parent] < position[entity]);
+        }
+    };
+
+    check();
+
+    for (u32 round = 0; round < 10; ++round)
+    {
+        for (u32 i = 0; i < 50; ++i)
+        {
+            RandomizeTransform(rng, registry.get<TransformComponent>(entities[rng() % entities.size()]));
+        }
+
+        for (u32 i = 0; i < 20; ++i)
+        {
+            const entt::entity child = entities[rng() % entities.size()];
+            const entt::entity parent = rng() % 5 == 0 ? entt::null : entities[rng() % entities.size()];
+            hierarchy.SetParent(registry, child, parent);  // Cycles are refused
+        }
+
+        // Detached by writing the component directly
+        for (u32 i = 0; i < 5; ++i)
+        {
+            if (auto* node = registry.try_get<HierarchyComponent>(entities[rng() % entities.size()])) node->Parent = entt::null;
+        }
+
+        check();
+    }
+}
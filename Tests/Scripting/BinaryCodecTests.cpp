@@ -0,0 +1,177 @@
+#include "TestFramework.h"
+#include "Scripting/ScriptingTestUtils.h"
+#include <Scripting/Serialization/AbilityBlueprint.h>
+#include <Scripting/Serialization/BinaryCodec.h>
+#include <algorithm>
+
+using namespace RiftSpire;
+using namespace RiftSpire::Tests;
+
+namespace
+{
+    constexpr u32 Iterations = 300;
+
+    /// Scalars plus lists, nested at most depth levels deep
+    Value RandomCodecValue(std::mt19937& rng, u32 depth)
+    {
+        if (depth > 0 && rng() % 5 == 0)
+        {
+            Value list = Value::CreateList();
+            for (u32 i = rng() % 5; i > 0; --i)
+            {
+                list.AsList().push_back(RandomCodecValue(rng, depth - 1));
+            }
+            return list;
+        }
+        return RandomValue(rng);
+    }
+
+    AbilityBlueprint RandomBlueprint(std::mt19937& rng)
+    {
+        AbilityBlueprint blueprint;
+        blueprint.Id = UUID::Generate();
+        blueprint.Name = "Ability " + std::to_string(rng() % 1000);
+        blueprint.Description = RandomValue(rng).AsString();
+        blueprint.BaseCooldown = static_cast<float>(rng() % 100) * 0.5f;
+        blueprint.MaxLevel = 1 + static_cast<int>(rng() % 5);
+        for (int level = 0; level < blueprint.MaxLevel; ++level)
+        {
+            blueprint.CooldownPerLevel.push_back(static_cast<float>(rng() % 20));
+            blueprint.DamagePerLevel.push_back(static_cast<float>(rng() % 500));
+        }
+        blueprint.Version = rng();
+        blueprint.LastModified = (static_cast<u64>(rng()) << 32) | rng();
+
+        std::vector<UUID> ids;
+        for (u32 i = rng() % 24; i > 0; --i)
+        {
+            ASTNode node;
+            node.Id = UUID::Generate();
+            node.TypeId = "fuzz.block" + std::to_string(rng() % 8);
+            for (u32 p = rng() % 4; p > 0; --p)
+            {
+                node.Properties["p" + std::to_string(p)] = RandomCodecValue(rng, 3);
+            }
+            if (!ids.empty() && rng() % 2 == 0) node.NextBlockId = ids[rng() % ids.size()];
+            if (!ids.empty() && rng() % 3 == 0) node.Children.push_back(ids[rng() % ids.size()]);
+            ids.push_back(node.Id);
+            blueprint.ScriptAST.Nodes.emplace(node.Id, std::move(node));
+        }
+        if (!ids.empty())
+        {
+            blueprint.ScriptAST.RootId = ids.front();
+            blueprint.ScriptAST.Connections.push_back({ ids.front(), ids.back(), "out", "in" });
+        }
+        return blueprint;
+    }
+}
+
+RS_TEST(BinaryValueRoundTrip)
+{
+    std::mt19937 rng(33);
+    BinaryWriter writer;
+
+    for (u32 i = 0; i < Iterations; ++i)
+    {
+        const Value value = RandomCodecValue(rng, 6);
+        writer.Clear();
+        writer.WriteValue(value);
+
+        const std::vector<u8> bytes(writer.GetBytes().begin(), writer.GetBytes().end());
+        BinaryReader reader(bytes);
+        Value read;
+        RS_CHECK(reader.ReadValue(read));
+        RS_CHECK(reader.IsAtEnd());
+
+        // Value::operator== does not compare lists, so compare encodings
+        writer.Clear();
+        writer.WriteValue(read);
+        RS_CHECK(std::equal(bytes.begin(), bytes.end(), writer.GetBytes().begin(), writer.GetBytes().end()));
+    }
+}
+
+RS_TEST(BinaryValueNestingLimit)
+{
+    auto nested = [](u32 levels)
+    {
+        Value value(i64(1));
+        for (u32 i = 0; i < levels; ++i)
+        {
+            Value list = Value::CreateList();
+            list.AsList().push_back(value);
+            value = list;
+        }
+        return value;
+    };
+
+    for (u32 levels : { BinaryCodec::MaxValueDepth, BinaryCodec::MaxValueDepth + 1 })
+    {
+        BinaryWriter writer;
+        writer.WriteValue(nested(levels));
+
+        BinaryReader reader(writer.GetBytes());
+        Value read;
+        RS_CHECK(reader.ReadValue(read) == (levels <= BinaryCodec::MaxValueDepth));
+    }
+}
+
+RS_TEST(BlueprintBinaryRoundTrip)
+{
+    std::mt19937 rng(330);
+
+    for (u32 i = 0; i < Iterations; ++i)
+    {
+        const AbilityBlueprint blueprint = RandomBlueprint(rng);
+        const std::vector<u8> bytes = BlueprintSerializer::SerializeToBytes(blueprint);
+        RS_CHECK(bytes.size() == BlueprintSerializer::GetEncodedSize(blueprint));
+
+        AbilityBlueprint read;
+        std::string error;
+        RS_CHECK(BlueprintSerializer::DeserializeFromBytes(bytes, read, &error));
+        RS_CHECK(BlueprintSerializer::SerializeToBytes(read) == bytes);
+    }
+}
+
+RS_TEST(BinaryReaderSurvivesCorruptInput)
+{
+    // Truncated, edited and random payloads must fail cleanly or decode to
+    // something that encodes and decodes again
+    std::mt19937 rng(3300);
+
+    for (u32 i = 0; i < Iterations * 4; ++i)
+    {
+        std::vector<u8> bytes = BlueprintSerializer::SerializeToBytes(RandomBlueprint(rng));
+
+        switch (rng() % 3)
+        {
+            case 0:
+                bytes.resize(rng() % bytes.size());
+                break;
+            case 1:
+                for (u32 edits = 1 + rng() % 8; edits > 0; --edits)
+                {
+                    bytes[rng() % bytes.size()] = static_cast<u8>(rng());
+                }
+                break;
+            default:
+                // Keep the header so the body decoder is reached
+                for (size_t b = std::min<size_t>(8, bytes.size()); b < bytes.size(); ++b)
+                {
+                    bytes[b] = static_cast<u8>(rng());
+                }
+                break;
+        }
+
+        AbilityBlueprint read;
+        if (BlueprintSerializer::DeserializeFromBytes(bytes, read))
+        {
+            AbilityBlueprint again;
+            RS_CHECK(BlueprintSerializer::DeserializeFromBytes(BlueprintSerializer::SerializeToBytes(read), again));
+        }
+
+        BinaryReader reader(bytes);
+        Value value;
+        while (reader.ReadValue(value)) {}
+        RS_CHECK(reader.HasError());
+    }
+}
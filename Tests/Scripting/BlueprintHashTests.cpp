@@ -0,0 +1,119 @@
+#include "TestFramework.h"
+#include "Scripting/ScriptingTestUtils.h"
+#include <Scripting/Serialization/AbilityBlueprint.h>
+#include <thread>
+
+using namespace RiftSpire;
+using namespace RiftSpire::Tests;
+
+namespace
+{
+    ASTNode RandomNode(std::mt19937& rng)
+    {
+        ASTNode node;
+        node.Id = UUID::Generate();
+        node.TypeId = "hash.block" + std::to_string(rng() % 8);
+        node.Properties["value"] = RandomValue(rng);
+        return node;
+    }
+
+    BlockAST RandomAST(std::mt19937& rng, u32 nodeCount)
+    {
+        BlockAST ast;
+        for (u32 i = 0; i < nodeCount; ++i)
+        {
+            ASTNode node = RandomNode(rng);
+            const UUID id = node.Id;
+            ast.Nodes.emplace(id, std::move(node));
+        }
+        return ast;
+    }
+}
+
+RS_TEST(CachedNodesHashMatchesUncached)
+{
+    // Marked edits, and nodes added or removed with or without marking
+    std::mt19937 rng(34);
+
+    for (u32 round = 0; round < 50; ++round)
+    {
+        BlockAST ast = RandomAST(rng, 1 + rng() % 64);
+        RS_CHECK(ast.GetNodesHash() == ast.ComputeNodesHash());
+
+        for (u32 step = 0; step < 20; ++step)
+        {
+            auto it = std::next(ast.Nodes.begin(), static_cast<long>(rng() % ast.Nodes.size()));
+            const UUID id = it->first;
+
+            switch (rng() % 4)
+            {
+                case 0:
+                    ast.EditNode(id)->Properties["value"] = RandomValue(rng);
+                    break;
+                case 1:
+                {
+                    ASTNode node = RandomNode(rng);
+                    const UUID added = node.Id;
+                    ast.Nodes.emplace(added, std::move(node));
+                    if (rng() % 2 == 0) ast.MarkNodeDirty(added);
+                    break;
+                }
+                case 2:
+                    if (ast.Nodes.size() < 2) break;
+                    ast.Nodes.erase(id);
+                    if (rng() % 2 == 0) ast.MarkNodeDirty(id);
+                    break;
+                default:
+                {
+                    // Same count, different ids, nothing marked
+                    ast.Nodes.erase(id);
+                    ASTNode node = RandomNode(rng);
+                    const UUID added = node.Id;
+                    ast.Nodes.emplace(added, std::move(node));
+                    break;
+                }
+            }
+
+            if (rng() % 3 == 0) RS_CHECK(ast.GetNodesHash() == ast.ComputeNodesHash());
+        }
+        RS_CHECK(ast.GetNodesHash() == ast.ComputeNodesHash());
+
+        // Copies hash the same and keep a usable cache
+        const BlockAST copy = ast;
+        RS_CHECK(copy.GetNodesHash() == ast.ComputeNodesHash());
+    }
+}
+
+RS_TEST(UncachedHashSeesUnmarkedEdits)
+{
+    std::mt19937 rng(340);
+    AbilityBlueprint blueprint;
+    blueprint.ScriptAST = RandomAST(rng, 16);
+
+    const u64 before = BlueprintSerializer::ComputeChecksum(blueprint);
+    RS_CHECK(BlueprintSerializer::ComputeChecksumUncached(blueprint) == before);
+
+    // Edited in place without EditNode: only the uncached path notices
+    blueprint.ScriptAST.Nodes.begin()->second.TypeId = "hash.edited";
+    RS_CHECK(BlueprintSerializer::ComputeChecksumUncached(blueprint) != before);
+
+    blueprint.ScriptAST.InvalidateHashes();
+    RS_CHECK(BlueprintSerializer::ComputeChecksum(blueprint) == BlueprintSerializer::ComputeChecksumUncached(blueprint));
+}
+
+RS_TEST(NodesHashFromSeveralThreads)
+{
+    std::mt19937 rng(3400);
+    BlockAST ast = RandomAST(rng, 512);
+    const Hash128 expected = ast.ComputeNodesHash();
+
+    std::vector<std::thread> threads;
+    std::vector<u8> matched(8, 0);
+    for (size_t t = 0; t < matched.size(); ++t)
+    {
+        threads.emplace_back([&, t] { matched[t] = ast.GetNodesHash() == expected; });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    for (u8 match : matched) RS_CHECK(match);
+}
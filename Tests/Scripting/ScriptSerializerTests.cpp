@@ -0,0 +1,128 @@
+#include "TestFramework.h"
+#include "Scripting/ScriptingTestUtils.h"
+#include <Scripting/Serialization/ScriptSerializer.h>
+#include <unordered_map>
+
+using namespace RiftSpire;
+using namespace RiftSpire::Tests;
+
+namespace
+{
+    constexpr u32 Iterations = 200;
+
+    /// Replace every UUID with its order of first appearance, so documents
+    /// that differ only in generated ids compare equal
+    std::string NormalizeIds(const std::string& json)
+    {
+        std::unordered_map<std::string, size_t> order;
+        std::string result;
+        result.reserve(json.size());
+
+        for (size_t i = 0; i < json.size();)
+        {
+            UUID id;
+            if (i + UUID::StringLength <= json.size() &&
+                UUID::TryParse(std::string_view(json).substr(i, UUID::StringLength), id))
+            {
+                const auto [it, added] = order.emplace(json.substr(i, UUID::StringLength), order.size());
+                result += "#" + std::to_string(it->second);
+                i += UUID::StringLength;
+                continue;
+            }
+            result += json[i++];
+        }
+        return result;
+    }
+}
+
+RS_TEST(JsonRoundTripIsExact)
+{
+    EnsureScriptingInitialized();
+    std::mt19937 rng(31);
+
+    for (u32 i = 0; i < Iterations; ++i)
+    {
+        BlockScriptPtr script = RandomScript(rng, 1 + rng() % 40);
+        const std::string json = ScriptSerializer::ToJson(script.get());
+
+        BlockScriptPtr loaded = ScriptSerializer::FromJson(json);
+        RS_CHECK(loaded != nullptr);
+        if (!loaded) continue;
+
+        RS_CHECK(loaded->GetId() == script->GetId());
+        RS_CHECK(loaded->GetBlocks().size() == script->GetBlocks().size());
+        RS_CHECK(ScriptSerializer::ToJson(loaded.get()) == json);
+        RS_CHECK(ScriptSerializer::ToJson(loaded.get(), false) == ScriptSerializer::ToJson(script.get(), false));
+    }
+}
+
+RS_TEST(ClipboardRoundTripKeepsStructure)
+{
+    EnsureScriptingInitialized();
+    std::mt19937 rng(310);
+
+    for (u32 i = 0; i < Iterations; ++i)
+    {
+        BlockScriptPtr script = RandomScript(rng, 1 + rng() % 40);
+        // Copy every top-level block, so no link points outside the selection
+        const std::vector<BlockPtr> copied = script->GetBlocks();
+        const std::string clipboard = ScriptSerializer::BlocksToClipboard(copied);
+
+        const std::vector<BlockPtr> pasted = ScriptSerializer::BlocksFromClipboard(clipboard);
+        RS_CHECK(pasted.size() == copied.size());
+        RS_CHECK(NormalizeIds(ScriptSerializer::BlocksToClipboard(pasted)) == NormalizeIds(clipboard));
+
+        // Pasting into the source script adds every block
+        const size_t before = script->GetBlocks().size();
+        for (const BlockPtr& block : pasted)
+        {
+            RS_CHECK(script->GetBlock(block->GetId()) == nullptr);
+            script->AddBlock(block);
+        }
+        RS_CHECK(script->GetBlocks().size() == before + pasted.size());
+    }
+}
+
+RS_TEST(JsonLoaderSurvivesCorruptInput)
+{
+    // Truncations and random byte edits must fail cleanly or load a script
+    // that saves and loads again
+    EnsureScriptingInitialized();
+    std::mt19937 rng(3100);
+    static constexpr char Noise[] = "{}[],:\"\\0123456789.-eE truefalsenull";
+
+    for (u32 i = 0; i < Iterations; ++i)
+    {
+        BlockScriptPtr script = RandomScript(rng, 1 + rng() % 20);
+        std::string json = ScriptSerializer::ToJson(script.get(), rng() % 2 == 0);
+
+        if (rng() % 4 == 0)
+        {
+            json.resize(rng() % json.size());
+        }
+        else
+        {
+            for (u32 edits = 1 + rng() % 8; edits > 0; --edits)
+            {
+                const size_t at = rng() % json.size();
+                switch (rng() % 3)
+                {
+                    case 0: json[at] = Noise[rng() % (sizeof(Noise) - 1)]; break;
+                    case 1: json.insert(at, 1, Noise[rng() % (sizeof(Noise) - 1)]); break;
+                    default: json.erase(at, 1 + rng() % 8); break;
+                }
+                if (json.empty()) break;
+            }
+        }
+
+        BlockScriptPtr loaded = ScriptSerializer::FromJson(json);
+        if (loaded)
+        {
+            const std::string again = ScriptSerializer::ToJson(loaded.get());
+            RS_CHECK(ScriptSerializer::FromJson(again) != nullptr);
+        }
+
+        std::vector<BlockPtr> pasted = ScriptSerializer::BlocksFromClipboard(json);
+        (void)pasted;
+    }
+}
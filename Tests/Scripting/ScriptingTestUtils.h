@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Scripting/Scripting.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace RiftSpire::Tests
+{
+    /// Register the built-in blocks once for every scripting test
+    inline void EnsureScriptingInitialized()
+    {
+        static const bool s_Initialized = [] { InitScripting(); return true; }();
+        (void)s_Initialized;
+    }
+
+    /// Random scalar value of any type the text formats store
+    inline Value RandomValue(std::mt19937& rng)
+    {
+        std::uniform_int_distribution<int> pick(0, 8);
+        std::uniform_real_distribution<f32> real(-1000.0f, 1000.0f);
+
+        switch (pick(rng))
+        {
+            case 0: return Value(rng() % 2 == 0);
+            case 1: return Value(static_cast<i64>((static_cast<u64>(rng()) << 32) | rng()));
+            case 2: return Value(static_cast<f64>(real(rng)));
+            case 3:
+            {
+                // Quotes, escapes, control characters and UTF-8
+                static constexpr const char* Pieces[] = { "a", "\"", "\\", "\n", "\t", "\x01", "\xC3\xA7", "/", " " };
+                std::string text;
+                for (u32 i = rng() % 12; i > 0; --i) text += Pieces[rng() % std::size(Pieces)];
+                return Value(std::move(text));
+            }
+            case 4: return Value(glm::vec2(real(rng), real(rng)));
+            case 5: return Value(glm::vec3(real(rng), real(rng), real(rng)));
+            case 6: return Value(glm::vec4(real(rng), real(rng), real(rng), real(rng)));
+            case 7: return Value::FromEntityHandle(rng());
+            default: return Value();
+        }
+    }
+
+    /// Random acyclic script: chains, input connections and nested bodies
+    /// over every registered block type
+    inline BlockScriptPtr RandomScript(std::mt19937& rng, u32 blockCount)
+    {
+        const BlockRegistry& registry = BlockRegistry::Get();
+        static const std::vector<std::string> s_Types = registry.GetAllTypeIds();
+
+        auto script = std::make_shared<BlockScript>("Fuzz");
+        std::vector<BlockPtr> blocks;
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            BlockPtr block = registry.CreateBlock(s_Types[rng() % s_Types.size()]);
+            block->SetPosition({ static_cast<f32>(rng() % 2000), static_cast<f32>(rng() % 2000) });
+            block->SetDisabled(rng() % 8 == 0);
+            if (rng() % 6 == 0) block->SetComment("note " + std::to_string(i));
+
+            for (size_t s = 0; s < block->GetInputSlotCount(); ++s)
+            {
+                block->GetInputSlot(s)->SetDefaultValue(RandomValue(rng));
+            }
+            blocks.push_back(block);
+        }
+
+        // Edges only point to later blocks, so the graph stays acyclic; a
+        // block is used as a chain successor, input or nested child at most
+        // once. Nested children are reached through their parent only.
+        std::vector<u8> used(blockCount, 0);
+        std::vector<u8> nested(blockCount, 0);
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            auto takeLater = [&]() -> u32
+            {
+                if (i + 1 >= blockCount) return blockCount;
+                const u32 target = i + 1 + rng() % (blockCount - i - 1);
+                if (used[target]) return blockCount;
+                used[target] = 1;
+                return target;
+            };
+
+            Block* block = blocks[i].get();
+            if (rng() % 2 == 0)
+            {
+                const u32 next = takeLater();
+                if (next < blockCount) block->SetNextBlock(blocks[next]);
+            }
+            for (size_t s = 0; s < block->GetInputSlotCount(); ++s)
+            {
+                if (rng() % 3 != 0) continue;
+                const u32 input = takeLater();
+                if (input < blockCount) block->GetInputSlot(s)->Connect(blocks[input]);
+            }
+            for (size_t s = 0; s < block->GetNestedSlotCount(); ++s)
+            {
+                const u32 child = takeLater();
+                if (child >= blockCount) continue;
+                block->GetNestedSlot(s)->AddNestedBlock(blocks[child]);
+                nested[child] = 1;
+            }
+        }
+
+        for (u32 i = 0; i < blockCount; ++i)
+        {
+            if (!nested[i]) script->AddBlock(blocks[i]);
+        }
+        return script;
+    }
+}
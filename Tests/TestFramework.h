@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+namespace RiftSpire::Tests
+{
+    //=========================================================================
+    // TestCase - One named check, registered at static init
+    //=========================================================================
+
+    struct TestCase
+    {
+        const char* Name;
+        void (*Run)();
+    };
+
+    inline std::vector<TestCase>& GetTestCases()
+    {
+        static std::vector<TestCase> s_Cases;
+        return s_Cases;
+    }
+
+    /// Failed checks in the running test
+    inline int& GetFailureCount()
+    {
+        static int s_Failures = 0;
+        return s_Failures;
+    }
+
+    struct TestRegistrar
+    {
+        TestRegistrar(const char* name, void (*run)()) { GetTestCases().push_back({ name, run }); }
+    };
+}
+
+#define RS_TEST(name) \
+    static void name(); \
+    static ::RiftSpire::Tests::TestRegistrar s_##name##Registrar(#name, name); \
+    static void name()
+
+/// Record a failure and keep going, so one run reports every broken check
+#define RS_CHECK(condition) \
+    do { \
+        if (!(condition)) \
+        { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ::RiftSpire::Tests::GetFailureCount()++; \
+        } \
+    } while (false)
@@ -0,0 +1,27 @@
+#include "TestFramework.h"
+#include <cstring>
+
+using namespace RiftSpire::Tests;
+
+/// Runs every test, or only those whose name contains argv[1]
+int main(int argc, char** argv)
+{
+    const char* filter = argc > 1 ? argv[1] : nullptr;
+    int failed = 0, run = 0;
+
+    for (const TestCase& test : GetTestCases())
+    {
+        if (filter && !std::strstr(test.Name, filter)) continue;
+
+        GetFailureCount() = 0;
+        test.Run();
+        run++;
+
+        const bool passed = GetFailureCount() == 0;
+        std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", test.Name);
+        if (!passed) failed++;
+    }
+
+    std::printf("%d of %d tests passed\n", run - failed, run);
+    return failed == 0 ? 0 : 1;
+}